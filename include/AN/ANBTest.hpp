@@ -0,0 +1,94 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   ANBTest.hpp
+ *
+ * AN coding with signatures: a value x of block b is stored as x * A + S(b), where the signature S(b) = (b + D) mod A
+ * is derived from the value's position and the data version D (ANBD; ANB is the special case D = 0). A value read from
+ * another block or written under another version leaves a remainder other than S(b) and is detected just like a
+ * corrupted value.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <AN/ANTest.hpp>
+
+namespace coding_benchmark {
+
+    static const constexpr size_t ANBD_VERSION = 1; // of the data the ANBD tests encode
+
+    template<typename DATARAW, typename DATAENC, size_t UNROLL>
+    class ANBTest :
+            public ANTest<DATARAW, DATAENC, UNROLL> {
+
+    public:
+        static const constexpr size_t BLOCK_BYTES = 64 * 1024; // of encoded data sharing one signature
+        static const constexpr size_t BLOCK_VALUES = BLOCK_BYTES / sizeof(DATAENC);
+
+    protected:
+        DATAENC D;
+
+    public:
+
+        ANBTest(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const DATAENC A,
+                const DATAENC A_INV,
+                const DATAENC D)
+                : ANTest<DATARAW, DATAENC, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV),
+                  D(D) {
+        }
+
+        virtual ~ANBTest() {
+        }
+
+        DATAENC getSignature(
+                const size_t block) const {
+            return static_cast<DATAENC>((block + D) % this->A);
+        }
+
+        /**
+         * The position of the first value of an encoded buffer, i.e. of a view into bufEncoded, bufResult etc.
+         */
+        static size_t getPosition(
+                const AlignedBlock & buffer) {
+            return buffer.offset / sizeof(DATAENC);
+        }
+
+        /**
+         * Splits the numValues values starting at position into runs of the same block and calls
+         * func(signature, offset, numValuesRun) for each of them, where offset counts from position.
+         */
+        template<typename Func>
+        void ForEachBlock(
+                const size_t position,
+                const size_t numValues,
+                Func && func) const {
+            size_t offset = 0;
+            while (offset < numValues) {
+                const size_t block = (position + offset) / BLOCK_VALUES;
+                const size_t numValuesRun = std::min(numValues - offset, (block + 1) * BLOCK_VALUES - (position + offset));
+                func(getSignature(block), offset, numValuesRun);
+                offset += numValuesRun;
+            }
+        }
+    };
+
+}
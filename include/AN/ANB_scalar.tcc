@@ -0,0 +1,356 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   ANB_scalar.tcc
+ *
+ * Scalar ANB/ANBD kernels for unsigned data, see ANBTest. All kernels work block by block, so that the signature is a
+ * constant within each inner loop.
+ */
+
+#pragma once
+
+#ifndef ANB_SCALAR
+#error "Clients must not include this file directly, but file <AN/ANB_scalar.hpp>!"
+#endif
+
+#include <AN/ANBTest.hpp>
+#include <Util/ArithmeticSelector.hpp>
+#include <Util/AggregateSelector.hpp>
+
+namespace coding_benchmark {
+
+    template<typename DATARAW, typename DATAENC, size_t UNROLL>
+    struct ANB_scalar :
+            public ANBTest<DATARAW, DATAENC, UNROLL>,
+            public ScalarTest {
+
+        static_assert(std::is_unsigned_v<DATARAW>);
+
+        static const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+
+        using ANBTest<DATARAW, DATAENC, UNROLL>::ANBTest;
+
+        virtual ~ANB_scalar() {
+        }
+
+        bool isValid(
+                const DATAENC x,
+                const DATAENC S) const {
+            return static_cast<DATAENC>((x - S) * this->A_INV) <= dMax;
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->ForEachBlock(this->getPosition(config.target), config.numValues, [this,&config] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    auto dataIn = config.source.template begin<DATARAW>() + offset;
+                    const auto dataInEnd = dataIn + numValues;
+                    auto dataOut = config.target.template begin<DATAENC>() + offset;
+                    while (dataIn <= (dataInEnd - UNROLL)) { // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            *dataOut++ = static_cast<DATAENC>(static_cast<DATAENC>(*dataIn++) * this->A + S);
+                        }
+                    }
+                    // remaining numbers
+                    while (dataIn < dataInEnd) {
+                        *dataOut++ = static_cast<DATAENC>(static_cast<DATAENC>(*dataIn++) * this->A + S);
+                    }
+                });
+            }
+        }
+
+        /**
+         * Checks (check) and / or decodes (materialize) the code words of config.target (check only) or config.source.
+         */
+        template<bool check, bool materialize, typename Config>
+        void InternalCoder(
+                const Config & config) {
+            static_assert(check | materialize);
+            const AlignedBlock & source = materialize ? config.source : config.target;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->ForEachBlock(this->getPosition(source), config.numValues, [this,&config,&source,iteration] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = source.template begin<DATAENC>();
+                    auto dataIn = dataBegin + offset;
+                    const auto dataInEnd = dataIn + numValues;
+                    auto dataOut __attribute__((unused)) = config.target.template begin<DATARAW>() + offset;
+                    auto decode = [this,S,dataBegin,iteration] (const DATAENC * in) {
+                        const DATAENC dec = static_cast<DATAENC>((*in - S) * this->A_INV);
+                        if (check && (dec > dMax)) {
+                            std::stringstream ss;
+                            ss << "A=" << this->A << ", A^-1=" << this->A_INV << ", S=" << S;
+                            throw ErrorInfo(__FILE__, __LINE__, in - dataBegin, iteration, ss.str().c_str());
+                        }
+                        return static_cast<DATARAW>(dec);
+                    };
+                    while (dataIn <= (dataInEnd - UNROLL)) { // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            const DATARAW dec = decode(dataIn++);
+                            if constexpr (materialize) {
+                                *dataOut++ = dec;
+                            }
+                        }
+                    }
+                    // remaining numbers
+                    while (dataIn < dataInEnd) {
+                        const DATARAW dec = decode(dataIn++);
+                        if constexpr (materialize) {
+                            *dataOut++ = dec;
+                        }
+                    }
+                });
+            }
+        }
+
+        bool DoCheck() override {
+            return true;
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            InternalCoder<true, false>(config);
+        }
+
+        bool DoDecode() override {
+            return true;
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            InternalCoder<false, true>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            InternalCoder<true, true>(config);
+        }
+
+        bool DoArithmetic(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        bool DoArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        /**
+         * Adding or subtracting an encoded operand keeps the signature. Multiplication and division work on x * A, i.e.
+         * remove the signature first and add it again afterwards.
+         */
+        template<bool check>
+        struct Arithmetor {
+            ANB_scalar & test;
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            Arithmetor(
+                    ANB_scalar & test,
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<template<typename = void> class Functor>
+            void impl() {
+                Functor<> functor;
+                DATAENC operand = config.operand;
+                if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>> || std::is_same_v<Functor<void>, div<void>>) {
+                    operand *= test.A;
+                } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                    // do not encode operand here, otherwise we will have non-code values after the operation!
+                } else {
+                    throw std::runtime_error("Functor not known!");
+                }
+                test.ForEachBlock(test.getPosition(config.source), config.numValues, [this,&functor,operand] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = config.source.template begin<DATAENC>();
+                    auto dataIn = dataBegin + offset;
+                    const auto dataInEnd = dataIn + numValues;
+                    auto dataOut = config.target.template begin<DATAENC>() + offset;
+                    auto compute = [this,&functor,operand,S,dataBegin] (const DATAENC * in) -> DATAENC {
+                        if (check && !test.isValid(*in, S)) {
+                            throw ErrorInfo(__FILE__, __LINE__, in - dataBegin, iteration);
+                        }
+                        if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>>) {
+                            return functor(*in, operand);
+                        } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                            return static_cast<DATAENC>(functor(static_cast<DATAENC>(*in - S), operand) + S);
+                        } else {
+                            return static_cast<DATAENC>(functor(static_cast<DATAENC>(*in - S), operand) * test.A + S); // make sure we get a code word again
+                        }
+                    };
+                    while (dataIn <= (dataInEnd - UNROLL)) { // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            *dataOut++ = compute(dataIn++);
+                        }
+                    }
+                    // remaining numbers
+                    while (dataIn < dataInEnd) {
+                        *dataOut++ = compute(dataIn++);
+                    }
+                });
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, check); // AN codes are not closed under the bitwise operators
+            }
+        };
+
+        void RunArithmetic(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<false>(*this, config, iteration), config.mode);
+            }
+        }
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<true>(*this, config, iteration), config.mode);
+            }
+        }
+
+        bool DoAggregate(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        bool DoAggregateChecked(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        /**
+         * Each block is aggregated on its code words and the signatures are only removed from the block's result, by
+         * funcBlock(total, value, S, numValues). The total is thus an aggregate of x * A.
+         */
+        template<bool check>
+        struct Aggregator {
+            typedef typename Larger<DATAENC>::larger_t larger_t;
+            ANB_scalar & test;
+            const AggregateConfiguration & config;
+            const size_t iteration;
+            Aggregator(
+                    ANB_scalar & test,
+                    const AggregateConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<typename Aggregate, typename Kernel, typename Block>
+            Aggregate impl(
+                    const Aggregate init,
+                    const Aggregate initBlock,
+                    Kernel && funcKernel,
+                    Block && funcBlock) {
+                Aggregate total = init;
+                test.ForEachBlock(test.getPosition(config.source), config.numValues, [&] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = config.source.template begin<DATAENC>();
+                    auto dataIn = dataBegin + offset;
+                    const auto dataInEnd = dataIn + numValues;
+                    Aggregate value = initBlock;
+                    while (dataIn <= (dataInEnd - UNROLL)) {
+                        for (size_t k = 0; k < UNROLL; ++k) {
+                            if (check && !test.isValid(*dataIn, S)) {
+                                throw ErrorInfo(__FILE__, __LINE__, dataIn - dataBegin, iteration);
+                            }
+                            value = funcKernel(value, *dataIn++);
+                        }
+                    }
+                    while (dataIn < dataInEnd) {
+                        if (check && !test.isValid(*dataIn, S)) {
+                            throw ErrorInfo(__FILE__, __LINE__, dataIn - dataBegin, iteration);
+                        }
+                        value = funcKernel(value, *dataIn++);
+                    }
+                    total = funcBlock(total, value, S, numValues);
+                });
+                return total;
+            }
+            template<typename Aggregate>
+            void finalize(
+                    const Aggregate result) {
+                auto dataOut = test.bufScratchPad.template begin<Aggregate>();
+                *dataOut = result;
+                EncodeConfiguration encConf(1, 2, test.bufScratchPad, config.target);
+                test.RunEncode(encConf);
+            }
+            void operator()(
+                    AggregateConfiguration::Sum) {
+                const larger_t sum = impl<larger_t>(0, 0, [] (larger_t sum, DATAENC dataIn) -> larger_t {return sum + dataIn;}, [] (larger_t total, larger_t sum, DATAENC S, size_t numValues) -> larger_t {
+                    return total + sum - static_cast<larger_t>(numValues) * S;
+                });
+                finalize<larger_t>(sum / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Min) {
+                const DATAENC minimum = impl<DATAENC>(std::numeric_limits<DATAENC>::max(), std::numeric_limits<DATAENC>::max(), [] (DATAENC minimum, DATAENC dataIn) -> DATAENC {return dataIn < minimum ? dataIn : minimum;},
+                        [] (DATAENC total, DATAENC minimum, DATAENC S, size_t) -> DATAENC {return std::min(total, static_cast<DATAENC>(minimum - S));});
+                finalize<DATAENC>(minimum / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Max) {
+                const DATAENC maximum = impl<DATAENC>(std::numeric_limits<DATAENC>::min(), std::numeric_limits<DATAENC>::min(), [] (DATAENC maximum, DATAENC dataIn) -> DATAENC {return dataIn > maximum ? dataIn : maximum;},
+                        [] (DATAENC total, DATAENC maximum, DATAENC S, size_t) -> DATAENC {return std::max(total, static_cast<DATAENC>(maximum - S));});
+                finalize<DATAENC>(maximum / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Avg) {
+                const larger_t sum = impl<larger_t>(0, 0, [] (larger_t sum, DATAENC dataIn) -> larger_t {return sum + dataIn;}, [] (larger_t total, larger_t sum, DATAENC S, size_t numValues) -> larger_t {
+                    return total + sum - static_cast<larger_t>(numValues) * S;
+                });
+                finalize<larger_t>(sum / (config.numValues * test.A));
+            }
+        };
+
+        void RunAggregate(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<false>(*this, config, iteration), config.mode);
+            }
+        }
+
+        void RunAggregateChecked(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<true>(*this, config, iteration), config.mode);
+            }
+        }
+    };
+
+}
@@ -0,0 +1,539 @@
+// Copyright (c) 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   ANB_simd.hpp
+ *
+ * ANB (version 0) and ANBD (version ANBD_VERSION) tests, see ANBTest.
+ */
+
+#pragma once
+
+#if defined(__SSE4_2__) or defined(__AVX2__) or defined(__AVX512F__)
+
+#define ANB_SIMD
+
+#include <AN/ANB_simd.tcc>
+
+#undef ANB_SIMD
+
+namespace coding_benchmark {
+
+#ifdef __SSE4_2__
+
+    template<size_t UNROLL>
+    struct ANB_sse42_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m128i, UNROLL> {
+
+        ANB_sse42_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m128i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_sse42_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_sse42_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m128i, UNROLL> {
+
+        ANBD_sse42_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m128i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_sse42_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANB_sse42_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m128i, UNROLL> {
+
+        ANB_sse42_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m128i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_sse42_32_64_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_sse42_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m128i, UNROLL> {
+
+        ANBD_sse42_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m128i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_sse42_32_64_u() {
+        }
+    };
+
+    extern template
+    struct ANB_sse42_16_32_u<1> ;
+    extern template
+    struct ANB_sse42_16_32_u<2> ;
+    extern template
+    struct ANB_sse42_16_32_u<4> ;
+    extern template
+    struct ANB_sse42_16_32_u<8> ;
+    extern template
+    struct ANB_sse42_16_32_u<16> ;
+    extern template
+    struct ANB_sse42_16_32_u<32> ;
+    extern template
+    struct ANB_sse42_16_32_u<64> ;
+    extern template
+    struct ANB_sse42_16_32_u<128> ;
+    extern template
+    struct ANB_sse42_16_32_u<256> ;
+    extern template
+    struct ANB_sse42_16_32_u<512> ;
+    extern template
+    struct ANB_sse42_16_32_u<1024> ;
+
+    extern template
+    struct ANBD_sse42_16_32_u<1> ;
+    extern template
+    struct ANBD_sse42_16_32_u<2> ;
+    extern template
+    struct ANBD_sse42_16_32_u<4> ;
+    extern template
+    struct ANBD_sse42_16_32_u<8> ;
+    extern template
+    struct ANBD_sse42_16_32_u<16> ;
+    extern template
+    struct ANBD_sse42_16_32_u<32> ;
+    extern template
+    struct ANBD_sse42_16_32_u<64> ;
+    extern template
+    struct ANBD_sse42_16_32_u<128> ;
+    extern template
+    struct ANBD_sse42_16_32_u<256> ;
+    extern template
+    struct ANBD_sse42_16_32_u<512> ;
+    extern template
+    struct ANBD_sse42_16_32_u<1024> ;
+
+    extern template
+    struct ANB_sse42_32_64_u<1> ;
+    extern template
+    struct ANB_sse42_32_64_u<2> ;
+    extern template
+    struct ANB_sse42_32_64_u<4> ;
+    extern template
+    struct ANB_sse42_32_64_u<8> ;
+    extern template
+    struct ANB_sse42_32_64_u<16> ;
+    extern template
+    struct ANB_sse42_32_64_u<32> ;
+    extern template
+    struct ANB_sse42_32_64_u<64> ;
+    extern template
+    struct ANB_sse42_32_64_u<128> ;
+    extern template
+    struct ANB_sse42_32_64_u<256> ;
+    extern template
+    struct ANB_sse42_32_64_u<512> ;
+    extern template
+    struct ANB_sse42_32_64_u<1024> ;
+
+    extern template
+    struct ANBD_sse42_32_64_u<1> ;
+    extern template
+    struct ANBD_sse42_32_64_u<2> ;
+    extern template
+    struct ANBD_sse42_32_64_u<4> ;
+    extern template
+    struct ANBD_sse42_32_64_u<8> ;
+    extern template
+    struct ANBD_sse42_32_64_u<16> ;
+    extern template
+    struct ANBD_sse42_32_64_u<32> ;
+    extern template
+    struct ANBD_sse42_32_64_u<64> ;
+    extern template
+    struct ANBD_sse42_32_64_u<128> ;
+    extern template
+    struct ANBD_sse42_32_64_u<256> ;
+    extern template
+    struct ANBD_sse42_32_64_u<512> ;
+    extern template
+    struct ANBD_sse42_32_64_u<1024> ;
+
+#endif /* __SSE4_2__ */
+
+#ifdef __AVX2__
+
+    template<size_t UNROLL>
+    struct ANB_avx2_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m256i, UNROLL> {
+
+        ANB_avx2_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m256i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_avx2_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_avx2_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m256i, UNROLL> {
+
+        ANBD_avx2_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m256i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_avx2_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANB_avx2_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m256i, UNROLL> {
+
+        ANB_avx2_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m256i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_avx2_32_64_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_avx2_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m256i, UNROLL> {
+
+        ANBD_avx2_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m256i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_avx2_32_64_u() {
+        }
+    };
+
+    extern template
+    struct ANB_avx2_16_32_u<1> ;
+    extern template
+    struct ANB_avx2_16_32_u<2> ;
+    extern template
+    struct ANB_avx2_16_32_u<4> ;
+    extern template
+    struct ANB_avx2_16_32_u<8> ;
+    extern template
+    struct ANB_avx2_16_32_u<16> ;
+    extern template
+    struct ANB_avx2_16_32_u<32> ;
+    extern template
+    struct ANB_avx2_16_32_u<64> ;
+    extern template
+    struct ANB_avx2_16_32_u<128> ;
+    extern template
+    struct ANB_avx2_16_32_u<256> ;
+    extern template
+    struct ANB_avx2_16_32_u<512> ;
+    extern template
+    struct ANB_avx2_16_32_u<1024> ;
+
+    extern template
+    struct ANBD_avx2_16_32_u<1> ;
+    extern template
+    struct ANBD_avx2_16_32_u<2> ;
+    extern template
+    struct ANBD_avx2_16_32_u<4> ;
+    extern template
+    struct ANBD_avx2_16_32_u<8> ;
+    extern template
+    struct ANBD_avx2_16_32_u<16> ;
+    extern template
+    struct ANBD_avx2_16_32_u<32> ;
+    extern template
+    struct ANBD_avx2_16_32_u<64> ;
+    extern template
+    struct ANBD_avx2_16_32_u<128> ;
+    extern template
+    struct ANBD_avx2_16_32_u<256> ;
+    extern template
+    struct ANBD_avx2_16_32_u<512> ;
+    extern template
+    struct ANBD_avx2_16_32_u<1024> ;
+
+    extern template
+    struct ANB_avx2_32_64_u<1> ;
+    extern template
+    struct ANB_avx2_32_64_u<2> ;
+    extern template
+    struct ANB_avx2_32_64_u<4> ;
+    extern template
+    struct ANB_avx2_32_64_u<8> ;
+    extern template
+    struct ANB_avx2_32_64_u<16> ;
+    extern template
+    struct ANB_avx2_32_64_u<32> ;
+    extern template
+    struct ANB_avx2_32_64_u<64> ;
+    extern template
+    struct ANB_avx2_32_64_u<128> ;
+    extern template
+    struct ANB_avx2_32_64_u<256> ;
+    extern template
+    struct ANB_avx2_32_64_u<512> ;
+    extern template
+    struct ANB_avx2_32_64_u<1024> ;
+
+    extern template
+    struct ANBD_avx2_32_64_u<1> ;
+    extern template
+    struct ANBD_avx2_32_64_u<2> ;
+    extern template
+    struct ANBD_avx2_32_64_u<4> ;
+    extern template
+    struct ANBD_avx2_32_64_u<8> ;
+    extern template
+    struct ANBD_avx2_32_64_u<16> ;
+    extern template
+    struct ANBD_avx2_32_64_u<32> ;
+    extern template
+    struct ANBD_avx2_32_64_u<64> ;
+    extern template
+    struct ANBD_avx2_32_64_u<128> ;
+    extern template
+    struct ANBD_avx2_32_64_u<256> ;
+    extern template
+    struct ANBD_avx2_32_64_u<512> ;
+    extern template
+    struct ANBD_avx2_32_64_u<1024> ;
+
+#endif /* __AVX2__ */
+
+#ifdef __AVX512F__
+
+    template<size_t UNROLL>
+    struct ANB_avx512_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m512i, UNROLL> {
+
+        ANB_avx512_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m512i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_avx512_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_avx512_16_32_u :
+            public ANB_simd<uint16_t, uint32_t, __m512i, UNROLL> {
+
+        ANBD_avx512_16_32_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint32_t A,
+                const uint32_t A_INV)
+                : ANB_simd<uint16_t, uint32_t, __m512i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_avx512_16_32_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANB_avx512_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m512i, UNROLL> {
+
+        ANB_avx512_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m512i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, 0) {
+        }
+
+        virtual ~ANB_avx512_32_64_u() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct ANBD_avx512_32_64_u :
+            public ANB_simd<uint32_t, uint64_t, __m512i, UNROLL> {
+
+        ANBD_avx512_32_64_u(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const uint64_t A,
+                const uint64_t A_INV)
+                : ANB_simd<uint32_t, uint64_t, __m512i, UNROLL>(name, bufRaw, bufEncoded, bufResult, A, A_INV, ANBD_VERSION) {
+        }
+
+        virtual ~ANBD_avx512_32_64_u() {
+        }
+    };
+
+    extern template
+    struct ANB_avx512_16_32_u<1> ;
+    extern template
+    struct ANB_avx512_16_32_u<2> ;
+    extern template
+    struct ANB_avx512_16_32_u<4> ;
+    extern template
+    struct ANB_avx512_16_32_u<8> ;
+    extern template
+    struct ANB_avx512_16_32_u<16> ;
+    extern template
+    struct ANB_avx512_16_32_u<32> ;
+    extern template
+    struct ANB_avx512_16_32_u<64> ;
+    extern template
+    struct ANB_avx512_16_32_u<128> ;
+    extern template
+    struct ANB_avx512_16_32_u<256> ;
+    extern template
+    struct ANB_avx512_16_32_u<512> ;
+    extern template
+    struct ANB_avx512_16_32_u<1024> ;
+
+    extern template
+    struct ANBD_avx512_16_32_u<1> ;
+    extern template
+    struct ANBD_avx512_16_32_u<2> ;
+    extern template
+    struct ANBD_avx512_16_32_u<4> ;
+    extern template
+    struct ANBD_avx512_16_32_u<8> ;
+    extern template
+    struct ANBD_avx512_16_32_u<16> ;
+    extern template
+    struct ANBD_avx512_16_32_u<32> ;
+    extern template
+    struct ANBD_avx512_16_32_u<64> ;
+    extern template
+    struct ANBD_avx512_16_32_u<128> ;
+    extern template
+    struct ANBD_avx512_16_32_u<256> ;
+    extern template
+    struct ANBD_avx512_16_32_u<512> ;
+    extern template
+    struct ANBD_avx512_16_32_u<1024> ;
+
+    extern template
+    struct ANB_avx512_32_64_u<1> ;
+    extern template
+    struct ANB_avx512_32_64_u<2> ;
+    extern template
+    struct ANB_avx512_32_64_u<4> ;
+    extern template
+    struct ANB_avx512_32_64_u<8> ;
+    extern template
+    struct ANB_avx512_32_64_u<16> ;
+    extern template
+    struct ANB_avx512_32_64_u<32> ;
+    extern template
+    struct ANB_avx512_32_64_u<64> ;
+    extern template
+    struct ANB_avx512_32_64_u<128> ;
+    extern template
+    struct ANB_avx512_32_64_u<256> ;
+    extern template
+    struct ANB_avx512_32_64_u<512> ;
+    extern template
+    struct ANB_avx512_32_64_u<1024> ;
+
+    extern template
+    struct ANBD_avx512_32_64_u<1> ;
+    extern template
+    struct ANBD_avx512_32_64_u<2> ;
+    extern template
+    struct ANBD_avx512_32_64_u<4> ;
+    extern template
+    struct ANBD_avx512_32_64_u<8> ;
+    extern template
+    struct ANBD_avx512_32_64_u<16> ;
+    extern template
+    struct ANBD_avx512_32_64_u<32> ;
+    extern template
+    struct ANBD_avx512_32_64_u<64> ;
+    extern template
+    struct ANBD_avx512_32_64_u<128> ;
+    extern template
+    struct ANBD_avx512_32_64_u<256> ;
+    extern template
+    struct ANBD_avx512_32_64_u<512> ;
+    extern template
+    struct ANBD_avx512_32_64_u<1024> ;
+
+#endif /* __AVX512F__ */
+
+}
+
+#endif /* defined(__SSE4_2__) or defined(__AVX2__) or defined(__AVX512F__) */
@@ -0,0 +1,446 @@
+// Copyright (c) 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   ANB_simd.tcc
+ *
+ * SIMD ANB/ANBD kernels for unsigned data, see ANBTest and ANB_scalar. Each block is processed with its signature
+ * broadcast into a vector, so that compared to AN_simd_inv encoding costs one more addition and checking or decoding
+ * one more subtraction per vector.
+ */
+
+#pragma once
+
+#ifndef ANB_SIMD
+#error "Clients must not include this file directly, but file <AN/ANB_simd.hpp>!"
+#endif
+
+#include <AN/ANBTest.hpp>
+#include <AN/AN_simd.hpp>
+
+using namespace coding_benchmark::simd;
+
+namespace coding_benchmark {
+
+    template<typename DATARAW, typename DATAENC, typename VEC, size_t UNROLL>
+    struct ANB_simd :
+            public ANBTest<DATARAW, DATAENC, UNROLL>,
+            public SIMDTest<VEC> {
+
+        static_assert(std::is_unsigned_v<DATARAW>);
+
+        typedef mm<VEC, DATAENC> mmEnc;
+        typedef mm_op<VEC, DATAENC, std::less_equal> mmEncLE;
+
+        static const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+        static const constexpr size_t NUM_VALUES_PER_VECTOR = sizeof(VEC) / sizeof(DATAENC);
+
+        using ANBTest<DATARAW, DATAENC, UNROLL>::ANBTest;
+
+        virtual ~ANB_simd() {
+        }
+
+        bool isValid(
+                const DATAENC x,
+                const DATAENC S) const {
+            return static_cast<DATAENC>((x - S) * this->A_INV) <= dMax;
+        }
+
+        static inline VEC decode(
+                const VEC mmIn,
+                const VEC mmS,
+                const VEC mmAInv) {
+            return mm_op<VEC, DATAENC, mul>::compute(mm_op<VEC, DATAENC, sub>::compute(mmIn, mmS), mmAInv);
+        }
+
+        static inline bool isValid(
+                const VEC mmDec,
+                const VEC mmDMax) {
+            return mmEncLE::cmp_mask(mmDec, mmDMax) == mmEnc::FULL_MASK;
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            const VEC mmA = mmEnc::set1(this->A);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->ForEachBlock(this->getPosition(config.target), config.numValues, [this,&config,&mmA] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    auto inS = config.source.template begin<DATARAW>() + offset;
+                    const auto inSend = inS + numValues;
+                    auto inV = reinterpret_cast<VEC*>(inS);
+                    const auto inVend = reinterpret_cast<VEC*>(inSend);
+                    auto outV = reinterpret_cast<VEC*>(config.target.template begin<DATAENC>() + offset);
+                    const VEC mmS = mmEnc::set1(S);
+                    auto encode = [&mmA,&mmS] (VEC mmIn) {
+                        return mm_op<VEC, DATAENC, add>::compute(mm_op<VEC, DATAENC, mul>::compute(mmIn, mmA), mmS);
+                    };
+                    while (inV <= (inVend - UNROLL)) {
+                        // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            auto mmIn = mm<VEC>::loadu(inV++);
+                            *outV++ = encode(mm<VEC, DATARAW>::cvt_larger_lo(mmIn));
+                            *outV++ = encode(mm<VEC, DATARAW>::cvt_larger_hi(mmIn));
+                        }
+                    }
+                    // remaining numbers
+                    while (inV <= (inVend - 1)) {
+                        auto mmIn = mm<VEC>::loadu(inV++);
+                        *outV++ = encode(mm<VEC, DATARAW>::cvt_larger_lo(mmIn));
+                        *outV++ = encode(mm<VEC, DATARAW>::cvt_larger_hi(mmIn));
+                    }
+                    inS = reinterpret_cast<DATARAW*>(inV);
+                    auto outS = reinterpret_cast<DATAENC*>(outV);
+                    while (inS < inSend) {
+                        *outS++ = static_cast<DATAENC>(static_cast<DATAENC>(*inS++) * this->A + S);
+                    }
+                });
+            }
+        }
+
+        /**
+         * Checks (check) and / or decodes (materialize) the code words of config.target (check only) or config.source.
+         */
+        template<bool check, bool materialize, typename Config>
+        void InternalCoder(
+                const Config & config) {
+            static_assert(check | materialize);
+            const AlignedBlock & source = materialize ? config.source : config.target;
+            const VEC mmDMax = mmEnc::set1(dMax);
+            const VEC mmAInv = mmEnc::set1(this->A_INV);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->ForEachBlock(this->getPosition(source), config.numValues, [this,&config,&source,&mmDMax,&mmAInv,iteration] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = source.template begin<DATAENC>();
+                    auto inS = dataBegin + offset;
+                    const auto inSend = inS + numValues;
+                    auto inV = reinterpret_cast<VEC*>(inS);
+                    const auto inVend = reinterpret_cast<VEC*>(inSend);
+                    auto outS __attribute__((unused)) = config.target.template begin<DATARAW>() + offset;
+                    const VEC mmS = mmEnc::set1(S);
+                    auto decodeV = [&] (VEC * in) {
+                        auto mmDec = decode(mm<VEC>::loadu(in), mmS, mmAInv);
+                        if (check && !isValid(mmDec, mmDMax)) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(in) - dataBegin, iteration);
+                        }
+                        if constexpr (materialize) {
+                            writeout<DATARAW, DATAENC, VEC>(mmDec, outS);
+                            outS += NUM_VALUES_PER_VECTOR;
+                        }
+                    };
+                    while (inV <= (inVend - UNROLL)) {
+                        // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            decodeV(inV++);
+                        }
+                    }
+                    // remaining numbers
+                    while (inV <= (inVend - 1)) {
+                        decodeV(inV++);
+                    }
+                    for (inS = reinterpret_cast<DATAENC*>(inV); inS < inSend; ++inS) {
+                        const DATAENC dec = static_cast<DATAENC>((*inS - S) * this->A_INV);
+                        if (check && (dec > dMax)) {
+                            throw ErrorInfo(__FILE__, __LINE__, inS - dataBegin, iteration);
+                        }
+                        if constexpr (materialize) {
+                            *outS++ = static_cast<DATARAW>(dec);
+                        }
+                    }
+                });
+            }
+        }
+
+        bool DoCheck() override {
+            return true;
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            InternalCoder<true, false>(config);
+        }
+
+        bool DoDecode() override {
+            return true;
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            InternalCoder<false, true>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            InternalCoder<true, true>(config);
+        }
+
+        bool DoArithmetic(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        bool DoArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        /**
+         * See ANB_scalar::Arithmetor.
+         */
+        template<bool check>
+        struct Arithmetor {
+            ANB_simd & test;
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            Arithmetor(
+                    ANB_simd & test,
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<template<typename = void> class Functor>
+            void impl() {
+                DATAENC operand = config.operand;
+                if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>> || std::is_same_v<Functor<void>, div<void>>) {
+                    operand *= test.A;
+                } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                    // do not encode operand here, otherwise we will have non-code values after the operation!
+                } else {
+                    throw std::runtime_error("Functor not known!");
+                }
+                const VEC mmOperand = mmEnc::set1(operand);
+                const VEC mmA = mmEnc::set1(test.A);
+                const VEC mmAInv = mmEnc::set1(test.A_INV);
+                const VEC mmDMax = mmEnc::set1(dMax);
+                test.ForEachBlock(test.getPosition(config.source), config.numValues, [&] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = config.source.template begin<DATAENC>();
+                    auto inS = dataBegin + offset;
+                    const auto inSend = inS + numValues;
+                    auto inV = reinterpret_cast<VEC*>(inS);
+                    const auto inVend = reinterpret_cast<VEC*>(inSend);
+                    auto outV = reinterpret_cast<VEC*>(config.target.template begin<DATAENC>() + offset);
+                    const VEC mmS = mmEnc::set1(S);
+                    auto computeV = [&] (VEC * in) {
+                        auto mmIn = mm<VEC>::loadu(in);
+                        if (check && !isValid(decode(mmIn, mmS, mmAInv), mmDMax)) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(in) - dataBegin, iteration);
+                        }
+                        if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>>) {
+                            return mm_op<VEC, DATAENC, Functor>::compute(mmIn, mmOperand);
+                        } else {
+                            auto x = mm_op<VEC, DATAENC, Functor>::compute(mm_op<VEC, DATAENC, sub>::compute(mmIn, mmS), mmOperand);
+                            if constexpr (std::is_same_v<Functor<void>, div<void>>) {
+                                x = mm_op<VEC, DATAENC, mul>::compute(x, mmA); // make sure we get a code word again
+                            }
+                            return mm_op<VEC, DATAENC, add>::compute(x, mmS);
+                        }
+                    };
+                    while (inV <= (inVend - UNROLL)) {
+                        // let the compiler unroll the loop
+                        for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                            *outV++ = computeV(inV++);
+                        }
+                    }
+                    // remaining numbers
+                    while (inV <= (inVend - 1)) {
+                        *outV++ = computeV(inV++);
+                    }
+                    Functor<> functor;
+                    auto outS = reinterpret_cast<DATAENC*>(outV);
+                    for (inS = reinterpret_cast<DATAENC*>(inV); inS < inSend; ++inS) {
+                        if (check && !test.isValid(*inS, S)) {
+                            throw ErrorInfo(__FILE__, __LINE__, inS - dataBegin, iteration);
+                        }
+                        if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>>) {
+                            *outS++ = functor(*inS, operand);
+                        } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                            *outS++ = static_cast<DATAENC>(functor(static_cast<DATAENC>(*inS - S), operand) + S);
+                        } else {
+                            *outS++ = static_cast<DATAENC>(functor(static_cast<DATAENC>(*inS - S), operand) * test.A + S);
+                        }
+                    }
+                });
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, check); // AN codes are not closed under the bitwise operators
+            }
+        };
+
+        void RunArithmetic(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<false>(*this, config, iteration), config.mode);
+            }
+        }
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<true>(*this, config, iteration), config.mode);
+            }
+        }
+
+        bool DoAggregate(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        bool DoAggregateChecked(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        /**
+         * See ANB_scalar::Aggregator. The vector result of each block is reduced to a scalar before funcBlock removes
+         * the block's signature from it.
+         */
+        template<bool check>
+        struct Aggregator {
+            typedef typename Larger<DATAENC>::larger_t larger_t;
+            ANB_simd & test;
+            const AggregateConfiguration & config;
+            const size_t iteration;
+            Aggregator(
+                    ANB_simd & test,
+                    const AggregateConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename VectorToScalar, typename KernelScalar, typename Block>
+            Aggregate impl(
+                    const Aggregate init,
+                    InitializeVector && funcInitVector,
+                    KernelVector && funcKernelVector,
+                    VectorToScalar && funcVectorToScalar,
+                    KernelScalar && funcKernelScalar,
+                    Block && funcBlock) {
+                const VEC mmAInv = mmEnc::set1(test.A_INV);
+                const VEC mmDMax = mmEnc::set1(dMax);
+                Aggregate total = init;
+                test.ForEachBlock(test.getPosition(config.source), config.numValues, [&] (const DATAENC S, const size_t offset, const size_t numValues) {
+                    const auto dataBegin = config.source.template begin<DATAENC>();
+                    auto inS = dataBegin + offset;
+                    const auto inSend = inS + numValues;
+                    auto inV = reinterpret_cast<VEC*>(inS);
+                    const auto inVend = reinterpret_cast<VEC*>(inSend);
+                    const VEC mmS = mmEnc::set1(S);
+                    auto mmValue = funcInitVector();
+                    auto kernelV = [&] (VEC * in) {
+                        auto mmIn = mm<VEC>::loadu(in);
+                        if (check && !isValid(decode(mmIn, mmS, mmAInv), mmDMax)) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(in) - dataBegin, iteration);
+                        }
+                        mmValue = funcKernelVector(mmValue, mmIn);
+                    };
+                    while (inV <= (inVend - UNROLL)) {
+                        for (size_t k = 0; k < UNROLL; ++k) {
+                            kernelV(inV++);
+                        }
+                    }
+                    while (inV <= (inVend - 1)) {
+                        kernelV(inV++);
+                    }
+                    Aggregate value = funcVectorToScalar(mmValue);
+                    for (inS = reinterpret_cast<DATAENC*>(inV); inS < inSend; ++inS) {
+                        if (check && !test.isValid(*inS, S)) {
+                            throw ErrorInfo(__FILE__, __LINE__, inS - dataBegin, iteration);
+                        }
+                        value = funcKernelScalar(value, *inS);
+                    }
+                    total = funcBlock(total, value, S, numValues);
+                });
+                return total;
+            }
+            template<typename Aggregate>
+            void finalize(
+                    const Aggregate result) {
+                auto out = test.bufScratchPad.template begin<Aggregate>();
+                *out = result;
+                EncodeConfiguration encConf(1, 2, test.bufScratchPad, config.target);
+                test.RunEncode(encConf);
+            }
+            larger_t sum() {
+                return impl<larger_t>(0, [] {return mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
+                    auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
+                    mmLo = mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
+                    auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
+                    return mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
+                }, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t total, larger_t sum, DATAENC S, size_t numValues) {
+                    return total + sum - static_cast<larger_t>(numValues) * S;
+                });
+            }
+            void operator()(
+                    AggregateConfiguration::Sum) {
+                finalize<larger_t>(sum() / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Min) {
+                const DATAENC minimum = impl<DATAENC>(std::numeric_limits<DATAENC>::max(), [] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::max());},
+                        [](VEC mmMin, VEC mmTmp) {return mm<VEC, DATAENC>::min(mmMin, mmTmp);}, [](VEC mmMin) {return mm<VEC, DATAENC>::min(mmMin);},
+                        [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC total, DATAENC min, DATAENC S, size_t) {return std::min(total, static_cast<DATAENC>(min - S));});
+                finalize<DATAENC>(minimum / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Max) {
+                const DATAENC maximum = impl<DATAENC>(std::numeric_limits<DATAENC>::min(), [] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::min());},
+                        [](VEC mmMax, VEC mmTmp) {return mm<VEC, DATAENC>::max(mmMax, mmTmp);}, [](VEC mmMax) {return mm<VEC, DATAENC>::max(mmMax);},
+                        [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC total, DATAENC max, DATAENC S, size_t) {return std::max(total, static_cast<DATAENC>(max - S));});
+                finalize<DATAENC>(maximum / test.A);
+            }
+            void operator()(
+                    AggregateConfiguration::Avg) {
+                finalize<larger_t>(sum() / (config.numValues * test.A));
+            }
+        };
+
+        void RunAggregate(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<false>(*this, config, iteration), config.mode);
+            }
+        }
+
+        void RunAggregateChecked(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<true>(*this, config, iteration), config.mode);
+            }
+        }
+    };
+
+}
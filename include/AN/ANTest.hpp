@@ -14,10 +14,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <climits>
+#include <limits>
+
 #include <Util/Test.hpp>
+#include <Util/Helpers.hpp>
 
 namespace coding_benchmark {
 
+    static const constexpr size_t AN_DEFERRED_MAX_BLOCK_VALUES = 64 * 1024; // so that a detected error is still narrowed down to a block
+
     template<typename DATARAW, typename DATAENC, size_t UNROLL>
     class ANTest :
             public Test<DATARAW, DATAENC> {
@@ -45,6 +52,36 @@ namespace coding_benchmark {
 
         virtual ~ANTest() {
         }
+
+        /**
+         * Deferred verification sums up the code words in lanes of the next larger type, i.e. 64 bits for both 16- and
+         * 32-bit data.
+         */
+        typedef typename Larger<DATAENC>::larger_t deferred_t;
+
+        /**
+         * The number of code words of which deferred verification checks only the sum. Modulo 2^|deferred_t| such a sum
+         * is the code word of the sum of the data, so a block of n values with n * max(DATARAW) * A <= max(deferred_t)
+         * passes by chance no more often than a single code word. Errors of several values of the same block may cancel
+         * out, though.
+         */
+        size_t getDeferredBlockValues() const {
+            const size_t n = static_cast<size_t>(std::numeric_limits<deferred_t>::max() / A / std::numeric_limits<DATARAW>::max());
+            return std::clamp<size_t>(n, 1, AN_DEFERRED_MAX_BLOCK_VALUES);
+        }
+
+        /**
+         * The inverse of A modulo 2^|deferred_t|. Newton's iteration doubles the number of correct low bits in each step,
+         * starting with 3 bits for any odd A.
+         */
+        deferred_t getDeferredAInv() const {
+            const deferred_t a = A;
+            deferred_t aInv = a;
+            for (size_t bits = 3; bits < (sizeof(deferred_t) * CHAR_BIT); bits *= 2) {
+                aInv = static_cast<deferred_t>(aInv * static_cast<deferred_t>(2 - a * aInv));
+            }
+            return aInv;
+        }
     };
 
 }
@@ -26,6 +26,8 @@
 #include <AN/AN_scalar_s_inv.tcc>
 #include <AN/AN_scalar_u_inv.tcc>
 #include <AN/AN_scalar_divmod.tcc>
+#include <AN/AN_scalar_u_inv_deferred.tcc>
+#include <AN/AN_scalar_u_inv_nt.tcc>
 
 #undef AN_SCALAR
 
@@ -427,4 +429,148 @@ namespace coding_benchmark {
     extern template
     struct AN_scalar_32_64_u_divmod<1024> ;
 
+    /**
+     * AN_scalar_16_32_u_inv with deferred verification, see AN_scalar_u_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_scalar_16_32_u_inv_deferred :
+            public AN_scalar_u_inv_deferred<uint16_t, uint32_t, UNROLL> {
+
+        using AN_scalar_u_inv_deferred<uint16_t, uint32_t, UNROLL>::AN_scalar_u_inv_deferred;
+
+        virtual ~AN_scalar_16_32_u_inv_deferred() {
+        }
+    };
+
+    /**
+     * AN_scalar_32_64_u_inv with deferred verification, see AN_scalar_u_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_scalar_32_64_u_inv_deferred :
+            public AN_scalar_u_inv_deferred<uint32_t, uint64_t, UNROLL> {
+
+        using AN_scalar_u_inv_deferred<uint32_t, uint64_t, UNROLL>::AN_scalar_u_inv_deferred;
+
+        virtual ~AN_scalar_32_64_u_inv_deferred() {
+        }
+    };
+
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<1> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<2> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<4> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<8> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<16> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<32> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<64> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<128> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<256> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<512> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_deferred<1024> ;
+
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<1> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<2> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<4> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<8> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<16> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<32> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<64> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<128> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<256> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<512> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_deferred<1024> ;
+
+    /**
+     * AN_scalar_16_32_u_inv with streaming stores, see AN_scalar_u_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_scalar_16_32_u_inv_nt :
+            public AN_scalar_u_inv_nt<uint16_t, uint32_t, UNROLL, STREAM_PREFETCH> {
+
+        using AN_scalar_u_inv_nt<uint16_t, uint32_t, UNROLL, STREAM_PREFETCH>::AN_scalar_u_inv_nt;
+
+        virtual ~AN_scalar_16_32_u_inv_nt() {
+        }
+    };
+
+    /**
+     * AN_scalar_32_64_u_inv with streaming stores, see AN_scalar_u_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_scalar_32_64_u_inv_nt :
+            public AN_scalar_u_inv_nt<uint32_t, uint64_t, UNROLL, STREAM_PREFETCH> {
+
+        using AN_scalar_u_inv_nt<uint32_t, uint64_t, UNROLL, STREAM_PREFETCH>::AN_scalar_u_inv_nt;
+
+        virtual ~AN_scalar_32_64_u_inv_nt() {
+        }
+    };
+
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<1> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<2> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<4> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<8> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<16> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<32> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<64> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<128> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<256> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<512> ;
+    extern template
+    struct AN_scalar_16_32_u_inv_nt<1024> ;
+
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<1> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<2> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<4> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<8> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<16> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<32> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<64> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<128> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<256> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<512> ;
+    extern template
+    struct AN_scalar_32_64_u_inv_nt<1024> ;
+
 }
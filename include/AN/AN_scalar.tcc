@@ -22,6 +22,7 @@
 #pragma once
 
 #include <AN/ANTest.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
 
@@ -56,6 +57,77 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoFilter() override {
+            return true;
+        }
+
+        /**
+         * AN encoding is order-preserving (as long as A * max(DATARAW) fits into DATAENC), so the predicates are encoded
+         * once and the code words are compared directly, without decoding them. isValid checks a single code word.
+         */
+        template<typename IsValid>
+        void Filter(
+                const FilterConfiguration & config,
+                const size_t iteration,
+                IsValid isValid) {
+            const auto range = FilterRange<DATARAW>(config).template transform<DATAENC>([this] (DATARAW x) {
+                return static_cast<DATAENC>(static_cast<DATAENC>(x) * this->A);
+            });
+            BitmapWriter bitmap(config.target);
+            auto data = config.source.template begin<DATAENC>();
+            const auto dataEnd = data + config.numValues;
+            while (data <= (dataEnd - UNROLL)) { // let the compiler unroll the loop
+                for (size_t k = 0; k < UNROLL; ++k) {
+                    if (isValid(*data)) {
+                        bitmap.append(range.matches(*data++));
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<DATAENC>(), iteration);
+                    }
+                }
+            }
+            // remaining numbers
+            while (data < dataEnd) {
+                if (isValid(*data)) {
+                    bitmap.append(range.matches(*data++));
+                } else {
+                    throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<DATAENC>(), iteration);
+                }
+            }
+            bitmap.flush();
+        }
+
+        /**
+         * Flags each value for which isValid fails, see ScrubConfiguration.
+         */
+        template<typename IsValid>
+        void Scrub(
+                const ScrubConfiguration & config,
+                IsValid isValid) {
+            BitmapWriter bitmap(config.target);
+            auto data = config.source.template begin<DATAENC>();
+            const auto dataEnd = data + config.numValues;
+            while (data <= (dataEnd - UNROLL)) { // let the compiler unroll the loop
+                for (size_t k = 0; k < UNROLL; ++k) {
+                    bitmap.append(!isValid(*data++));
+                }
+            }
+            // remaining numbers
+            while (data < dataEnd) {
+                bitmap.append(!isValid(*data++));
+            }
+            bitmap.flush();
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                Filter(config, iteration, [] (DATAENC) {
+                    return true;
+                });
+            }
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -117,6 +189,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, false); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmetic(
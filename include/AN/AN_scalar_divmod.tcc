@@ -62,6 +62,34 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Scrub(config, [this] (DATAENC x) {
+                    return (x % this->A) == 0;
+                });
+            }
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Filter(config, iteration, [this] (DATAENC x) {
+                    return (x % this->A) == 0;
+                });
+            }
+        }
+
         bool DoArithmeticChecked(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -136,6 +164,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmeticChecked(
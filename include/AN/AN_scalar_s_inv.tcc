@@ -78,6 +78,40 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+            const constexpr DATAENC dMin = static_cast<DATAENC>(std::numeric_limits<DATARAW>::min());
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Scrub(config, [this] (DATAENC x) {
+                    DATAENC dec = static_cast<DATAENC>(x * this->A_INV);
+                    return (dec >= dMin) & (dec <= dMax);
+                });
+            }
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+                const constexpr DATAENC dMin = static_cast<DATAENC>(std::numeric_limits<DATARAW>::min());
+                this->Filter(config, iteration, [this] (DATAENC x) {
+                    DATAENC dec = static_cast<DATAENC>(x * this->A_INV);
+                    return (dec >= dMin) & (dec <= dMax);
+                });
+            }
+        }
+
         bool DoArithmeticChecked(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -159,6 +193,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmeticChecked(
@@ -78,6 +78,36 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Scrub(config, [this] (DATAENC x) {
+                    return static_cast<DATAENC>(x * this->A_INV) <= dMax;
+                });
+            }
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+                this->Filter(config, iteration, [this] (DATAENC x) {
+                    return static_cast<DATAENC>(x * this->A_INV) <= dMax;
+                });
+            }
+        }
+
         bool DoArithmeticChecked(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -158,6 +188,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmeticChecked(
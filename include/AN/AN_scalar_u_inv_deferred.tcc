@@ -0,0 +1,202 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   AN_scalar_u_inv_deferred.tcc
+ *
+ * AN_scalar_u_inv with deferred verification of the checked arithmetic and aggregates: instead of each code word, only
+ * the sum of each block of code words is checked, see ANTest::getDeferredBlockValues.
+ */
+
+#pragma once
+
+#ifndef AN_SCALAR
+#error "Clients must not include this file directly, but file <AN/AN_scalar.hpp>!"
+#endif
+
+#include <AN/AN_scalar_u_inv.tcc>
+
+namespace coding_benchmark {
+
+    template<typename DATARAW, typename DATAENC, size_t UNROLL>
+    struct AN_scalar_u_inv_deferred :
+            public AN_scalar_u_inv<DATARAW, DATAENC, UNROLL> {
+
+        typedef AN_scalar_u_inv<DATARAW, DATAENC, UNROLL> BASE;
+
+        using BASE::AN_scalar_u_inv;
+
+        virtual ~AN_scalar_u_inv_deferred() {
+        }
+
+        /**
+         * Calls funcKernel for each of the numValues code words of source and checks the sum of each block of them
+         * afterwards. Throws an ErrorInfo pointing to the first value of the first block which fails.
+         */
+        template<typename Kernel>
+        void ForEachDeferred(
+                const AlignedBlock & source,
+                const size_t numValues,
+                const size_t iteration,
+                Kernel && funcKernel) {
+            typedef typename BASE::deferred_t deferred_t;
+            const constexpr deferred_t dMax = static_cast<deferred_t>(std::numeric_limits<DATARAW>::max());
+            const size_t blockValues = this->getDeferredBlockValues();
+            const deferred_t aInv = this->getDeferredAInv();
+            const auto dataBegin = source.template begin<DATAENC>();
+            auto dataIn = dataBegin;
+            const auto dataInEnd = dataBegin + numValues;
+            while (dataIn < dataInEnd) {
+                const auto dataBlock = dataIn;
+                const size_t numValuesBlock = std::min(blockValues, static_cast<size_t>(dataInEnd - dataIn));
+                const auto dataBlockEnd = dataBlock + numValuesBlock;
+                deferred_t blockSum = 0;
+                while (dataIn <= (dataBlockEnd - UNROLL)) { // let the compiler unroll the loop
+                    for (size_t k = 0; k < UNROLL; ++k) {
+                        blockSum += *dataIn;
+                        funcKernel(*dataIn++);
+                    }
+                }
+                while (dataIn < dataBlockEnd) {
+                    blockSum += *dataIn;
+                    funcKernel(*dataIn++);
+                }
+                if (static_cast<deferred_t>(blockSum * aInv) > (numValuesBlock * dMax)) {
+                    throw ErrorInfo(__FILE__, __LINE__, dataBlock - dataBegin, iteration, "block sum is not a code word");
+                }
+            }
+        }
+
+        struct ArithmetorDeferred {
+            AN_scalar_u_inv_deferred & test;
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            ArithmetorDeferred(
+                    AN_scalar_u_inv_deferred & test,
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<template<typename = void> class Functor>
+            void impl() {
+                Functor<> functor;
+                auto dataOut = config.target.template begin<DATAENC>();
+                DATAENC operand = config.operand;
+                if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>> || std::is_same_v<Functor<void>, div<void>>) {
+                    operand *= test.A;
+                } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                    // do not encode operand here, otherwise we will have non-code values after the operation!
+                } else {
+                    throw std::runtime_error("Functor not known!");
+                }
+                const DATAENC A = test.A;
+                test.ForEachDeferred(config.source, config.numValues, iteration, [&functor, &dataOut, operand, A] (DATAENC dataIn) {
+                    DATAENC x = functor(dataIn, operand);
+                    if constexpr (std::is_same_v<Functor<void>, div<void>>) {
+                        x *= A; // make sure we get a code word again
+                    }
+                    *dataOut++ = x;
+                });
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
+        };
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(ArithmetorDeferred(*this, config, iteration), config.mode);
+            }
+        }
+
+        struct AggregatorDeferred {
+            typedef typename Larger<DATAENC>::larger_t larger_t;
+            AN_scalar_u_inv_deferred & test;
+            const AggregateConfiguration & config;
+            const size_t iteration;
+            AggregatorDeferred(
+                    AN_scalar_u_inv_deferred & test,
+                    const AggregateConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<typename Aggregate, typename Initializer, typename Kernel, typename Finalizer>
+            void impl(
+                    Initializer && funcInit,
+                    Kernel && funcKernel,
+                    Finalizer && funcFinal) {
+                Aggregate value = funcInit();
+                test.ForEachDeferred(config.source, config.numValues, iteration, [&value, &funcKernel] (DATAENC dataIn) {
+                    value = funcKernel(value, dataIn);
+                });
+                auto final = funcFinal(value, config.numValues);
+                auto dataOut = test.bufScratchPad.template begin<Aggregate>();
+                *dataOut = final / test.A;
+                EncodeConfiguration encConf(1, 2, test.bufScratchPad, config.target);
+                test.RunEncode(encConf);
+            }
+            void operator()(
+                    AggregateConfiguration::Sum) {
+                impl<larger_t>([] {return (larger_t) 0;}, [] (larger_t sum, DATAENC dataIn) -> larger_t {return sum + dataIn;}, [] (larger_t sum, const size_t numValues) {return sum;});
+            }
+            void operator()(
+                    AggregateConfiguration::Min) {
+                impl<DATAENC>([] {return (DATAENC) std::numeric_limits<DATAENC>::max();}, [] (DATAENC minimum, DATAENC dataIn) -> DATAENC {return dataIn < minimum ? dataIn : minimum;},
+                        [] (DATAENC minimum, const size_t numValues) {return minimum;});
+            }
+            void operator()(
+                    AggregateConfiguration::Max) {
+                impl<DATAENC>([] {return (DATAENC) std::numeric_limits<DATAENC>::min();}, [] (DATAENC maximum, DATAENC dataIn) -> DATAENC {return dataIn > maximum ? dataIn : maximum;},
+                        [] (DATAENC maximum, const size_t numValues) {return maximum;});
+            }
+            void operator()(
+                    AggregateConfiguration::Avg) {
+                impl<larger_t>([] {return (larger_t) 0;}, [] (larger_t sum, DATAENC dataIn) -> larger_t {return sum + dataIn;},
+                        [this] (larger_t sum, const size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
+            }
+        };
+
+        void RunAggregateChecked(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(AggregatorDeferred(*this, config, iteration), config.mode);
+            }
+        }
+    };
+
+}
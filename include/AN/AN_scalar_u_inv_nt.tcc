@@ -0,0 +1,159 @@
+// Copyright (c) 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   AN_scalar_u_inv_nt.tcc
+ *
+ * AN_scalar_u_inv with scalar streaming stores (movnti), see SIMD/Stream.hpp.
+ */
+
+#pragma once
+
+#ifndef AN_SCALAR
+#error "Clients must not include this file directly, but file <AN/AN_scalar.hpp>!"
+#endif
+
+#include <climits>
+#include <type_traits>
+
+#include <AN/AN_scalar_u_inv.tcc>
+#include <SIMD/Stream.hpp>
+
+namespace coding_benchmark {
+
+    /**
+     * AN_scalar_u_inv, but encoding and decoding write their output with 32- or 64-bit streaming stores and prefetch their
+     * input PREFETCH bytes ahead (0: no prefetching). Decoded data narrower than 32 bits is packed into 32-bit words
+     * first. Targets which are not aligned to these words fall back to the regular kernels.
+     */
+    template<typename DATARAW, typename DATAENC, size_t UNROLL, size_t PREFETCH>
+    struct AN_scalar_u_inv_nt :
+            public AN_scalar_u_inv<DATARAW, DATAENC, UNROLL> {
+
+        typedef AN_scalar_u_inv<DATARAW, DATAENC, UNROLL> BASE;
+        typedef std::conditional_t<(sizeof(DATARAW) < sizeof(uint32_t)), uint32_t, DATARAW> stream_raw_t;
+
+        static_assert(sizeof(DATAENC) >= sizeof(uint32_t), "movnti stores 32- or 64-bit words only");
+
+        static const constexpr size_t NUM_RAW_PER_WORD = sizeof(stream_raw_t) / sizeof(DATARAW);
+
+        using BASE::AN_scalar_u_inv;
+
+        virtual ~AN_scalar_u_inv_nt() {
+        }
+
+        template<typename T>
+        static inline void Prefetch(
+                const T * in,
+                const size_t numValues) {
+            // one prefetch per cache line of the values read next
+            for (size_t ahead = 0; ahead < (numValues * sizeof(T)); ahead += 64) {
+                simd::prefetch_ahead<PREFETCH>(reinterpret_cast<const char*>(in) + ahead);
+            }
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            if (!simd::is_stream_aligned<DATAENC>(config.target.begin())) {
+                BASE::RunEncode(config);
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto dataIn = config.source.template begin<DATARAW>();
+                const auto dataInEnd = dataIn + config.numValues;
+                auto dataOut = config.target.template begin<DATAENC>();
+                while (dataIn <= (dataInEnd - UNROLL)) {
+                    Prefetch(dataIn, UNROLL);
+                    // let the compiler unroll the loop
+                    for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                        simd::mm_stream<DATAENC>::store(dataOut++, static_cast<DATAENC>(static_cast<DATAENC>(*dataIn++) * this->A));
+                    }
+                }
+                // remaining numbers
+                while (dataIn < dataInEnd) {
+                    simd::mm_stream<DATAENC>::store(dataOut++, static_cast<DATAENC>(static_cast<DATAENC>(*dataIn++) * this->A));
+                }
+                simd::stream_fence();
+            }
+        }
+
+        template<bool check>
+        void InternalDecode(
+                const DecodeConfiguration & config) {
+            if (!simd::is_stream_aligned<stream_raw_t>(config.target.begin())) {
+                if constexpr (check) {
+                    BASE::RunDecodeChecked(config);
+                } else {
+                    BASE::RunDecode(config);
+                }
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                const auto dataBegin = config.source.template begin<DATAENC>();
+                auto dataIn = dataBegin;
+                const auto dataInEnd = dataBegin + config.numValues;
+                auto dataOut = config.target.template begin<stream_raw_t>();
+                const constexpr DATAENC dMax = static_cast<DATAENC>(std::numeric_limits<DATARAW>::max());
+                auto decode = [this,dataBegin,iteration] (const DATAENC * in) {
+                    DATAENC dec = static_cast<DATAENC>(*in * this->A_INV);
+                    if (check && (dec > dMax)) {
+                        std::stringstream ss;
+                        ss << "A=" << this->A << ", A^-1=" << this->A_INV;
+                        throw ErrorInfo(__FILE__, __LINE__, in - dataBegin, iteration, ss.str().c_str());
+                    }
+                    return static_cast<DATARAW>(dec);
+                };
+                auto decodeWord = [&decode] (const DATAENC * in) {
+                    stream_raw_t word = 0;
+                    for (size_t k = 0; k < NUM_RAW_PER_WORD; ++k) {
+                        word |= static_cast<stream_raw_t>(decode(in + k)) << (k * sizeof(DATARAW) * CHAR_BIT);
+                    }
+                    return word;
+                };
+                while (dataIn <= (dataInEnd - UNROLL * NUM_RAW_PER_WORD)) {
+                    Prefetch(dataIn, UNROLL * NUM_RAW_PER_WORD);
+                    // let the compiler unroll the loop
+                    for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                        simd::mm_stream<stream_raw_t>::store(dataOut++, decodeWord(dataIn));
+                        dataIn += NUM_RAW_PER_WORD;
+                    }
+                }
+                // remaining words
+                while (dataIn <= (dataInEnd - NUM_RAW_PER_WORD)) {
+                    simd::mm_stream<stream_raw_t>::store(dataOut++, decodeWord(dataIn));
+                    dataIn += NUM_RAW_PER_WORD;
+                }
+                // remaining numbers which do not fill a word
+                auto dataOutS = reinterpret_cast<DATARAW*>(dataOut);
+                while (dataIn < dataInEnd) {
+                    *dataOutS++ = decode(dataIn++);
+                }
+                simd::stream_fence();
+            }
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            InternalDecode<false>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            InternalDecode<true>(config);
+        }
+    };
+
+}
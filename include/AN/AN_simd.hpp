@@ -28,6 +28,8 @@
 
 #include <AN/AN_simd_divmod.tcc>
 #include <AN/AN_simd_inv.tcc>
+#include <AN/AN_simd_nt.tcc>
+#include <AN/AN_simd_deferred.tcc>
 
 #undef AN_SIMD
 
@@ -431,6 +433,150 @@ namespace coding_benchmark {
     extern template
     struct AN_sse42_32_64_u_divmod<1024> ;
 
+    /**
+     * AN_sse42_16_32_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_sse42_16_32_u_inv_nt :
+            public AN_simd_inv_nt<uint16_t, uint32_t, __m128i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint16_t, uint32_t, __m128i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_sse42_16_32_u_inv_nt() {
+        }
+    };
+
+    /**
+     * AN_sse42_32_64_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_sse42_32_64_u_inv_nt :
+            public AN_simd_inv_nt<uint32_t, uint64_t, __m128i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint32_t, uint64_t, __m128i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_sse42_32_64_u_inv_nt() {
+        }
+    };
+
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<1> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<2> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<4> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<8> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<16> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<32> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<64> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<128> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<256> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<512> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_nt<1024> ;
+
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<1> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<2> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<4> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<8> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<16> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<32> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<64> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<128> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<256> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<512> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_nt<1024> ;
+
+    /**
+     * AN_sse42_16_32_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_sse42_16_32_u_inv_deferred :
+            public AN_simd_inv_deferred<uint16_t, uint32_t, __m128i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint16_t, uint32_t, __m128i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_sse42_16_32_u_inv_deferred() {
+        }
+    };
+
+    /**
+     * AN_sse42_32_64_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_sse42_32_64_u_inv_deferred :
+            public AN_simd_inv_deferred<uint32_t, uint64_t, __m128i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint32_t, uint64_t, __m128i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_sse42_32_64_u_inv_deferred() {
+        }
+    };
+
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<1> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<2> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<4> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<8> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<16> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<32> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<64> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<128> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<256> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<512> ;
+    extern template
+    struct AN_sse42_16_32_u_inv_deferred<1024> ;
+
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<1> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<2> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<4> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<8> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<16> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<32> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<64> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<128> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<256> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<512> ;
+    extern template
+    struct AN_sse42_32_64_u_inv_deferred<1024> ;
+
 #endif /* __SSE4_2__ */
 
 #ifdef __AVX2__
@@ -831,8 +977,696 @@ namespace coding_benchmark {
     extern template
     struct AN_avx2_32_64_u_divmod<1024> ;
 
+    /**
+     * AN_avx2_16_32_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_avx2_16_32_u_inv_nt :
+            public AN_simd_inv_nt<uint16_t, uint32_t, __m256i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint16_t, uint32_t, __m256i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_avx2_16_32_u_inv_nt() {
+        }
+    };
+
+    /**
+     * AN_avx2_32_64_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_avx2_32_64_u_inv_nt :
+            public AN_simd_inv_nt<uint32_t, uint64_t, __m256i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint32_t, uint64_t, __m256i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_avx2_32_64_u_inv_nt() {
+        }
+    };
+
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<1> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<2> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<4> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<8> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<16> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<32> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<64> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<128> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<256> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<512> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_nt<1024> ;
+
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<1> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<2> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<4> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<8> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<16> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<32> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<64> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<128> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<256> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<512> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_nt<1024> ;
+
+    /**
+     * AN_avx2_16_32_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_avx2_16_32_u_inv_deferred :
+            public AN_simd_inv_deferred<uint16_t, uint32_t, __m256i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint16_t, uint32_t, __m256i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_avx2_16_32_u_inv_deferred() {
+        }
+    };
+
+    /**
+     * AN_avx2_32_64_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_avx2_32_64_u_inv_deferred :
+            public AN_simd_inv_deferred<uint32_t, uint64_t, __m256i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint32_t, uint64_t, __m256i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_avx2_32_64_u_inv_deferred() {
+        }
+    };
+
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<1> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<2> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<4> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<8> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<16> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<32> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<64> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<128> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<256> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<512> ;
+    extern template
+    struct AN_avx2_16_32_u_inv_deferred<1024> ;
+
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<1> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<2> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<4> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<8> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<16> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<32> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<64> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<128> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<256> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<512> ;
+    extern template
+    struct AN_avx2_32_64_u_inv_deferred<1024> ;
+
 #endif /* __AVX2__ */
 
+#ifdef __AVX512F__
+
+    template<size_t UNROLL>
+    struct AN_avx512_8_16_s_inv :
+            public AN_simd_inv<int8_t, int16_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<int8_t, int16_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_8_16_s_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_8_16_u_inv :
+            public AN_simd_inv<uint8_t, uint16_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<uint8_t, uint16_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_8_16_u_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_s_inv :
+            public AN_simd_inv<int16_t, int32_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<int16_t, int32_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_16_32_s_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_u_inv :
+            public AN_simd_inv<uint16_t, uint32_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<uint16_t, uint32_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_16_32_u_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_s_inv :
+            public AN_simd_inv<int32_t, int64_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<int32_t, int64_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_32_64_s_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_u_inv :
+            public AN_simd_inv<uint32_t, uint64_t, __m512i, UNROLL> {
+
+        using AN_simd_inv<uint32_t, uint64_t, __m512i, UNROLL>::AN_simd_inv;
+
+        virtual ~AN_avx512_32_64_u_inv() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_8_16_s_divmod :
+            public AN_simd_divmod<int8_t, int16_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<int8_t, int16_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_8_16_s_divmod() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_8_16_u_divmod :
+            public AN_simd_divmod<uint8_t, uint16_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<uint8_t, uint16_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_8_16_u_divmod() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_s_divmod :
+            public AN_simd_divmod<int16_t, int32_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<int16_t, int32_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_16_32_s_divmod() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_u_divmod :
+            public AN_simd_divmod<uint16_t, uint32_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<uint16_t, uint32_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_16_32_u_divmod() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_s_divmod :
+            public AN_simd_divmod<int32_t, int64_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<int32_t, int64_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_32_64_s_divmod() {
+        }
+    };
+
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_u_divmod :
+            public AN_simd_divmod<uint32_t, uint64_t, __m512i, UNROLL> {
+
+        using AN_simd_divmod<uint32_t, uint64_t, __m512i, UNROLL>::AN_simd_divmod;
+
+        virtual ~AN_avx512_32_64_u_divmod() {
+        }
+    };
+
+    extern template
+    struct AN_avx512_8_16_s_inv<1> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<2> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<4> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<8> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<16> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<32> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<64> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<128> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<256> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<512> ;
+    extern template
+    struct AN_avx512_8_16_s_inv<1024> ;
+
+    extern template
+    struct AN_avx512_8_16_u_inv<1> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<2> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<4> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<8> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<16> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<32> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<64> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<128> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<256> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<512> ;
+    extern template
+    struct AN_avx512_8_16_u_inv<1024> ;
+
+    extern template
+    struct AN_avx512_16_32_s_inv<1> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<2> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<4> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<8> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<16> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<32> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<64> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<128> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<256> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<512> ;
+    extern template
+    struct AN_avx512_16_32_s_inv<1024> ;
+
+    extern template
+    struct AN_avx512_16_32_u_inv<1> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<2> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<4> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<8> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<16> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<32> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<64> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<128> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<256> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<512> ;
+    extern template
+    struct AN_avx512_16_32_u_inv<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_s_inv<1> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<2> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<4> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<8> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<16> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<32> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<64> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<128> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<256> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<512> ;
+    extern template
+    struct AN_avx512_32_64_s_inv<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_u_inv<1> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<2> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<4> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<8> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<16> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<32> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<64> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<128> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<256> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<512> ;
+    extern template
+    struct AN_avx512_32_64_u_inv<1024> ;
+
+    extern template
+    struct AN_avx512_8_16_s_divmod<1> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<2> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<4> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<8> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<16> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<32> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<64> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<128> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<256> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<512> ;
+    extern template
+    struct AN_avx512_8_16_s_divmod<1024> ;
+
+    extern template
+    struct AN_avx512_8_16_u_divmod<1> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<2> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<4> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<8> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<16> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<32> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<64> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<128> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<256> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<512> ;
+    extern template
+    struct AN_avx512_8_16_u_divmod<1024> ;
+
+    extern template
+    struct AN_avx512_16_32_s_divmod<1> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<2> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<4> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<8> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<16> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<32> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<64> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<128> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<256> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<512> ;
+    extern template
+    struct AN_avx512_16_32_s_divmod<1024> ;
+
+    extern template
+    struct AN_avx512_16_32_u_divmod<1> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<2> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<4> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<8> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<16> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<32> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<64> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<128> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<256> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<512> ;
+    extern template
+    struct AN_avx512_16_32_u_divmod<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_s_divmod<1> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<2> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<4> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<8> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<16> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<32> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<64> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<128> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<256> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<512> ;
+    extern template
+    struct AN_avx512_32_64_s_divmod<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_u_divmod<1> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<2> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<4> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<8> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<16> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<32> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<64> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<128> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<256> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<512> ;
+    extern template
+    struct AN_avx512_32_64_u_divmod<1024> ;
+
+    /**
+     * AN_avx512_16_32_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_u_inv_nt :
+            public AN_simd_inv_nt<uint16_t, uint32_t, __m512i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint16_t, uint32_t, __m512i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_avx512_16_32_u_inv_nt() {
+        }
+    };
+
+    /**
+     * AN_avx512_32_64_u_inv with streaming stores, see AN_simd_inv_nt.
+     */
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_u_inv_nt :
+            public AN_simd_inv_nt<uint32_t, uint64_t, __m512i, UNROLL, STREAM_PREFETCH> {
+
+        using AN_simd_inv_nt<uint32_t, uint64_t, __m512i, UNROLL, STREAM_PREFETCH>::AN_simd_inv_nt;
+
+        virtual ~AN_avx512_32_64_u_inv_nt() {
+        }
+    };
+
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<1> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<2> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<4> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<8> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<16> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<32> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<64> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<128> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<256> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<512> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_nt<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<1> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<2> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<4> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<8> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<16> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<32> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<64> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<128> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<256> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<512> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_nt<1024> ;
+
+    /**
+     * AN_avx512_16_32_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_avx512_16_32_u_inv_deferred :
+            public AN_simd_inv_deferred<uint16_t, uint32_t, __m512i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint16_t, uint32_t, __m512i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_avx512_16_32_u_inv_deferred() {
+        }
+    };
+
+    /**
+     * AN_avx512_32_64_u_inv with deferred verification, see AN_simd_inv_deferred.
+     */
+    template<size_t UNROLL>
+    struct AN_avx512_32_64_u_inv_deferred :
+            public AN_simd_inv_deferred<uint32_t, uint64_t, __m512i, UNROLL> {
+
+        using AN_simd_inv_deferred<uint32_t, uint64_t, __m512i, UNROLL>::AN_simd_inv_deferred;
+
+        virtual ~AN_avx512_32_64_u_inv_deferred() {
+        }
+    };
+
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<1> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<2> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<4> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<8> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<16> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<32> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<64> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<128> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<256> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<512> ;
+    extern template
+    struct AN_avx512_16_32_u_inv_deferred<1024> ;
+
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<1> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<2> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<4> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<8> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<16> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<32> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<64> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<128> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<256> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<512> ;
+    extern template
+    struct AN_avx512_32_64_u_inv_deferred<1024> ;
+
+#endif /* __AVX512F__ */
+
 }
 
 #endif /* defined(__SSE4_2__) or defined(__AVX2__) or defined(__AVX512F__) */
@@ -31,8 +31,10 @@
 #include <AN/ANTest.hpp>
 #include <Util/Functors.hpp>
 #include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
+#include <Util/Accumulators.hpp>
 #ifdef __SSE4_2__
 #include <SIMD/SSE.hpp>
 #endif
@@ -191,6 +193,73 @@ namespace coding_benchmark {
     }
 #endif /* __AVX2__ */
 
+#ifdef __AVX512F__
+    inline void writeout_8_16_512(
+            __m512i mmIn,
+            uint8_t* mmOut) {
+#ifdef __AVX512BW__
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mmOut), _mm512_cvtepi16_epi8(mmIn));
+#else
+        writeout_8_16_256(_mm512_extracti64x4_epi64(mmIn, 0), mmOut);
+        writeout_8_16_256(_mm512_extracti64x4_epi64(mmIn, 1), mmOut + 16);
+#endif
+    }
+
+    template<>
+    inline void writeout<uint8_t, uint16_t, __m512i >(
+            __m512i mmIn,
+            uint8_t* mmOut) {
+        writeout_8_16_512(mmIn, mmOut);
+    }
+
+    template<>
+    inline void writeout<int8_t, int16_t, __m512i >(
+            __m512i mmIn,
+            int8_t* mmOut) {
+        writeout_8_16_512(mmIn, reinterpret_cast<uint8_t*>(mmOut));
+    }
+
+    inline void writeout_16_32_512(
+            __m512i mmIn,
+            uint16_t* mmOut) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mmOut), _mm512_cvtepi32_epi16(mmIn));
+    }
+
+    template<>
+    inline void writeout<uint16_t, uint32_t, __m512i >(
+            __m512i mmIn,
+            uint16_t* mmOut) {
+        writeout_16_32_512(mmIn, mmOut);
+    }
+
+    template<>
+    inline void writeout<int16_t, int32_t, __m512i >(
+            __m512i mmIn,
+            int16_t* mmOut) {
+        writeout_16_32_512(mmIn, reinterpret_cast<uint16_t*>(mmOut));
+    }
+
+    inline void writeout_32_64_512(
+            __m512i mmIn,
+            uint32_t* mmOut) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mmOut), _mm512_cvtepi64_epi32(mmIn));
+    }
+
+    template<>
+    inline void writeout<uint32_t, uint64_t, __m512i >(
+            __m512i mmIn,
+            uint32_t* mmOut) {
+        writeout_32_64_512(mmIn, mmOut);
+    }
+
+    template<>
+    inline void writeout<int32_t, int64_t, __m512i >(
+            __m512i mmIn,
+            int32_t* mmOut) {
+        writeout_32_64_512(mmIn, reinterpret_cast<uint32_t*>(mmOut));
+    }
+#endif /* __AVX512F__ */
+
     template<typename DATARAW, typename DATAENC, typename VEC, size_t UNROLL>
     struct AN_simd :
             public ANTest<DATARAW, DATAENC, UNROLL>,
@@ -234,6 +303,107 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoFilter() override {
+            return true;
+        }
+
+        /**
+         * Compares the code words directly against the encoded predicates (see AN_scalar::Filter), producing one mask bit
+         * per lane. isValidV checks a whole vector of code words, isValidS a single one.
+         */
+        template<typename IsValidV, typename IsValidS>
+        void Filter(
+                const FilterConfiguration & config,
+                const size_t iteration,
+                IsValidV isValidV,
+                IsValidS isValidS) {
+            const auto range = FilterRange<DATARAW>(config).template transform<DATAENC>([this] (DATARAW x) {
+                return static_cast<DATAENC>(static_cast<DATAENC>(x) * this->A);
+            });
+            const FilterMatcher<VEC, DATAENC> matcher(range);
+            BitmapWriter bitmap(config.target);
+            auto inV = config.source.template begin<VEC>();
+            const auto inVend = this->template ComputeEnd<DATAENC>(inV, config);
+            while (inV <= (inVend - UNROLL)) {
+                // let the compiler unroll the loop
+                for (size_t k = 0; k < UNROLL; ++k) {
+                    auto mmIn = mm<VEC>::loadu(inV);
+                    if (isValidV(mmIn)) {
+                        bitmap.append(static_cast<uint64_t>(matcher.match(mmIn)), FilterMatcher<VEC, DATAENC>::NUM_VALUES_PER_VECTOR);
+                        ++inV;
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>(), iteration);
+                    }
+                }
+            }
+            // here follows the non-unrolled remainder
+            while (inV <= (inVend - 1)) {
+                auto mmIn = mm<VEC>::loadu(inV);
+                if (isValidV(mmIn)) {
+                    bitmap.append(static_cast<uint64_t>(matcher.match(mmIn)), FilterMatcher<VEC, DATAENC>::NUM_VALUES_PER_VECTOR);
+                    ++inV;
+                } else {
+                    throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>(), iteration);
+                }
+            }
+            if (inV < inVend) {
+                auto inS = reinterpret_cast<DATAENC*>(inV);
+                auto inSend = reinterpret_cast<DATAENC*>(inVend);
+                while (inS < inSend) {
+                    if (isValidS(*inS)) {
+                        bitmap.append(range.matches(*inS++));
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, inS - config.source.template begin<DATAENC>(), iteration);
+                    }
+                }
+            }
+            bitmap.flush();
+        }
+
+        /**
+         * Flags each value which is not a code word, see ScrubConfiguration. validLanesV returns the mask of the valid
+         * lanes of a vector, isValidS checks a single code word.
+         */
+        template<typename ValidLanesV, typename IsValidS>
+        void Scrub(
+                const ScrubConfiguration & config,
+                ValidLanesV validLanesV,
+                IsValidS isValidS) {
+            const constexpr size_t NUM_VALUES_PER_VECTOR = sizeof(VEC) / sizeof(DATAENC);
+            BitmapWriter bitmap(config.target);
+            auto inV = config.source.template begin<VEC>();
+            const auto inVend = this->template ComputeEnd<DATAENC>(inV, config);
+            while (inV <= (inVend - UNROLL)) {
+                // let the compiler unroll the loop
+                for (size_t k = 0; k < UNROLL; ++k) {
+                    bitmap.append(static_cast<uint64_t>(~validLanesV(mm<VEC>::loadu(inV++)) & mm<VEC, DATAENC>::FULL_MASK), NUM_VALUES_PER_VECTOR);
+                }
+            }
+            // here follows the non-unrolled remainder
+            while (inV <= (inVend - 1)) {
+                bitmap.append(static_cast<uint64_t>(~validLanesV(mm<VEC>::loadu(inV++)) & mm<VEC, DATAENC>::FULL_MASK), NUM_VALUES_PER_VECTOR);
+            }
+            if (inV < inVend) {
+                auto inS = reinterpret_cast<DATAENC*>(inV);
+                auto inSend = reinterpret_cast<DATAENC*>(inVend);
+                while (inS < inSend) {
+                    bitmap.append(!isValidS(*inS++));
+                }
+            }
+            bitmap.flush();
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                Filter(config, iteration, [] (VEC) {
+                    return true;
+                }, [] (DATAENC) {
+                    return true;
+                });
+            }
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -311,6 +481,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, false); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmetic(
@@ -326,6 +500,7 @@ namespace coding_benchmark {
             return std::visit(AggregateSelector(), config.mode);
         }
 
+        template<size_t K>
         struct Aggregator {
             typedef typename Larger<DATAENC>::larger_t larger_t;
             AN_simd & test;
@@ -336,25 +511,27 @@ namespace coding_benchmark {
                     : test(test),
                       config(config) {
             }
-            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
             void impl(
                     InitializeVector && funcInitVector,
                     KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
                     VectorToScalar && funcVectorToScalar,
                     KernelScalar && funcKernelScalar,
                     Finalize && funcFinal) {
+                const constexpr size_t STRIDE = Accumulators<VEC, K>::stride(UNROLL);
                 auto in128 = config.source.template begin<VEC>();
                 const auto in128end = test.template ComputeEnd<DATAENC>(in128, config);
-                auto mmResult = funcInitVector();
-                while (in128 <= (in128end - UNROLL)) {
-                    for (size_t k = 0; k < UNROLL; ++k) {
-                        mmResult = funcKernelVector(mmResult, *in128++);
+                Accumulators<VEC, K> mmResults(funcInitVector);
+                while (in128 <= (in128end - STRIDE)) {
+                    for (size_t k = 0; k < STRIDE; ++k) {
+                        mmResults[k % K] = funcKernelVector(mmResults[k % K], *in128++);
                     }
                 }
                 while (in128 <= (in128end - 1)) {
-                    mmResult = funcKernelVector(mmResult, *in128++);
+                    mmResults[0] = funcKernelVector(mmResults[0], *in128++);
                 }
-                Aggregate value = funcVectorToScalar(mmResult);
+                Aggregate value = funcVectorToScalar(mmResults.combine(funcCombineVector));
                 if (in128 < in128end) {
                     auto dataIn = reinterpret_cast<DATAENC*>(in128);
                     const auto dataInEnd = reinterpret_cast<DATAENC* const >(in128end);
@@ -372,30 +549,31 @@ namespace coding_benchmark {
                     AggregateConfiguration::Sum) {
                 impl<larger_t>([] {return simd::mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
             }
             void operator()(
                     AggregateConfiguration::Min) {
                 impl<DATAENC>([] {return simd::mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::max());}, [](VEC mmMin, VEC mmTmp) {return simd::mm<VEC, DATAENC>::min(mmMin, mmTmp);},
-                        [](VEC mmMin) {return simd::mm<VEC, DATAENC>::min(mmMin);}, [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
+                        [](VEC mmMin1, VEC mmMin2) {return simd::mm<VEC, DATAENC>::min(mmMin1, mmMin2);}, [](VEC mmMin) {return simd::mm<VEC, DATAENC>::min(mmMin);},
+                        [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
             }
             void operator()(
                     AggregateConfiguration::Max) {
                 impl<DATAENC>([] {return simd::mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::min());}, [](VEC mmMax, VEC mmTmp) {return simd::mm<VEC, DATAENC>::max(mmMax, mmTmp);},
-                        [](VEC mmMax) {return simd::mm<VEC, DATAENC>::max(mmMax);}, [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
+                        [](VEC mmMax1, VEC mmMax2) {return simd::mm<VEC, DATAENC>::max(mmMax1, mmMax2);}, [](VEC mmMax) {return simd::mm<VEC, DATAENC>::max(mmMax);},
+                        [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
             }
             void operator()(
                     AggregateConfiguration::Avg) {
                 impl<larger_t>([] {return simd::mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;},
-                        [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
             }
         };
 
@@ -403,7 +581,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(Aggregator(*this, config), config.mode);
+                std::visit(Aggregator<NUM_ACCUMULATORS>(*this, config), config.mode);
             }
         }
     };
@@ -0,0 +1,279 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   AN_simd_deferred.tcc
+ *
+ * AN_simd_inv with deferred verification of the checked arithmetic and aggregates, see ANTest::getDeferredBlockValues.
+ * Each 64-bit lane sums up its code words of a block, so that a block is checked with a single multiplication and
+ * comparison.
+ */
+
+#pragma once
+
+#ifndef AN_SIMD
+#error "Clients must not include this file directly, but file <AN/AN_simd.hpp>!"
+#endif
+
+#include <AN/AN_simd_inv.tcc>
+
+using namespace coding_benchmark::simd;
+
+namespace coding_benchmark {
+
+    template<typename DATARAW, typename DATAENC, typename VEC, size_t UNROLL>
+    struct AN_simd_inv_deferred :
+            public AN_simd_inv<DATARAW, DATAENC, VEC, UNROLL> {
+
+        typedef AN_simd_inv<DATARAW, DATAENC, VEC, UNROLL> BASE;
+        typedef mm<VEC, DATAENC> mmEnc;
+
+        static_assert(std::is_unsigned_v<DATARAW>, "Deferred verification is only implemented for unsigned data");
+
+        typedef typename BASE::deferred_t deferred_t;
+
+        static const constexpr size_t VALUES_PER_VECTOR = sizeof(VEC) / sizeof(DATAENC);
+        static const constexpr size_t VALUES_PER_LANE = sizeof(deferred_t) / sizeof(DATAENC); // code words summed up per lane of deferred_t
+
+        using BASE::AN_simd_inv;
+
+        virtual ~AN_simd_inv_deferred() {
+        }
+
+        /**
+         * Calls funcKernelVector(mmIn, k) for each full vector of source, where k is the vector's index within a stride
+         * of STRIDE vectors. The code words are summed up in lanes of deferred_t, so that a block of
+         * getDeferredBlockValues() values per lane spans that many vectors divided by VALUES_PER_LANE. Throws an
+         * ErrorInfo pointing to the first value of the first block which fails.
+         */
+        template<size_t STRIDE, typename KernelVector>
+        void ForEachVectorDeferred(
+                const AlignedBlock & source,
+                const size_t numValues,
+                const size_t iteration,
+                KernelVector && funcKernelVector) {
+            const constexpr deferred_t dMax = std::numeric_limits<DATARAW>::max();
+            const size_t blockVectors = std::max<size_t>(this->getDeferredBlockValues() / VALUES_PER_LANE, 1);
+            const VEC mmAInv = mm<VEC, deferred_t>::set1(this->getDeferredAInv());
+            const auto inV = source.template begin<VEC>();
+            const size_t numVectors = numValues / VALUES_PER_VECTOR;
+            size_t v = 0;
+            auto addBlockSum = [] (VEC mmBlockSum, VEC mmIn) {
+                if constexpr (VALUES_PER_LANE > 1) {
+                    auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmIn);
+                    auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmIn);
+                    return mm_op<VEC, deferred_t, add>::compute(mmBlockSum, mm_op<VEC, deferred_t, add>::compute(mmLo, mmHi));
+                } else {
+                    return mm_op<VEC, deferred_t, add>::compute(mmBlockSum, mmIn);
+                }
+            };
+            while (v < numVectors) {
+                const size_t vBlock = v;
+                const size_t numVectorsBlock = std::min(blockVectors, numVectors - v);
+                VEC mmBlockSum = mm<VEC>::setzero();
+                for (; (v + STRIDE) <= (vBlock + numVectorsBlock); v += STRIDE) {
+                    // let the compiler unroll the loop
+                    for (size_t k = 0; k < STRIDE; ++k) {
+                        auto mmIn = mm<VEC>::loadu(inV + v + k);
+                        mmBlockSum = addBlockSum(mmBlockSum, mmIn);
+                        funcKernelVector(mmIn, k);
+                    }
+                }
+                for (; v < (vBlock + numVectorsBlock); ++v) {
+                    auto mmIn = mm<VEC>::loadu(inV + v);
+                    mmBlockSum = addBlockSum(mmBlockSum, mmIn);
+                    funcKernelVector(mmIn, 0);
+                }
+                auto mmBlockSumDec = mm_op<VEC, deferred_t, mul>::compute(mmBlockSum, mmAInv);
+                auto mmBlockMax = mm<VEC, deferred_t>::set1(static_cast<deferred_t>(numVectorsBlock * VALUES_PER_LANE * dMax));
+                if (mm_op<VEC, deferred_t, std::less_equal>::cmp_mask(mmBlockSumDec, mmBlockMax) != mm<VEC, deferred_t>::FULL_MASK) {
+                    throw ErrorInfo(__FILE__, __LINE__, vBlock * VALUES_PER_VECTOR, iteration, "block sum is not a code word");
+                }
+            }
+        }
+
+        /**
+         * Calls funcKernelScalar for each of the values which do not fill a vector, and checks them as a block of their own.
+         */
+        template<typename KernelScalar>
+        void ForEachRemainingDeferred(
+                const AlignedBlock & source,
+                const size_t numValues,
+                const size_t iteration,
+                KernelScalar && funcKernelScalar) {
+            const constexpr deferred_t dMax = std::numeric_limits<DATARAW>::max();
+            const size_t posBlock = (numValues / VALUES_PER_VECTOR) * VALUES_PER_VECTOR;
+            auto inS = source.template begin<DATAENC>() + posBlock;
+            const auto inSend = source.template begin<DATAENC>() + numValues;
+            deferred_t blockSum = 0;
+            while (inS < inSend) {
+                blockSum += *inS;
+                funcKernelScalar(*inS++);
+            }
+            if (static_cast<deferred_t>(blockSum * this->getDeferredAInv()) > ((numValues - posBlock) * dMax)) {
+                throw ErrorInfo(__FILE__, __LINE__, posBlock, iteration, "block sum is not a code word");
+            }
+        }
+
+        struct ArithmetorDeferred {
+            AN_simd_inv_deferred & test;
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            ArithmetorDeferred(
+                    AN_simd_inv_deferred & test,
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<template<typename = void> class Functor>
+            void impl() {
+                auto outS = config.target.template begin<DATAENC>();
+                DATAENC operand = static_cast<DATAENC>(config.operand);
+                if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>> || std::is_same_v<Functor<void>, div<void>>) {
+                    operand = config.operand * test.A;
+                } else if constexpr (std::is_same_v<Functor<void>, mul<void>>) {
+                    // do not encode operand here, otherwise we will have non-code values after the operation!
+                } else {
+                    throw std::runtime_error("Functor not known!");
+                }
+                const DATAENC A = test.A;
+                const VEC mmOperand = mmEnc::set1(operand);
+                const VEC mmA = mmEnc::set1(A);
+                test.template ForEachVectorDeferred<UNROLL>(config.source, config.numValues, iteration, [&outS, mmOperand, mmA] (VEC mmIn, size_t) {
+                    auto x = mm_op<VEC, DATAENC, Functor>::compute(mmIn, mmOperand);
+                    if constexpr (std::is_same_v<Functor<void>, div<void>>) {
+                        x = mm_op<VEC, DATAENC, mul>::compute(x, mmA); // make sure we get a code word again
+                    }
+                    *reinterpret_cast<VEC*>(outS) = x;
+                    outS += VALUES_PER_VECTOR;
+                });
+                Functor<> functor;
+                test.ForEachRemainingDeferred(config.source, config.numValues, iteration, [&outS, &functor, operand, A] (DATAENC in) {
+                    auto x = functor(in, operand);
+                    if constexpr (std::is_same_v<Functor<void>, div<void>>) {
+                        x *= A; // make sure we get a code word again
+                    }
+                    *outS++ = x;
+                });
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
+        };
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(ArithmetorDeferred(*this, config, iteration), config.mode);
+            }
+        }
+
+        template<size_t K>
+        struct AggregatorDeferred {
+            typedef typename Larger<DATAENC>::larger_t larger_t;
+            AN_simd_inv_deferred & test;
+            const AggregateConfiguration & config;
+            size_t iteration;
+            AggregatorDeferred(
+                    AN_simd_inv_deferred & test,
+                    const AggregateConfiguration & config,
+                    size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            void impl(
+                    InitializeVector && funcInitVector,
+                    KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
+                    VectorToScalar && funcVectorToScalar,
+                    KernelScalar && funcKernelScalar,
+                    Finalize && funcFinal) {
+                Accumulators<VEC, K> mmValues(funcInitVector);
+                test.template ForEachVectorDeferred<Accumulators<VEC, K>::stride(UNROLL)>(config.source, config.numValues, iteration, [&mmValues, &funcKernelVector] (VEC mmIn, size_t k) {
+                    mmValues[k % K] = funcKernelVector(mmValues[k % K], mmIn);
+                });
+                Aggregate value = funcVectorToScalar(mmValues.combine(funcCombineVector));
+                test.ForEachRemainingDeferred(config.source, config.numValues, iteration, [&value, &funcKernelScalar] (DATAENC in) {
+                    value = funcKernelScalar(value, in);
+                });
+                auto final = funcFinal(value, config.numValues);
+                auto dataOut = test.bufScratchPad.template begin<Aggregate>();
+                *dataOut = final / test.A; // decode here, because we encode again in the next step. This is currently required!
+                EncodeConfiguration encConf(1, 2, test.bufScratchPad, config.target);
+                test.RunEncode(encConf);
+            }
+            void operator()(
+                    AggregateConfiguration::Sum) {
+                impl<larger_t>([] {return mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
+                    auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
+                    auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
+            }
+            void operator()(
+                    AggregateConfiguration::Min) {
+                impl<DATAENC>([] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::max());}, [](VEC mmMin, VEC mmTmp) {return mm<VEC, DATAENC>::min(mmMin, mmTmp);},
+                        [](VEC mmMin1, VEC mmMin2) {return mm<VEC, DATAENC>::min(mmMin1, mmMin2);}, [](VEC mmMin) {return mm<VEC, DATAENC>::min(mmMin);},
+                        [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
+            }
+            void operator()(
+                    AggregateConfiguration::Max) {
+                impl<DATAENC>([] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::min());}, [](VEC mmMax, VEC mmTmp) {return mm<VEC, DATAENC>::max(mmMax, mmTmp);},
+                        [](VEC mmMax1, VEC mmMax2) {return mm<VEC, DATAENC>::max(mmMax1, mmMax2);}, [](VEC mmMax) {return mm<VEC, DATAENC>::max(mmMax);},
+                        [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
+            }
+            void operator()(
+                    AggregateConfiguration::Avg) {
+                impl<larger_t>([] {return mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
+                    auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
+                    auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
+            }
+        };
+
+        void RunAggregateChecked(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(AggregatorDeferred<NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
+            }
+        }
+    };
+
+}
@@ -30,30 +30,61 @@
 
 namespace coding_benchmark {
 
-    template<typename T, typename VEC, size_t I, size_t MAX>
+    /**
+     * Vectorized divisibility test for odd A, which needs neither a division nor a per-lane modulo
+     * (cf. Granlund & Montgomery, "Division by Invariant Integers using Multiplication", 1994):
+     * with A_INV the multiplicative inverse of A modulo 2^n, x * A_INV equals x / A for all multiples of A,
+     * and each of them lies within [min / A, max / A]. Every other x is mapped outside of this range.
+     */
+    template<typename T, typename VEC>
     struct Detector {
-        static bool isValid(
-                VEC mmIn,
-                T A) {
-            return (mm<VEC, T>::template extract<I>(mmIn) % A == 0) && Detector<T, VEC, I + 1, MAX>::isValid(mmIn, A);
+        typedef mm<VEC, T> mmT;
+        typedef mm_op<VEC, T, std::less_equal> mmLE;
+        typedef mm_op<VEC, T, std::greater_equal> mmGE;
+
+        const T A;
+        const VEC mmAInv;
+        const VEC mmQMin;
+        const VEC mmQMax;
+
+        Detector(
+                T A,
+                T A_INV)
+                : A(A),
+                  mmAInv(mmT::set1(A_INV)),
+                  mmQMin(mmT::set1(std::numeric_limits<T>::min() / A)),
+                  mmQMax(mmT::set1(std::numeric_limits<T>::max() / A)) {
         }
-    };
 
-    template<typename T, typename VEC, size_t I>
-    struct Detector<T, VEC, I, I> {
-        static bool isValid(
-                VEC mmIn,
-                T A) {
-            return (mm<VEC, T>::template extract<I>(mmIn) % A == 0);
+        bool isValid(
+                VEC mmIn) const {
+            auto mmQ = mm_op<VEC, T, mul>::compute(mmIn, mmAInv);
+            return (mmLE::cmp_mask(mmQ, mmQMax) == mmT::FULL_MASK) & (std::is_unsigned_v<T> || (mmGE::cmp_mask(mmQ, mmQMin) == mmT::FULL_MASK));
         }
-    };
 
-    template<typename T, typename VEC>
-    bool isValid(
-            VEC mmIn,
-            T A) {
-        return Detector<T, VEC, 0, (sizeof(VEC) / sizeof(T) - 1)>::isValid(mmIn, A);
-    }
+        typename mmT::mask_t validLanes(
+                VEC mmIn) const {
+            auto mmQ = mm_op<VEC, T, mul>::compute(mmIn, mmAInv);
+            if constexpr (std::is_unsigned_v<T>) {
+                return mmLE::cmp_mask(mmQ, mmQMax);
+            } else {
+                return mmLE::cmp_mask(mmQ, mmQMax) & mmGE::cmp_mask(mmQ, mmQMin);
+            }
+        }
+
+        /**
+         * Only called after isValid failed: returns the index of the first lane which is not a code word.
+         */
+        size_t firstInvalid(
+                const VEC * inV) const {
+            auto inS = reinterpret_cast<const T*>(inV);
+            size_t i = 0;
+            while ((i < (sizeof(VEC) / sizeof(T) - 1)) && ((inS[i] % A) == 0)) {
+                ++i;
+            }
+            return i;
+        }
+    };
 
     template<typename DATARAW, typename DATAENC, typename VEC, size_t UNROLL>
     struct AN_simd_divmod :
@@ -72,6 +103,7 @@ namespace coding_benchmark {
 
         virtual void RunCheck(
                 const CheckConfiguration & config) override {
+            const Detector<DATAENC, VEC> detector(this->A, this->A_INV);
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 auto inV = config.target.template begin<VEC>();
                 const auto inVend = this->template ComputeEnd<DATAENC>(inV, config);
@@ -79,20 +111,20 @@ namespace coding_benchmark {
                     // let the compiler unroll the loop
                     for (size_t k = 0; k < UNROLL; ++k) {
                         auto mmIn = *inV;
-                        if (isValid<DATAENC, VEC>(mmIn, this->A)) {
+                        if (detector.isValid(mmIn)) {
                             ++inV;
                         } else {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.target.template begin<DATAENC>(), iteration);
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.target.template begin<DATAENC>() + detector.firstInvalid(inV), iteration);
                         }
                     }
                 }
                 // here follows the non-unrolled remainder
                 while (inV <= (inVend - 1)) {
                     auto mmIn = *inV;
-                    if (isValid<DATAENC, VEC>(mmIn, this->A)) {
+                    if (detector.isValid(mmIn)) {
                         ++inV;
                     } else {
-                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.target.template begin<DATAENC>(), iteration);
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.target.template begin<DATAENC>() + detector.firstInvalid(inV), iteration);
                     }
                 }
                 if (inV < inVend) {
@@ -109,6 +141,39 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            const Detector<DATAENC, VEC> detector(this->A, this->A_INV);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Scrub(config, [&detector] (VEC mmIn) {
+                    return detector.validLanes(mmIn);
+                }, [this] (DATAENC x) {
+                    return (x % this->A) == 0;
+                });
+            }
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            const Detector<DATAENC, VEC> detector(this->A, this->A_INV);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                this->Filter(config, iteration, [&detector] (VEC mmIn) {
+                    return detector.isValid(mmIn);
+                }, [this] (DATAENC x) {
+                    return (x % this->A) == 0;
+                });
+            }
+        }
+
         bool DoArithmeticChecked(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -130,6 +195,7 @@ namespace coding_benchmark {
             void impl() {
                 auto inV = config.source.template begin<VEC>();
                 const auto inVend = test.template ComputeEnd<DATAENC>(inV, config);
+                const Detector<DATAENC, VEC> detector(test.A, test.A_INV);
                 auto outV = config.target.template begin<VEC>();
                 DATAENC operand = config.operand;
                 if constexpr (std::is_same_v<Functor<void>, add<void>> || std::is_same_v<Functor<void>, sub<void>> || std::is_same_v<Functor<void>, div<void>>) {
@@ -145,28 +211,28 @@ namespace coding_benchmark {
                     // let the compiler unroll the loop
                     for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
                         auto mmIn = *inV++;
-                        if (isValid(mmIn, test.A)) {
+                        if (detector.isValid(mmIn)) {
                             auto x = mm_op<VEC, DATAENC, Functor>::compute(mmIn, mmOperand);
                             if (std::is_same_v<Functor<void>, div<void>>) {
                                 x = mm_op<VEC, DATAENC, mul>::compute(x, mmA); // make sure we get a code word again
                             }
                             *outV++ = x;
                         } else {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV - 1), iteration);
                         }
                     }
                 }
                 // remaining numbers
                 while (inV <= (inVend - 1)) {
                     auto mmIn = *inV++;
-                    if (isValid(mmIn, test.A)) {
+                    if (detector.isValid(mmIn)) {
                         auto x = mm_op<VEC, DATAENC, Functor>::compute(mmIn, mmOperand);
                         if (std::is_same_v<Functor<void>, div<void>>) {
                             x = mm_op<VEC, DATAENC, mul>::compute(x, mmA); // make sure we get a code word again
                         }
                         *outV++ = x;
                     } else {
-                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV - 1), iteration);
                     }
                 }
                 if (inV < inVend) {
@@ -203,6 +269,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmeticChecked(
@@ -218,6 +288,7 @@ namespace coding_benchmark {
             return std::visit(AggregateSelector(), config.mode);
         }
 
+        template<size_t K>
         struct AggregatorChecked {
             typedef typename Larger<DATAENC>::larger_t larger_t;
             AN_simd_divmod & test;
@@ -231,35 +302,44 @@ namespace coding_benchmark {
                       config(config),
                       iteration(iteration) {
             }
-            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
             void impl(
                     InitializeVector && funcInitVector,
                     KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
                     VectorToScalar && funcVectorToScalar,
                     KernelScalar && funcKernelScalar,
                     Finalize && funcFinal) {
+                const constexpr size_t STRIDE = Accumulators<VEC, K>::stride(UNROLL);
                 auto inV = config.source.template begin<VEC>();
                 const auto inVend = test.template ComputeEnd<DATAENC>(inV, config);
-                auto mmValue = funcInitVector();
-                while (inV <= (inVend - UNROLL)) {
-                    for (size_t k = 0; k < UNROLL; ++k) {
-                        auto mmIn = *inV++;
-                        if (isValid(mmIn, test.A)) {
-                            mmValue = funcKernelVector(mmValue, mmIn);
-                        } else {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
+                const Detector<DATAENC, VEC> detector(test.A, test.A_INV);
+                Accumulators<VEC, K> mmValues(funcInitVector);
+                while (inV <= (inVend - STRIDE)) {
+                    // one test for the whole stride, the accumulators are dropped anyways when it fails
+                    auto mask = mm<VEC, DATAENC>::FULL_MASK;
+                    for (size_t k = 0; k < STRIDE; ++k) {
+                        auto mmIn = inV[k];
+                        mask &= detector.validLanes(mmIn);
+                        mmValues[k % K] = funcKernelVector(mmValues[k % K], mmIn);
+                    }
+                    if (mask != mm<VEC, DATAENC>::FULL_MASK) {
+                        while (detector.isValid(*inV)) {
+                            ++inV;
                         }
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV), iteration);
                     }
+                    inV += STRIDE;
                 }
                 while (inV <= (inVend - 1)) {
                     auto mmIn = *inV++;
-                    if (isValid(mmIn, test.A)) {
-                        mmValue = funcKernelVector(mmValue, mmIn);
+                    if (detector.isValid(mmIn)) {
+                        mmValues[0] = funcKernelVector(mmValues[0], mmIn);
                     } else {
-                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV - 1), iteration);
                     }
                 }
-                Aggregate value = funcVectorToScalar(mmValue);
+                Aggregate value = funcVectorToScalar(mmValues.combine(funcCombineVector));
                 if (inV < inVend) {
                     auto inS = reinterpret_cast<DATAENC*>(inV);
                     const auto inSend = reinterpret_cast<DATAENC* const >(inVend);
@@ -281,29 +361,31 @@ namespace coding_benchmark {
                     AggregateConfiguration::Sum) {
                 impl<larger_t>([] {return simd::mm<VEC, larger_t>::set1(0);}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
             }
             void operator()(
                     AggregateConfiguration::Min) {
                 impl<DATAENC>([] {return simd::mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::max());}, [](VEC mmMin, VEC mmTmp) {return simd::mm<VEC, DATAENC>::min(mmMin, mmTmp);},
-                        [](VEC mmMin) {return simd::mm<VEC, DATAENC>::min(mmMin);}, [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
+                        [](VEC mmMin1, VEC mmMin2) {return simd::mm<VEC, DATAENC>::min(mmMin1, mmMin2);}, [](VEC mmMin) {return simd::mm<VEC, DATAENC>::min(mmMin);},
+                        [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
             }
             void operator()(
                     AggregateConfiguration::Max) {
                 impl<DATAENC>([] {return simd::mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::min());}, [](VEC mmMax, VEC mmTmp) {return simd::mm<VEC, DATAENC>::max(mmMax, mmTmp);},
-                        [](VEC mmMax) {return simd::mm<VEC, DATAENC>::max(mmMax);}, [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
+                        [](VEC mmMax1, VEC mmMax2) {return simd::mm<VEC, DATAENC>::max(mmMax1, mmMax2);}, [](VEC mmMax) {return simd::mm<VEC, DATAENC>::max(mmMax);},
+                        [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
             }
             void operator()(
                     AggregateConfiguration::Avg) {
                 impl<larger_t>([] {return simd::mm<VEC, larger_t>::set1(0);}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;},
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return simd::mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;},
                         [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
             }
         };
@@ -312,7 +394,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(AggregatorChecked(*this, config, iteration), config.mode);
+                std::visit(AggregatorChecked<NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -324,26 +406,27 @@ namespace coding_benchmark {
                 auto inVend = this->template ComputeEnd<DATAENC>(inV, config);
                 auto outS = config.target.template begin<DATARAW>();
                 auto mmA = mm<VEC, DATAENC>::set1(static_cast<DATAENC>(this->A));
+                const Detector<DATAENC, VEC> detector(this->A, this->A_INV);
                 while (inV <= (inVend - UNROLL)) { // let the compiler unroll the loop
                     for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
-                        if ((!check) || isValid(*inV, this->A)) {
+                        if ((!check) || detector.isValid(*inV)) {
                             VEC dec = mm_op<VEC, DATAENC, div>::compute(*inV, mmA);
                             writeout<DATARAW, DATAENC, VEC>(dec, outS);
                             outS += (sizeof(VEC) / sizeof(DATAENC));
                         } else if (check) {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>(), iteration);
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV), iteration);
                         }
                         ++inV;
                     }
                 }
                 // remaining numbers
                 while (inV <= (inVend - 1)) {
-                    if ((!check) || isValid(*inV, this->A)) {
+                    if ((!check) || detector.isValid(*inV)) {
                         VEC dec = mm_op<VEC, DATAENC, div>::compute(*inV, mmA);
                         writeout<DATARAW, DATAENC, VEC>(dec, outS);
                         outS += (sizeof(VEC) / sizeof(DATAENC));
                     } else if (check) {
-                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>(), iteration);
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>() + detector.firstInvalid(inV), iteration);
                     }
                     ++inV;
                 }
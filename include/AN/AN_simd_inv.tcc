@@ -90,7 +90,7 @@ namespace coding_benchmark {
                     auto inS = reinterpret_cast<DATAENC*>(inV);
                     const auto in32end = reinterpret_cast<DATAENC* const >(inVend);
                     while (inS < in32end) {
-                        auto dec = *inS++ * this->A_INV;
+                        DATAENC dec = static_cast<DATAENC>(*inS++ * this->A_INV);
                         if ((!check) || ((dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin)))) {
                             if constexpr (materialize) {
                                 *outS++ = dec;
@@ -112,6 +112,56 @@ namespace coding_benchmark {
             InternalCoder<true, false>(config);
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            const constexpr DATAENC dMin = std::numeric_limits<DATARAW>::min();
+            const constexpr DATAENC dMax = std::numeric_limits<DATARAW>::max();
+            const VEC mmDMin = mm<VEC, DATAENC>::set1(dMin);
+            const VEC mmDMax = mm<VEC, DATAENC>::set1(dMax);
+            const VEC mmAInv = mm<VEC, DATAENC>::set1(this->A_INV);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Scrub(config, [&mmDMin,&mmDMax,&mmAInv] (VEC mmIn) -> typename mmEnc::mask_t {
+                    auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mmIn, mmAInv);
+                    if constexpr (std::is_unsigned_v<DATARAW>) {
+                        return mmEncLE::cmp_mask(mmInDec, mmDMax);
+                    } else {
+                        return mmEncLE::cmp_mask(mmInDec, mmDMax) & mmEncGE::cmp_mask(mmInDec, mmDMin);
+                    }
+                }, [this] (DATAENC x) {
+                    DATAENC dec = static_cast<DATAENC>(x * this->A_INV);
+                    return (dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin));
+                });
+            }
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            const constexpr DATAENC dMin = std::numeric_limits<DATARAW>::min();
+            const constexpr DATAENC dMax = std::numeric_limits<DATARAW>::max();
+            const VEC mmDMin = mm<VEC, DATAENC>::set1(dMin);
+            const VEC mmDMax = mm<VEC, DATAENC>::set1(dMax);
+            const VEC mmAInv = mm<VEC, DATAENC>::set1(this->A_INV);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->Filter(config, iteration, [&mmDMin,&mmDMax,&mmAInv] (VEC mmIn) {
+                    auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mmIn, mmAInv);
+                    return (mmEncLE::cmp_mask(mmInDec, mmDMax) == mmEnc::FULL_MASK) & (std::is_unsigned_v<DATARAW> || (mmEncGE::cmp_mask(mmInDec, mmDMin) == mmEnc::FULL_MASK));
+                }, [this] (DATAENC x) {
+                    DATAENC dec = static_cast<DATAENC>(x * this->A_INV);
+                    return (dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin));
+                });
+            }
+        }
+
         bool DoArithmeticChecked(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -185,7 +235,7 @@ namespace coding_benchmark {
                     const auto inSend = reinterpret_cast<DATAENC* const >(inVend);
                     auto outS = reinterpret_cast<DATAENC*>(outV);
                     while (inS < inSend) {
-                        auto dec = *inS * test.A_INV;
+                        DATAENC dec = static_cast<DATAENC>(*inS * test.A_INV);
                         if ((dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin))) {
                             auto x = functor(*inS++, operand);
                             if (std::is_same_v<Functor<void>, div<void>>) {
@@ -214,6 +264,10 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::Bitwise) {
+                test.RunArithmeticReencode(config, true); // AN codes are not closed under the bitwise operators
+            }
         };
 
         void RunArithmeticChecked(
@@ -229,6 +283,7 @@ namespace coding_benchmark {
             return std::visit(AggregateSelector(), config.mode);
         }
 
+        template<size_t K>
         struct AggregatorChecked {
             typedef typename Larger<DATAENC>::larger_t larger_t;
             AN_simd_inv & test;
@@ -242,13 +297,15 @@ namespace coding_benchmark {
                       config(config),
                       iteration(iteration) {
             }
-            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
             void impl(
                     InitializeVector && funcInitVector,
                     KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
                     VectorToScalar && funcVectorToScalar,
                     KernelScalar && funcKernelScalar,
                     Finalize && funcFinal) {
+                const constexpr size_t STRIDE = Accumulators<VEC, K>::stride(UNROLL);
                 auto inV = config.source.template begin<VEC>();
                 const auto inVend = test.template ComputeEnd<DATAENC>(inV, config);
                 const constexpr DATAENC __attribute__((unused)) dMin = std::numeric_limits<DATARAW>::min();
@@ -256,33 +313,45 @@ namespace coding_benchmark {
                 VEC __attribute__((unused)) mmDMin = mm<VEC, DATAENC>::set1(dMin);
                 VEC mmDMax = mm<VEC, DATAENC>::set1(dMax);
                 VEC mmAInv = mm<VEC, DATAENC>::set1(test.A_INV);
-                auto mmValue = funcInitVector();
-                while (inV <= (inVend - UNROLL)) {
-                    for (size_t k = 0; k < UNROLL; ++k) {
-                        auto mmIn = mm<VEC>::loadu(inV++);
-                        auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mmIn, mmAInv);
-                        if ((mmEncLE::cmp_mask(mmInDec, mmDMax) == mmEnc::FULL_MASK) & (std::is_unsigned_v<DATARAW> || (mmEncGE::cmp_mask(mmInDec, mmDMin) == mmEnc::FULL_MASK))) {
-                            mmValue = funcKernelVector(mmValue, mmIn);
-                        } else {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
+                auto validLanes = [mmDMin, mmDMax, mmAInv] (VEC mmIn) {
+                    auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mmIn, mmAInv);
+                    if constexpr (std::is_unsigned_v<DATARAW>) {
+                        return mmEncLE::cmp_mask(mmInDec, mmDMax);
+                    } else {
+                        return static_cast<typename mmEnc::mask_t>(mmEncLE::cmp_mask(mmInDec, mmDMax) & mmEncGE::cmp_mask(mmInDec, mmDMin));
+                    }
+                };
+                Accumulators<VEC, K> mmValues(funcInitVector);
+                while (inV <= (inVend - STRIDE)) {
+                    // one test for the whole stride, the accumulators are dropped anyways when it fails
+                    typename mmEnc::mask_t mask = mmEnc::FULL_MASK;
+                    for (size_t k = 0; k < STRIDE; ++k) {
+                        auto mmIn = mm<VEC>::loadu(inV + k);
+                        mask &= validLanes(mmIn);
+                        mmValues[k % K] = funcKernelVector(mmValues[k % K], mmIn);
+                    }
+                    if (mask != mmEnc::FULL_MASK) {
+                        while (validLanes(mm<VEC>::loadu(inV)) == mmEnc::FULL_MASK) {
+                            ++inV;
                         }
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV) - config.source.template begin<DATAENC>(), iteration);
                     }
+                    inV += STRIDE;
                 }
                 while (inV <= (inVend - 1)) {
                     auto mmIn = mm<VEC>::loadu(inV++);
-                    auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mmIn, mmAInv);
-                    if ((mmEncLE::cmp_mask(mmInDec, mmDMax) == mmEnc::FULL_MASK) & (std::is_unsigned_v<DATARAW> || (mmEncGE::cmp_mask(mmInDec, mmDMin) == mmEnc::FULL_MASK))) {
-                        mmValue = funcKernelVector(mmValue, mmIn);
+                    if (validLanes(mmIn) == mmEnc::FULL_MASK) {
+                        mmValues[0] = funcKernelVector(mmValues[0], mmIn);
                     } else {
                         throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(inV - 1) - config.source.template begin<DATAENC>(), iteration);
                     }
                 }
-                Aggregate value = funcVectorToScalar(mmValue);
+                Aggregate value = funcVectorToScalar(mmValues.combine(funcCombineVector));
                 if (inV < inVend) {
                     auto inS = reinterpret_cast<DATAENC*>(inV);
                     const auto inSend = reinterpret_cast<DATAENC* const >(inVend);
                     while (inS < inSend) {
-                        auto dec = *inS * test.A_INV;
+                        DATAENC dec = static_cast<DATAENC>(*inS * test.A_INV);
                         if ((dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin))) {
                             value = funcKernelScalar(value, *inS++);
                         } else {
@@ -300,30 +369,31 @@ namespace coding_benchmark {
                     AggregateConfiguration::Sum) {
                 impl<larger_t>([] {return mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
             }
             void operator()(
                     AggregateConfiguration::Min) {
                 impl<DATAENC>([] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::max());}, [](VEC mmMin, VEC mmTmp) {return mm<VEC, DATAENC>::min(mmMin, mmTmp);},
-                        [](VEC mmMin) {return mm<VEC, DATAENC>::min(mmMin);}, [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
+                        [](VEC mmMin1, VEC mmMin2) {return mm<VEC, DATAENC>::min(mmMin1, mmMin2);}, [](VEC mmMin) {return mm<VEC, DATAENC>::min(mmMin);},
+                        [](DATAENC min, DATAENC tmp) {return min < tmp ? min : tmp;}, [](DATAENC min, size_t numValues) {return min;});
             }
             void operator()(
                     AggregateConfiguration::Max) {
                 impl<DATAENC>([] {return mm<VEC, DATAENC>::set1(std::numeric_limits<DATAENC>::min());}, [](VEC mmMax, VEC mmTmp) {return mm<VEC, DATAENC>::max(mmMax, mmTmp);},
-                        [](VEC mmMax) {return mm<VEC, DATAENC>::max(mmMax);}, [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
+                        [](VEC mmMax1, VEC mmMax2) {return mm<VEC, DATAENC>::max(mmMax1, mmMax2);}, [](VEC mmMax) {return mm<VEC, DATAENC>::max(mmMax);},
+                        [](DATAENC max, DATAENC tmp) {return max > tmp ? max : tmp;}, [](DATAENC max, size_t numValues) {return max;});
             }
             void operator()(
                     AggregateConfiguration::Avg) {
                 impl<larger_t>([] {return mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = mm<VEC, DATAENC>::cvt_larger_lo(mmTmp);
-                    mmLo = mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = mm<VEC, DATAENC>::cvt_larger_hi(mmTmp);
-                    return mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [](larger_t sum, DATAENC tmp) {return sum + tmp;},
-                        [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);},
+                        [](larger_t sum, DATAENC tmp) {return sum + tmp;}, [this](larger_t sum, size_t numValues) {return (sum / (numValues * test.A)) * test.A;});
             }
         };
 
@@ -331,7 +401,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(AggregatorChecked(*this, config, iteration), config.mode);
+                std::visit(AggregatorChecked<NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -0,0 +1,236 @@
+// Copyright (c) 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   AN_simd_nt.tcc
+ *
+ * Streaming-store variants of the AN SIMD kernels, see SIMD/Stream.hpp.
+ */
+
+#pragma once
+
+#ifndef AN_SIMD
+#error "Clients must not include this file directly, but file <AN/AN_simd.hpp>!"
+#endif
+
+#include <AN/AN_simd_inv.tcc>
+#include <SIMD/Stream.hpp>
+
+using namespace coding_benchmark::simd;
+
+namespace coding_benchmark {
+
+    /**
+     * Truncates the lanes of two vectors to RAWSIZE bytes, i.e. to half their width, and returns them as a single
+     * vector: first the lanes of lo, then those of hi. In contrast to writeout, this allows full-vector (streaming) stores.
+     */
+    template<size_t RAWSIZE, typename VEC>
+    struct mm_narrow;
+
+#ifdef __SSE4_2__
+    template<>
+    struct mm_narrow<2, __m128i> {
+        static inline __m128i compute(
+                __m128i lo,
+                __m128i hi) {
+            const __m128i mmShuffle = _mm_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0D0C090805040100);
+            return _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, mmShuffle), _mm_shuffle_epi8(hi, mmShuffle));
+        }
+    };
+
+    template<>
+    struct mm_narrow<4, __m128i> {
+        static inline __m128i compute(
+                __m128i lo,
+                __m128i hi) {
+            const __m128i mmShuffle = _mm_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0B0A090803020100);
+            return _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, mmShuffle), _mm_shuffle_epi8(hi, mmShuffle));
+        }
+    };
+#endif /* __SSE4_2__ */
+
+#ifdef __AVX2__
+    template<>
+    struct mm_narrow<2, __m256i> {
+        static inline __m256i compute(
+                __m256i lo,
+                __m256i hi) {
+            const __m256i mmShuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0D0C090805040100, 0xFFFFFFFFFFFFFFFF, 0x0D0C090805040100);
+            // the shuffles narrow within each 128-bit lane, the permutation puts the four resulting quad words in order
+            return _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(_mm256_shuffle_epi8(lo, mmShuffle), _mm256_shuffle_epi8(hi, mmShuffle)), 0xD8);
+        }
+    };
+
+    template<>
+    struct mm_narrow<4, __m256i> {
+        static inline __m256i compute(
+                __m256i lo,
+                __m256i hi) {
+            const __m256i mmShuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0B0A090803020100, 0xFFFFFFFFFFFFFFFF, 0x0B0A090803020100);
+            return _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(_mm256_shuffle_epi8(lo, mmShuffle), _mm256_shuffle_epi8(hi, mmShuffle)), 0xD8);
+        }
+    };
+#endif /* __AVX2__ */
+
+#ifdef __AVX512F__
+    template<>
+    struct mm_narrow<2, __m512i> {
+        static inline __m512i compute(
+                __m512i lo,
+                __m512i hi) {
+            return _mm512_inserti64x4(_mm512_zextsi256_si512(_mm512_cvtepi32_epi16(lo)), _mm512_cvtepi32_epi16(hi), 1);
+        }
+    };
+
+    template<>
+    struct mm_narrow<4, __m512i> {
+        static inline __m512i compute(
+                __m512i lo,
+                __m512i hi) {
+            return _mm512_inserti64x4(_mm512_zextsi256_si512(_mm512_cvtepi64_epi32(lo)), _mm512_cvtepi64_epi32(hi), 1);
+        }
+    };
+#endif /* __AVX512F__ */
+
+    /**
+     * AN_simd_inv, but encoding and decoding write their output with streaming stores and prefetch their input PREFETCH
+     * bytes ahead (0: no prefetching). Targets which are not aligned to a vector fall back to the regular kernels.
+     */
+    template<typename DATARAW, typename DATAENC, typename VEC, size_t UNROLL, size_t PREFETCH>
+    struct AN_simd_inv_nt :
+            public AN_simd_inv<DATARAW, DATAENC, VEC, UNROLL> {
+
+        typedef AN_simd_inv<DATARAW, DATAENC, VEC, UNROLL> BASE;
+
+        using BASE::AN_simd_inv;
+
+        virtual ~AN_simd_inv_nt() {
+        }
+
+        static inline void Prefetch(
+                const VEC * in) {
+            // one prefetch per cache line of the UNROLL vectors read next
+            for (size_t ahead = 0; ahead < (UNROLL * sizeof(VEC)); ahead += 64) {
+                prefetch_ahead<PREFETCH>(reinterpret_cast<const char*>(in) + ahead);
+            }
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            if (!is_stream_aligned<VEC>(config.target.begin())) {
+                BASE::RunEncode(config);
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                auto *inV = config.source.template begin<VEC>();
+                auto * const inVend = this->template ComputeEnd<DATARAW>(inV, config);
+                auto *outV = config.target.template begin<VEC>();
+                auto mmA = mm<VEC, DATAENC>::set1(this->A);
+
+                while (inV <= (inVend - UNROLL)) {
+                    Prefetch(inV);
+                    // let the compiler unroll the loop
+                    for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                        auto mmIn = mm<VEC>::loadu(inV++);
+                        mm_stream<VEC>::store(outV++, mm_op<VEC, DATAENC, mul>::compute(mm<VEC, DATARAW>::cvt_larger_lo(mmIn), mmA));
+                        mm_stream<VEC>::store(outV++, mm_op<VEC, DATAENC, mul>::compute(mm<VEC, DATARAW>::cvt_larger_hi(mmIn), mmA));
+                    }
+                }
+                // remaining numbers
+                while (inV <= (inVend - 1)) {
+                    auto mmIn = mm<VEC>::loadu(inV++);
+                    mm_stream<VEC>::store(outV++, mm_op<VEC, DATAENC, mul>::compute(mm<VEC, DATARAW>::cvt_larger_lo(mmIn), mmA));
+                    mm_stream<VEC>::store(outV++, mm_op<VEC, DATAENC, mul>::compute(mm<VEC, DATARAW>::cvt_larger_hi(mmIn), mmA));
+                }
+                if (inV < inVend) {
+                    auto inS = reinterpret_cast<DATARAW*>(inV);
+                    auto inSend = reinterpret_cast<DATARAW*>(inVend);
+                    auto outS = reinterpret_cast<DATAENC*>(outV);
+                    while (inS < inSend) {
+                        *outS++ = *inS++ * this->A;
+                    }
+                }
+                stream_fence();
+            }
+        }
+
+        /**
+         * Decodes pairs of code word vectors into one vector of data, which is then streamed out as a whole.
+         */
+        template<bool check>
+        void InternalDecode(
+                const DecodeConfiguration & config) {
+            if (!is_stream_aligned<VEC>(config.target.begin())) {
+                BASE::template InternalCoder<check, true>(config);
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto inV = config.source.template begin<VEC>();
+                const auto inVend = this->template ComputeEnd<DATAENC>(inV, config);
+                auto outV = config.target.template begin<VEC>();
+                const constexpr DATAENC dMin = std::numeric_limits<DATARAW>::min();
+                const constexpr DATAENC dMax = std::numeric_limits<DATARAW>::max();
+                VEC __attribute__((unused)) mmDMin = mm<VEC, DATAENC>::set1(dMin);
+                VEC __attribute__((unused)) mmDMax = mm<VEC, DATAENC>::set1(dMax);
+                VEC mmAInv = mm<VEC, DATAENC>::set1(this->A_INV);
+                auto decode = [&config,iteration,&mmDMin,&mmDMax,&mmAInv] (VEC * in) {
+                    auto mmInDec = mm_op<VEC, DATAENC, mul>::compute(mm<VEC>::loadu(in), mmAInv);
+                    if (check && !((BASE::mmEncLE::cmp_mask(mmInDec, mmDMax) == BASE::mmEnc::FULL_MASK) & (std::is_unsigned_v<DATARAW> || (BASE::mmEncGE::cmp_mask(mmInDec, mmDMin) == BASE::mmEnc::FULL_MASK)))) {
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAENC*>(in) - config.source.template begin<DATAENC>(), iteration);
+                    }
+                    return mmInDec;
+                };
+                while (inV <= (inVend - 2 * UNROLL)) {
+                    Prefetch(inV);
+                    Prefetch(inV + UNROLL);
+                    // let the compiler unroll the loop
+                    for (size_t unroll = 0; unroll < UNROLL; ++unroll) {
+                        auto mmLo = decode(inV++);
+                        auto mmHi = decode(inV++);
+                        mm_stream<VEC>::store(outV++, mm_narrow<sizeof(DATARAW), VEC>::compute(mmLo, mmHi));
+                    }
+                }
+                // remaining numbers
+                while (inV <= (inVend - 2)) {
+                    auto mmLo = decode(inV++);
+                    auto mmHi = decode(inV++);
+                    mm_stream<VEC>::store(outV++, mm_narrow<sizeof(DATARAW), VEC>::compute(mmLo, mmHi));
+                }
+                auto inS = reinterpret_cast<DATAENC*>(inV);
+                const auto inSend = reinterpret_cast<DATAENC*>(inVend);
+                auto outS = reinterpret_cast<DATARAW*>(outV);
+                for (; inS < inSend; ++inS) {
+                    DATAENC dec = static_cast<DATAENC>(*inS * this->A_INV);
+                    if (check && !((dec <= dMax) & (std::is_unsigned_v<DATARAW> || (dec >= dMin)))) {
+                        throw ErrorInfo(__FILE__, __LINE__, inS - config.source.template begin<DATAENC>(), iteration);
+                    }
+                    *outS++ = static_cast<DATARAW>(dec);
+                }
+                stream_fence();
+            }
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            InternalDecode<false>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            InternalDecode<true>(config);
+        }
+    };
+
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   CRC32C.hpp
+ *
+ * Block-wise CRC32C kernels. They compute the same checksum as chaining CRC<DATA, uint32_t>::compute over all values of a
+ * block (crc32 instruction semantics: no initial or final inversion), but break up the single dependency chain.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace coding_benchmark {
+
+    struct CRC32C {
+        static const constexpr uint32_t POLYNOMIAL = 0x82F63B78; // Castagnoli, bit-reflected
+
+        /**
+         * x^n mod P in the bit-reflected representation of the crc32 instruction. Only meant for compile-time constants.
+         */
+        static constexpr uint32_t xPowModP(
+                size_t n) {
+            uint32_t p = 0x80000000; // x^0
+            for (; n > 0; --n) {
+                p = (p & 1) ? ((p >> 1) ^ POLYNOMIAL) : (p >> 1);
+            }
+            return p;
+        }
+    };
+
+    /**
+     * Three interleaved crc32 chains per round, merged with PCLMULQDQ.
+     */
+    struct CRC32C_sse42 :
+            public CRC32C {
+        static uint32_t
+        compute(
+                uint32_t crc32,
+                const void * data,
+                size_t numBytes);
+    };
+
+    /**
+     * Carry-less folding of 64-byte chunks with VPCLMULQDQ, four chunks in flight.
+     */
+    struct CRC32C_avx512 :
+            public CRC32C {
+        static uint32_t
+        compute(
+                uint32_t crc32,
+                const void * data,
+                size_t numBytes);
+    };
+
+}
@@ -31,6 +31,7 @@
 #include <Util/ErrorInfo.hpp>
 #include <Util/Functors.hpp>
 #include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
 
@@ -45,6 +46,14 @@ namespace coding_benchmark {
         virtual ~CRC_scalar() {
         }
 
+        size_t getEncodedBlockNumValues() override {
+            return BLOCKSIZE;
+        }
+
+        size_t getEncodedBlockSize() override {
+            return BLOCKSIZE * sizeof(DATA) + sizeof(CS);
+        }
+
         void RunEncode(
                 const EncodeConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
@@ -88,34 +97,145 @@ namespace coding_benchmark {
                 _ReadWriteBarrier();
                 size_t i = 0;
                 auto crcIn = config.target.template begin<CS>();
-                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                if (config.numValues >= BLOCKSIZE) {
+                    for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
+                        auto dataIn = reinterpret_cast<DATA*>(crcIn); // first, iterate over sizeof(IN)-bit values
+                        CS crc = 0;
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            crc = CRC<DATA, CS>::compute(crc, *dataIn++);
+                        }
+                        crcIn = reinterpret_cast<CS*>(dataIn); // second, advance data2 up to the checksum
+                        if (crc != *crcIn) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
+                        ++crcIn; // fourth, advance after the checksum to the next block of values
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (i < config.numValues) {
                     auto dataIn = reinterpret_cast<DATA*>(crcIn); // first, iterate over sizeof(IN)-bit values
                     CS crc = 0;
-                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                    do {
+                        ++i;
                         crc = CRC<DATA, CS>::compute(crc, *dataIn++);
-                    }
+                    } while (i < config.numValues);
                     crcIn = reinterpret_cast<CS*>(dataIn); // second, advance data2 up to the checksum
                     if (crc != *crcIn) {
                         throw ErrorInfo(__FILE__, __LINE__, i, iteration);
                     }
-                    ++crcIn; // fourth, advance after the checksum to the next block of values
+                }
+            }
+        }
+
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto crcIn = config.source.template begin<CS>();
+                if (config.numValues >= BLOCKSIZE) {
+                    for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
+                        auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                        CS crc = 0;
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            crc = CRC<DATA, CS>::compute(crc, *dataIn++);
+                        }
+                        crcIn = reinterpret_cast<CS*>(dataIn);
+                        bitmap.appendRepeated(crc != *crcIn, BLOCKSIZE);
+                        ++crcIn;
+                    }
                 }
                 // checksum remaining values which do not fit in the block size
                 if (i < config.numValues) {
-                    auto dataIn = reinterpret_cast<DATA*>(crcIn); // first, iterate over sizeof(IN)-bit values
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     CS crc = 0;
+                    const size_t numRemaining = config.numValues - i;
                     do {
                         ++i;
                         crc = CRC<DATA, CS>::compute(crc, *dataIn++);
                     } while (i < config.numValues);
-                    crcIn = reinterpret_cast<CS*>(dataIn); // second, advance data2 up to the checksum
-                    if (crc != *crcIn) {
-                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    crcIn = reinterpret_cast<CS*>(dataIn);
+                    bitmap.appendRepeated(crc != *crcIn, numRemaining);
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATA> range(config);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto crcIn = config.source.template begin<CS>();
+                if (config.numValues >= BLOCKSIZE) {
+                    for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
+                        auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                        CS crc = 0;
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            const auto tmp = *dataIn++;
+                            if constexpr (check) {
+                                crc = CRC<DATA, CS>::compute(crc, tmp);
+                            }
+                            bitmap.append(range.matches(tmp));
+                        }
+                        crcIn = reinterpret_cast<CS*>(dataIn);
+                        if constexpr (check) {
+                            if (crc != *crcIn) {
+                                throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                            }
+                        }
+                        ++crcIn;
+                    }
+                }
+                // filter remaining values which do not fit in the block size
+                if (i < config.numValues) {
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    CS crc = 0;
+                    do {
+                        ++i;
+                        const auto tmp = *dataIn++;
+                        if constexpr (check) {
+                            crc = CRC<DATA, CS>::compute(crc, tmp);
+                        }
+                        bitmap.append(range.matches(tmp));
+                    } while (i < config.numValues);
+                    crcIn = reinterpret_cast<CS*>(dataIn);
+                    if constexpr (check) {
+                        if (crc != *crcIn) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
                     }
                 }
+                bitmap.flush();
             }
         }
 
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -136,7 +256,7 @@ namespace coding_benchmark {
                 size_t i = 0;
                 auto crcIn = config.source.template begin<CS>();
                 auto dataOut = config.target.template begin<DATA>();
-                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
                     CS crc = 0;
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     for (size_t k = 0; k < BLOCKSIZE; ++k) {
@@ -178,6 +298,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                impl<xor_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                impl<complement>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmetic(
@@ -211,7 +355,7 @@ namespace coding_benchmark {
                 size_t i = 0;
                 auto crcIn = config.source.template begin<CS>();
                 auto dataOut = config.target.template begin<DATA>();
-                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
                     CS crcOld = 0;
                     CS crcNew = 0;
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
@@ -267,6 +411,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                impl<xor_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                impl<complement>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmeticChecked(
@@ -304,7 +472,7 @@ namespace coding_benchmark {
                 size_t i = 0;
                 auto crcIn = config.source.template begin<CS>();
                 Aggregate value = funcInit();
-                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     for (size_t k = 0; k < BLOCKSIZE; ++k) {
                         value = funcKernel(value, *dataIn++);
@@ -378,7 +546,7 @@ namespace coding_benchmark {
                 size_t i = 0;
                 auto crcIn = config.source.template begin<CS>();
                 Aggregate value = funcInit();
-                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     CS crcOld = 0;
                     CS crcNew = 0;
@@ -452,7 +620,7 @@ namespace coding_benchmark {
                 auto crcIn = config.source.template begin<CS>();
                 auto dataOut = config.target.template begin<DATA>();
                 if (config.numValues >= BLOCKSIZE) {
-                    while (i <= (config.numValues - BLOCKSIZE)) {
+                    while ((i + BLOCKSIZE) <= config.numValues) {
                         auto dataIn = reinterpret_cast<DATA*>(crcIn);
                         for (size_t k = 0; k < BLOCKSIZE; ++k) {
                             *dataOut++ = *dataIn++;
@@ -477,7 +645,7 @@ namespace coding_benchmark {
                 size_t i = 0;
                 auto crcIn = config.source.template begin<CS>();
                 auto dataOut = config.target.template begin<DATA>();
-                while (i <= (config.numValues - BLOCKSIZE)) {
+                while ((i + BLOCKSIZE) <= config.numValues) {
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     CS crc = 0;
                     for (size_t k = 0; k < BLOCKSIZE; ++k) {
@@ -496,7 +664,7 @@ namespace coding_benchmark {
                 if (i < config.numValues) {
                     auto dataIn = reinterpret_cast<DATA*>(crcIn);
                     CS crc = 0;
-                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                    for (; i < config.numValues; ++i) {
                         const auto tmp = *dataIn++;
                         crc = CRC<DATA, CS>::compute(crc, tmp);
                         *dataOut++ = tmp;
@@ -508,6 +676,58 @@ namespace coding_benchmark {
                 }
             }
         }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // the data words of each block precede its checksum
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            const size_t numBlocks = config.numValues / BLOCKSIZE;
+            auto data = config.source.template begin<uint8_t>();
+            DecodeView view;
+            view.append(data, numBlocks, BLOCKSIZE, this->getEncodedBlockSize());
+            view.append(data + numBlocks * this->getEncodedBlockSize(), 1, config.numValues % BLOCKSIZE, 0);
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: the values of each block are summed up while its CRC is computed
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            size_t sum = 0;
+            size_t i = 0;
+            auto crcIn = config.source.template begin<CS>();
+            if (config.numValues >= BLOCKSIZE) {
+                for (; (i + BLOCKSIZE) <= config.numValues; i += BLOCKSIZE) {
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    CS crc = 0;
+                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                        crc = CRC<DATA, CS>::compute(crc, dataIn[k]);
+                        sum += static_cast<size_t>(dataIn[k]);
+                    }
+                    crcIn = reinterpret_cast<CS*>(dataIn + BLOCKSIZE);
+                    if (crc != *crcIn) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                    }
+                    ++crcIn;
+                }
+            }
+            if (i < config.numValues) {
+                auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                CS crc = 0;
+                do {
+                    ++i;
+                    crc = CRC<DATA, CS>::compute(crc, *dataIn);
+                    sum += static_cast<size_t>(*dataIn++);
+                } while (i < config.numValues);
+                crcIn = reinterpret_cast<CS*>(dataIn);
+                if (crc != *crcIn) {
+                    throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                }
+            }
+            return sum;
+        }
     };
 
 }
@@ -0,0 +1,192 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   CRC_simd.hpp
+ */
+
+#pragma once
+
+#include <CRC/CRC_scalar.hpp>
+#include <Util/CPU.hpp>
+
+#define CRC_SIMD
+
+#include <CRC/CRC_simd.tcc>
+
+#undef CRC_SIMD
+
+namespace coding_benchmark {
+
+#if defined(__PCLMUL__) or defined(RUNTIME_DISPATCH)
+
+    template<size_t BLOCKSIZE>
+    struct CRC32_sse42_32 :
+            public CRC_simd<uint32_t, uint32_t, BLOCKSIZE, CRC32C_sse42>,
+            public SSE42Test {
+
+        using CRC_simd<uint32_t, uint32_t, BLOCKSIZE, CRC32C_sse42>::CRC_simd;
+
+        virtual ~CRC32_sse42_32() {
+        }
+
+        bool HasCapabilities() override {
+            return SSE42Test::HasCapabilities() && CPU::Instance().PCLMULQDQ;
+        }
+    };
+
+    template<size_t BLOCKSIZE>
+    struct CRC32_sse42_16 :
+            public CRC_simd<uint16_t, uint32_t, BLOCKSIZE, CRC32C_sse42>,
+            public SSE42Test {
+
+        using CRC_simd<uint16_t, uint32_t, BLOCKSIZE, CRC32C_sse42>::CRC_simd;
+
+        virtual ~CRC32_sse42_16() {
+        }
+
+        bool HasCapabilities() override {
+            return SSE42Test::HasCapabilities() && CPU::Instance().PCLMULQDQ;
+        }
+    };
+
+    extern template
+    struct CRC32_sse42_32<1> ;
+    extern template
+    struct CRC32_sse42_32<2> ;
+    extern template
+    struct CRC32_sse42_32<4> ;
+    extern template
+    struct CRC32_sse42_32<8> ;
+    extern template
+    struct CRC32_sse42_32<16> ;
+    extern template
+    struct CRC32_sse42_32<32> ;
+    extern template
+    struct CRC32_sse42_32<64> ;
+    extern template
+    struct CRC32_sse42_32<128> ;
+    extern template
+    struct CRC32_sse42_32<256> ;
+    extern template
+    struct CRC32_sse42_32<512> ;
+    extern template
+    struct CRC32_sse42_32<1024> ;
+
+    extern template
+    struct CRC32_sse42_16<1> ;
+    extern template
+    struct CRC32_sse42_16<2> ;
+    extern template
+    struct CRC32_sse42_16<4> ;
+    extern template
+    struct CRC32_sse42_16<8> ;
+    extern template
+    struct CRC32_sse42_16<16> ;
+    extern template
+    struct CRC32_sse42_16<32> ;
+    extern template
+    struct CRC32_sse42_16<64> ;
+    extern template
+    struct CRC32_sse42_16<128> ;
+    extern template
+    struct CRC32_sse42_16<256> ;
+    extern template
+    struct CRC32_sse42_16<512> ;
+    extern template
+    struct CRC32_sse42_16<1024> ;
+
+#endif /* defined(__PCLMUL__) or defined(RUNTIME_DISPATCH) */
+
+#if (defined(__AVX512F__) and defined(__VPCLMULQDQ__)) or defined(RUNTIME_DISPATCH)
+
+    template<size_t BLOCKSIZE>
+    struct CRC32_avx512_32 :
+            public CRC_simd<uint32_t, uint32_t, BLOCKSIZE, CRC32C_avx512>,
+            public AVX512Test {
+
+        using CRC_simd<uint32_t, uint32_t, BLOCKSIZE, CRC32C_avx512>::CRC_simd;
+
+        virtual ~CRC32_avx512_32() {
+        }
+
+        bool HasCapabilities() override {
+            return AVX512Test::HasCapabilities() && CPU::Instance().VPCLMULQDQ;
+        }
+    };
+
+    template<size_t BLOCKSIZE>
+    struct CRC32_avx512_16 :
+            public CRC_simd<uint16_t, uint32_t, BLOCKSIZE, CRC32C_avx512>,
+            public AVX512Test {
+
+        using CRC_simd<uint16_t, uint32_t, BLOCKSIZE, CRC32C_avx512>::CRC_simd;
+
+        virtual ~CRC32_avx512_16() {
+        }
+
+        bool HasCapabilities() override {
+            return AVX512Test::HasCapabilities() && CPU::Instance().VPCLMULQDQ;
+        }
+    };
+
+    extern template
+    struct CRC32_avx512_32<1> ;
+    extern template
+    struct CRC32_avx512_32<2> ;
+    extern template
+    struct CRC32_avx512_32<4> ;
+    extern template
+    struct CRC32_avx512_32<8> ;
+    extern template
+    struct CRC32_avx512_32<16> ;
+    extern template
+    struct CRC32_avx512_32<32> ;
+    extern template
+    struct CRC32_avx512_32<64> ;
+    extern template
+    struct CRC32_avx512_32<128> ;
+    extern template
+    struct CRC32_avx512_32<256> ;
+    extern template
+    struct CRC32_avx512_32<512> ;
+    extern template
+    struct CRC32_avx512_32<1024> ;
+
+    extern template
+    struct CRC32_avx512_16<1> ;
+    extern template
+    struct CRC32_avx512_16<2> ;
+    extern template
+    struct CRC32_avx512_16<4> ;
+    extern template
+    struct CRC32_avx512_16<8> ;
+    extern template
+    struct CRC32_avx512_16<16> ;
+    extern template
+    struct CRC32_avx512_16<32> ;
+    extern template
+    struct CRC32_avx512_16<64> ;
+    extern template
+    struct CRC32_avx512_16<128> ;
+    extern template
+    struct CRC32_avx512_16<256> ;
+    extern template
+    struct CRC32_avx512_16<512> ;
+    extern template
+    struct CRC32_avx512_16<1024> ;
+
+#endif /* (defined(__AVX512F__) and defined(__VPCLMULQDQ__)) or defined(RUNTIME_DISPATCH) */
+
+}
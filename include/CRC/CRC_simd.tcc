@@ -0,0 +1,250 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   CRC_simd.tcc
+ */
+
+#pragma once
+
+#ifndef CRC_SIMD
+#error "Clients must not include this file directly, but file <CRC/CRC_simd.hpp>!"
+#endif
+
+#include <algorithm>
+
+#include <CRC/CRC32C.hpp>
+
+namespace coding_benchmark {
+
+    /**
+     * Same code layout as CRC_scalar, i.e. BLOCKSIZE values followed by their checksum, but each block's checksum is
+     * computed at once by KERNEL instead of one crc32 per value. The unchecked aggregates and decoding never touch the
+     * checksums and are inherited.
+     */
+    template<typename DATA, typename CS, size_t BLOCKSIZE, typename KERNEL>
+    struct CRC_simd :
+            public CRC_scalar<DATA, CS, BLOCKSIZE> {
+
+        using CRC_scalar<DATA, CS, BLOCKSIZE>::CRC_scalar;
+
+        virtual ~CRC_simd() {
+        }
+
+        static CS computeBlock(
+                const DATA * data,
+                size_t numValues) {
+            if constexpr ((BLOCKSIZE * sizeof(DATA)) < 64) {
+                // below a cache line, the call into the kernel costs more than the single dependency chain
+                CS crc = 0;
+                for (size_t k = 0; k < numValues; ++k) {
+                    crc = CRC<DATA, CS>::compute(crc, data[k]);
+                }
+                return crc;
+            }
+            return KERNEL::compute(0, data, numValues * sizeof(DATA));
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto dataIn = config.source.template begin<DATA>();
+                auto crcOut = config.target.template begin<CS>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    const CS crc = computeBlock(dataIn, numBlock);
+                    auto dataOut = reinterpret_cast<DATA*>(crcOut);
+                    for (size_t k = 0; k < numBlock; ++k) {
+                        *dataOut++ = *dataIn++;
+                    }
+                    crcOut = reinterpret_cast<CS*>(dataOut);
+                    *crcOut++ = crc;
+                }
+            }
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto crcIn = config.target.template begin<CS>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    crcIn = reinterpret_cast<CS*>(dataIn + numBlock);
+                    if (computeBlock(dataIn, numBlock) != *crcIn) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                    ++crcIn;
+                }
+            }
+        }
+
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto crcIn = config.source.template begin<CS>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    crcIn = reinterpret_cast<CS*>(dataIn + numBlock);
+                    bitmap.appendRepeated(computeBlock(dataIn, numBlock) != *crcIn, numBlock);
+                    ++crcIn;
+                }
+                bitmap.flush();
+            }
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            const FilterRange<DATA> range(config);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto crcIn = config.source.template begin<CS>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    if (computeBlock(dataIn, numBlock) != *reinterpret_cast<CS*>(dataIn + numBlock)) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                    for (size_t k = 0; k < numBlock; ++k) {
+                        bitmap.append(range.matches(*dataIn++));
+                    }
+                    crcIn = reinterpret_cast<CS*>(dataIn) + 1;
+                }
+                bitmap.flush();
+            }
+        }
+
+        struct Arithmetor {
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            const bool check;
+            Arithmetor(
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration,
+                    const bool check)
+                    : config(config),
+                      iteration(iteration),
+                      check(check) {
+            }
+            template<template<typename = void> class func>
+            void impl() {
+                func<> functor;
+                auto crcIn = config.source.template begin<CS>();
+                auto dataOut = config.target.template begin<DATA>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    if (check && computeBlock(dataIn, numBlock) != *reinterpret_cast<CS*>(dataIn + numBlock)) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                    auto dataOutBlock = dataOut;
+                    for (size_t k = 0; k < numBlock; ++k) {
+                        *dataOut++ = functor(*dataIn++, config.operand);
+                    }
+                    auto crcOut = reinterpret_cast<CS*>(dataOut);
+                    *crcOut++ = computeBlock(dataOutBlock, numBlock);
+                    dataOut = reinterpret_cast<DATA*>(crcOut);
+                    crcIn = reinterpret_cast<CS*>(dataIn) + 1;
+                }
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                impl<xor_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                impl<complement>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
+        };
+
+        void RunArithmetic(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor(config, iteration, false), config.mode);
+            }
+        }
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor(config, iteration, true), config.mode);
+            }
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto crcIn = config.source.template begin<CS>();
+                auto dataOut = config.target.template begin<DATA>();
+                for (size_t i = 0; i < config.numValues; i += BLOCKSIZE) {
+                    const size_t numBlock = std::min(BLOCKSIZE, config.numValues - i);
+                    auto dataIn = reinterpret_cast<DATA*>(crcIn);
+                    if (computeBlock(dataIn, numBlock) != *reinterpret_cast<CS*>(dataIn + numBlock)) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                    for (size_t k = 0; k < numBlock; ++k) {
+                        *dataOut++ = *dataIn++;
+                    }
+                    crcIn = reinterpret_cast<CS*>(dataIn) + 1;
+                }
+            }
+        }
+    };
+
+}
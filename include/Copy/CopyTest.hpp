@@ -23,8 +23,10 @@
 
 #include <cstring>
 #include <variant>
+#include <algorithm>
 
 #include <Util/Test.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
 
@@ -38,18 +40,62 @@ struct CopyTest :
     virtual ~CopyTest() {
     }
 
+    // The "encoded" data consists of blocks of BLOCKSIZE values, each directly followed by its duplicate.
+    // This keeps the duplicate within the same partition under data-parallel execution.
+    static const constexpr size_t BLOCKSIZE = 4096 / sizeof(DATA);
+
     size_t getNumBytes(
             const SubTestConfiguration & config) const {
         return sizeof(DATA) * config.numValues;
     }
 
+    size_t getEncodedBlockNumValues() override {
+        return BLOCKSIZE;
+    }
+
+    size_t getEncodedBlockSize() override {
+        return 2 * BLOCKSIZE * sizeof(DATA);
+    }
+
+    /**
+     * Calls func(values, numValues) for the original half of each encoded block.
+     */
+    template<typename Func>
+    static void ForEachBlock(
+            const AlignedBlock & encoded,
+            const size_t numValues,
+            Func func) {
+        auto data = encoded.template begin<DATA>();
+        for (size_t i = 0; i < numValues; i += BLOCKSIZE) {
+            const size_t num = std::min(BLOCKSIZE, numValues - i);
+            func(data, num);
+            data += 2 * num;
+        }
+    }
+
+    static void CheckBlocks(
+            const AlignedBlock & encoded,
+            const size_t numValues,
+            const size_t iteration) {
+        size_t index = 0;
+        ForEachBlock(encoded, numValues, [&index,iteration] (const DATA * data, size_t num) {
+            if (memcmp(data, data + num, num * sizeof(DATA)) != 0) {
+                throw ErrorInfo(__FILE__, __LINE__, index, iteration);
+            }
+            index += num;
+        });
+    }
+
     void RunEncode(
             const EncodeConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            memmove(config.target.begin(), config.source.begin(), numBytes);
-            memmove(config.target.template begin<char>() + numBytes, config.source.begin(), numBytes); // just duplicate
+            auto in = config.source.template begin<DATA>();
+            ForEachBlock(config.target, config.numValues, [&in] (DATA * data, size_t num) {
+                memmove(data, in, num * sizeof(DATA));
+                memmove(data + num, in, num * sizeof(DATA)); // just duplicate
+                in += num;
+            });
         }
     }
 
@@ -61,11 +107,26 @@ struct CopyTest :
             const CheckConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            int ret = memcmp(config.target.begin(), config.target.template begin<char>() + numBytes, numBytes);
-            if (ret != 0) {
-                throw ErrorInfo(__FILE__, __LINE__, ret, iteration);
-            }
+            CheckBlocks(config.target, config.numValues, iteration);
+        }
+    }
+
+    bool DoFilter() override {
+        return true;
+    }
+
+    void RunFilter(
+            const FilterConfiguration & config) override {
+        const coding_benchmark::FilterRange<DATA> range(config);
+        for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+            _ReadWriteBarrier();
+            coding_benchmark::BitmapWriter bitmap(config.target);
+            ForEachBlock(config.source, config.numValues, [&range,&bitmap] (const DATA * data, size_t num) {
+                for (const DATA * end = data + num; data < end; ++data) {
+                    bitmap.append(range.matches(*data));
+                }
+            });
+            bitmap.flush();
         }
     }
 
@@ -119,6 +180,40 @@ struct CopyTest :
                 *out++ = *beg++ / config.operand;
             }
         }
+        template<template<typename = void> class Functor>
+        void impl() {
+            Functor<> functor;
+            auto beg = config.source.template begin<DATA>();
+            auto end = beg + 2 * config.numValues;
+            auto out = config.target.template begin<DATA>();
+            while (beg < end) {
+                *out++ = static_cast<DATA>(functor(*beg++, config.operand));
+            }
+        }
+        void operator()(
+                ArithmeticConfiguration::And) {
+            impl<coding_benchmark::and_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Or) {
+            impl<coding_benchmark::or_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Xor) {
+            impl<coding_benchmark::xor_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Not) {
+            impl<coding_benchmark::complement>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Shl) {
+            impl<coding_benchmark::shift_left>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Shr) {
+            impl<coding_benchmark::shift_right>();
+        }
     };
 
     void RunArithmetic(
@@ -138,11 +233,7 @@ struct CopyTest :
             const ArithmeticConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            int ret = memcmp(config.source.begin(), config.source.template begin<char>() + numBytes, numBytes);
-            if (ret != 0) {
-                throw ErrorInfo(__FILE__, __LINE__, ret, iteration);
-            }
+            CheckBlocks(config.source, config.numValues, iteration);
             std::visit(Arithmetor(*this, config), config.mode);
         }
     }
@@ -165,48 +256,48 @@ struct CopyTest :
         void operator()(
                 AggregateConfiguration::Sum) {
             larger_t sum = larger_t(0);
-            auto beg = config.source.template begin<DATA>();
-            auto end = beg + config.numValues;
+            ForEachBlock(config.source, config.numValues, [&sum] (const DATA * beg, size_t num) {
+                for (const DATA * end = beg + num; beg < end; ) {
+                    sum += *beg++;
+                }
+            });
             auto out = config.target.template begin<larger_t>();
-            while (beg < end) {
-                sum += *beg++;
-            }
             *out++ = sum;
             *out = sum;
         }
         void operator()(
                 AggregateConfiguration::Min) {
             DATA min(std::numeric_limits<DATA>::max());
-            auto beg = config.source.template begin<DATA>();
-            auto end = beg + config.numValues;
+            ForEachBlock(config.source, config.numValues, [&min] (const DATA * beg, size_t num) {
+                for (const DATA * end = beg + num; beg < end; ) {
+                    min = std::min(min, *beg++);
+                }
+            });
             auto out = config.target.template begin<larger_t>();
-            while (beg < end) {
-                min = std::min(min, *beg++);
-            }
             *out++ = min;
             *out = min;
         }
         void operator()(
                 AggregateConfiguration::Max) {
             DATA max(std::numeric_limits<DATA>::min());
-            auto beg = config.source.template begin<DATA>();
-            auto end = beg + config.numValues;
+            ForEachBlock(config.source, config.numValues, [&max] (const DATA * beg, size_t num) {
+                for (const DATA * end = beg + num; beg < end; ) {
+                    max = std::max(max, *beg++);
+                }
+            });
             auto out = config.target.template begin<larger_t>();
-            while (beg < end) {
-                max = std::max(max, *beg++);
-            }
             *out++ = max;
             *out = max;
         }
         void operator()(
                 AggregateConfiguration::Avg) {
             larger_t sum = larger_t(0);
-            auto beg = config.source.template begin<DATA>();
-            auto end = beg + config.numValues;
+            ForEachBlock(config.source, config.numValues, [&sum] (const DATA * beg, size_t num) {
+                for (const DATA * end = beg + num; beg < end; ) {
+                    sum += *beg++;
+                }
+            });
             auto out = config.target.template begin<larger_t>();
-            while (beg < end) {
-                sum += *beg++;
-            }
             larger_t avg = sum / config.numValues;
             *out++ = avg;
             *out = avg;
@@ -230,11 +321,7 @@ struct CopyTest :
             const AggregateConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            int ret = memcmp(config.source.begin(), config.source.template begin<char>() + numBytes, numBytes);
-            if (ret != 0) {
-                throw ErrorInfo(__FILE__, __LINE__, ret, iteration);
-            }
+            CheckBlocks(config.source, config.numValues, iteration);
             std::visit(Aggregator(*this, config), config.mode);
         }
     }
@@ -247,16 +334,20 @@ struct CopyTest :
             const ReencodeConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            int ret = memcmp(config.source.begin(), config.source.template begin<char>() + numBytes, numBytes);
-            if (ret != 0) {
-                throw ErrorInfo(__FILE__, __LINE__, ret, iteration);
-            }
-            memmove(config.target.begin(), config.source.begin(), numBytes);
-            memmove(config.target.template begin<char>() + numBytes, config.source.begin(), numBytes); // just duplicate
+            CheckBlocks(config.source, config.numValues, iteration);
+            memmove(config.target.begin(), config.source.begin(), 2 * getNumBytes(config)); // same block layout
         }
     }
 
+    void Decode(
+            const DecodeConfiguration & config) {
+        auto out = config.target.template begin<DATA>();
+        ForEachBlock(config.source, config.numValues, [&out] (const DATA * data, size_t num) {
+            memmove(out, data, num * sizeof(DATA));
+            out += num;
+        });
+    }
+
     bool DoDecode() override {
         return true;
     }
@@ -265,7 +356,7 @@ struct CopyTest :
             const DecodeConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            memmove(config.target.begin(), config.source.begin(), getNumBytes(config));
+            Decode(config);
         }
     }
 
@@ -273,12 +364,8 @@ struct CopyTest :
             const DecodeConfiguration & config) override {
         for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
             _ReadWriteBarrier();
-            auto numBytes = getNumBytes(config);
-            int ret = memcmp(config.source.begin(), config.source.template begin<char>() + numBytes, numBytes);
-            if (ret != 0) {
-                throw ErrorInfo(__FILE__, __LINE__, ret, iteration);
-            }
-            memmove(config.target.begin(), config.source.begin(), numBytes);
+            CheckBlocks(config.source, config.numValues, iteration);
+            Decode(config);
         }
     }
 };
@@ -26,6 +26,7 @@
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <Util/Intrinsics.hpp>
 
 namespace coding_benchmark {
@@ -169,4 +170,76 @@ namespace coding_benchmark {
                 code_t c2);
     };
 
+    /**
+     * Returns one bit per lane of a hamming_t, set where the codes c1 and c2 differ. The codes hold one byte per lane.
+     */
+    template<typename code_t>
+    inline uint64_t hamming_code_mismatch(
+            code_t c1,
+            code_t c2) {
+        uint8_t bytes1[sizeof(code_t)], bytes2[sizeof(code_t)];
+        memcpy(bytes1, &c1, sizeof(code_t));
+        memcpy(bytes2, &c2, sizeof(code_t));
+        uint64_t mask = 0;
+        for (size_t i = 0; i < sizeof(code_t); ++i) {
+            mask |= static_cast<uint64_t>(bytes1[i] != bytes2[i]) << i;
+        }
+        return mask;
+    }
+
+#ifdef __SSE4_2__
+    inline uint64_t hamming_code_mismatch(
+            uint32_t c1,
+            uint32_t c2) {
+        return static_cast<uint64_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_cvtsi32_si128(static_cast<int>(c1)), _mm_cvtsi32_si128(static_cast<int>(c2))))) & 0xF;
+    }
+
+    inline uint64_t hamming_code_mismatch(
+            uint64_t c1,
+            uint64_t c2) {
+        return static_cast<uint64_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_cvtsi64_si128(static_cast<int64_t>(c1)), _mm_cvtsi64_si128(static_cast<int64_t>(c2))))) & 0xFF;
+    }
+
+    inline uint64_t hamming_code_mismatch(
+            __m128i c1,
+            __m128i c2) {
+        return static_cast<uint64_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(c1, c2))) & 0xFFFF;
+    }
+#endif
+
+#ifdef __AVX2__
+    inline uint64_t hamming_code_mismatch(
+            __m256i c1,
+            __m256i c2) {
+        return static_cast<uint32_t>(~_mm256_movemask_epi8(_mm256_cmpeq_epi8(c1, c2)));
+    }
+#endif
+
+    /**
+     * XORs the codes c1 and c2 lane by lane. The codes are linear over GF(2), so the code of the XOR of two data words is
+     * the XOR of their codes.
+     */
+    template<typename code_t>
+    inline code_t hamming_code_xor(
+            code_t c1,
+            code_t c2) {
+        return static_cast<code_t>(c1 ^ c2);
+    }
+
+#ifdef __SSE4_2__
+    inline __m128i hamming_code_xor(
+            __m128i c1,
+            __m128i c2) {
+        return _mm_xor_si128(c1, c2);
+    }
+#endif
+
+#ifdef __AVX2__
+    inline __m256i hamming_code_xor(
+            __m256i c1,
+            __m256i c2) {
+        return _mm256_xor_si256(c1, c2);
+    }
+#endif
+
 }
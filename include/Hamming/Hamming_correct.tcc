@@ -0,0 +1,494 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Hamming_correct.tcc
+ *
+ * Single-error correction (SEC) of the codes of hamming_t. The syndrome, i.e. the XOR of the stored and the recomputed
+ * parity bits 1..6, is the code word position of a single flipped bit, which a lookup table maps to the index of the
+ * flipped data bit. The overall parity bit 0 tells single errors (an odd number of differing code bits) from double
+ * errors (an even number).
+ */
+
+#pragma once
+
+#ifndef HAMMING_SCALAR
+#error "Clients must not include this file directly, but e.g. file <Hamming/Hamming_scalar.hpp> or <Hamming/Hamming_simd.hpp>!"
+#endif
+
+#include <climits>
+#include <cstdint>
+
+#include <Hamming/Hamming_base.hpp>
+
+namespace coding_benchmark {
+
+    static const constexpr uint8_t HAMMING_SEC_PARITY = 0x80; // a parity bit flipped, the data is intact
+    static const constexpr uint8_t HAMMING_SEC_INVALID = 0xC0; // no single flipped bit causes the syndrome
+
+    /**
+     * Maps each syndrome to the index of the flipped data bit, HAMMING_SEC_PARITY or HAMMING_SEC_INVALID.
+     */
+    template<typename DATAIN>
+    struct hamming_sec_table_t {
+        uint8_t index[64];
+
+        constexpr hamming_sec_table_t()
+                : index() {
+            for (size_t syndrome = 0; syndrome < 64; ++syndrome) {
+                if ((syndrome & (syndrome - 1)) == 0) {
+                    index[syndrome] = HAMMING_SEC_PARITY; // no error or a parity bit, whose positions are the powers of two
+                } else {
+                    size_t log2 = 0;
+                    while ((size_t(2) << log2) <= syndrome) {
+                        ++log2;
+                    }
+                    const size_t bit = syndrome - log2 - 2; // the data bits take the remaining positions from 3 on
+                    index[syndrome] = (bit < (sizeof(DATAIN) * CHAR_BIT)) ? static_cast<uint8_t>(bit) : HAMMING_SEC_INVALID;
+                }
+            }
+        }
+    };
+
+    /**
+     * correct() repairs code words with a single flipped bit in place and returns whether the code word was not valid,
+     * so that valid ones are never written. Code words with two flipped bits are counted as uncorrectable and left as
+     * they are.
+     */
+    template<typename DATAIN, typename VEC>
+    struct hamming_sec_t;
+
+    template<typename DATAIN>
+    struct hamming_sec_t<DATAIN, DATAIN> {
+        typedef hamming_t<DATAIN, DATAIN> hamming_scalar_t;
+
+        static const constexpr hamming_sec_table_t<DATAIN> table {};
+
+        static inline uint8_t lookup(
+                const size_t syndrome) {
+            // parity bit 7 may only differ when the stored code flipped there
+            return (syndrome < 64) ? table.index[syndrome] : ((syndrome == 64) ? HAMMING_SEC_PARITY : HAMMING_SEC_INVALID);
+        }
+
+        static inline bool correct(
+                DATAIN & data,
+                uint8_t & code,
+                size_t & numCorrected,
+                size_t & numUncorrectable) {
+            const uint8_t diff = code ^ hamming_scalar_t::computeHamming(data);
+            if (diff == 0) {
+                return false;
+            }
+            const uint8_t index = lookup(diff >> 1);
+            if (((_mm_popcnt_u32(diff) & 0x1) == 0) || (index == HAMMING_SEC_INVALID)) {
+                ++numUncorrectable;
+            } else {
+                if (index != HAMMING_SEC_PARITY) {
+                    data ^= static_cast<DATAIN>(DATAIN(1) << index);
+                }
+                code = hamming_scalar_t::computeHamming(data);
+                ++numCorrected;
+            }
+            return true;
+        }
+    };
+
+#ifdef __SSE4_2__
+    static const constexpr uint8_t HAMMING_SEC_PARITY_NIBBLE[16] = {0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0};
+    static const constexpr uint8_t HAMMING_SEC_BIT_LO[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0, 0, 0, 0, 0, 0, 0, 0};
+    static const constexpr uint8_t HAMMING_SEC_BIT_HI[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+
+    /**
+     * The byte-wise operations of the vectorized correction on a register of code bytes. Lookups use the 4 LSBs of each
+     * index byte and yield 0 for indexes with the MSB set.
+     */
+    template<typename REG>
+    struct hamming_sec_bytes_t;
+
+    template<>
+    struct hamming_sec_bytes_t<__m128i> {
+        static inline __m128i table(
+                const uint8_t * const values) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+        }
+
+        static inline __m128i set1(
+                const uint8_t value) {
+            return _mm_set1_epi8(static_cast<int8_t>(value));
+        }
+
+        static inline __m128i lookup(
+                const __m128i table,
+                const __m128i index) {
+            return _mm_shuffle_epi8(table, index);
+        }
+
+        static inline __m128i cmpeq(
+                const __m128i a,
+                const __m128i b) {
+            return _mm_cmpeq_epi8(a, b);
+        }
+
+        static inline __m128i blend(
+                const __m128i a,
+                const __m128i b,
+                const __m128i mask) {
+            return _mm_blendv_epi8(a, b, mask);
+        }
+
+        static inline __m128i bitAnd(
+                const __m128i a,
+                const __m128i b) {
+            return _mm_and_si128(a, b);
+        }
+
+        // ~a & b
+        static inline __m128i bitAndNot(
+                const __m128i a,
+                const __m128i b) {
+            return _mm_andnot_si128(a, b);
+        }
+
+        static inline __m128i bitOr(
+                const __m128i a,
+                const __m128i b) {
+            return _mm_or_si128(a, b);
+        }
+
+        static inline __m128i bitXor(
+                const __m128i a,
+                const __m128i b) {
+            return _mm_xor_si128(a, b);
+        }
+
+        template<int N>
+        static inline __m128i srli(
+                const __m128i a) {
+            return _mm_and_si128(_mm_srli_epi16(a, N), set1(static_cast<uint8_t>(0xFF >> N)));
+        }
+
+        template<int N>
+        static inline __m128i slli(
+                const __m128i a) {
+            return _mm_and_si128(_mm_slli_epi16(a, N), set1(static_cast<uint8_t>(0xFF << N)));
+        }
+
+        static inline size_t count(
+                const __m128i mask) {
+            return _mm_popcnt_u32(static_cast<uint32_t>(_mm_movemask_epi8(mask)));
+        }
+    };
+
+    /**
+     * Converts the codes of hamming_t<DATAIN, VEC> to and from a register of code bytes and flips the bits of the data
+     * lanes given by the bytes of their lane masks, from the least to the most significant byte.
+     */
+    template<typename DATAIN, typename VEC>
+    struct hamming_sec_lanes_t;
+
+    template<>
+    struct hamming_sec_lanes_t<uint16_t, __m128i> {
+        typedef __m128i reg_t;
+        typedef uint64_t code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return _mm_cvtsi64_si128(static_cast<int64_t>(code));
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return static_cast<code_t>(_mm_cvtsi128_si64(reg));
+        }
+
+        static inline __m128i flip(
+                const __m128i data,
+                const reg_t byte0,
+                const reg_t byte1) {
+            return _mm_xor_si128(data, _mm_or_si128(_mm_cvtepu8_epi16(byte0), _mm_slli_epi16(_mm_cvtepu8_epi16(byte1), 8)));
+        }
+    };
+
+    template<>
+    struct hamming_sec_lanes_t<uint32_t, __m128i> {
+        typedef __m128i reg_t;
+        typedef uint32_t code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return _mm_cvtsi32_si128(static_cast<int32_t>(code));
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return static_cast<code_t>(_mm_cvtsi128_si32(reg));
+        }
+
+        static inline __m128i flip(
+                const __m128i data,
+                const reg_t byte0,
+                const reg_t byte1,
+                const reg_t byte2,
+                const reg_t byte3) {
+            const __m128i mask01 = _mm_or_si128(_mm_cvtepu8_epi32(byte0), _mm_slli_epi32(_mm_cvtepu8_epi32(byte1), 8));
+            const __m128i mask23 = _mm_or_si128(_mm_slli_epi32(_mm_cvtepu8_epi32(byte2), 16), _mm_slli_epi32(_mm_cvtepu8_epi32(byte3), 24));
+            return _mm_xor_si128(data, _mm_or_si128(mask01, mask23));
+        }
+    };
+#endif
+
+#ifdef __AVX2__
+    template<>
+    struct hamming_sec_bytes_t<__m256i> {
+        static inline __m256i table(
+                const uint8_t * const values) {
+            return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+        }
+
+        static inline __m256i set1(
+                const uint8_t value) {
+            return _mm256_set1_epi8(static_cast<int8_t>(value));
+        }
+
+        static inline __m256i lookup(
+                const __m256i table,
+                const __m256i index) {
+            return _mm256_shuffle_epi8(table, index);
+        }
+
+        static inline __m256i cmpeq(
+                const __m256i a,
+                const __m256i b) {
+            return _mm256_cmpeq_epi8(a, b);
+        }
+
+        static inline __m256i blend(
+                const __m256i a,
+                const __m256i b,
+                const __m256i mask) {
+            return _mm256_blendv_epi8(a, b, mask);
+        }
+
+        static inline __m256i bitAnd(
+                const __m256i a,
+                const __m256i b) {
+            return _mm256_and_si256(a, b);
+        }
+
+        // ~a & b
+        static inline __m256i bitAndNot(
+                const __m256i a,
+                const __m256i b) {
+            return _mm256_andnot_si256(a, b);
+        }
+
+        static inline __m256i bitOr(
+                const __m256i a,
+                const __m256i b) {
+            return _mm256_or_si256(a, b);
+        }
+
+        static inline __m256i bitXor(
+                const __m256i a,
+                const __m256i b) {
+            return _mm256_xor_si256(a, b);
+        }
+
+        template<int N>
+        static inline __m256i srli(
+                const __m256i a) {
+            return _mm256_and_si256(_mm256_srli_epi16(a, N), set1(static_cast<uint8_t>(0xFF >> N)));
+        }
+
+        template<int N>
+        static inline __m256i slli(
+                const __m256i a) {
+            return _mm256_and_si256(_mm256_slli_epi16(a, N), set1(static_cast<uint8_t>(0xFF << N)));
+        }
+
+        static inline size_t count(
+                const __m256i mask) {
+            return _mm_popcnt_u32(static_cast<uint32_t>(_mm256_movemask_epi8(mask)));
+        }
+    };
+
+    template<>
+    struct hamming_sec_lanes_t<uint16_t, __m256i> {
+        typedef __m128i reg_t;
+        typedef __m128i code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return code;
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return reg;
+        }
+
+        static inline __m256i flip(
+                const __m256i data,
+                const reg_t byte0,
+                const reg_t byte1) {
+            return _mm256_xor_si256(data, _mm256_or_si256(_mm256_cvtepu8_epi16(byte0), _mm256_slli_epi16(_mm256_cvtepu8_epi16(byte1), 8)));
+        }
+    };
+
+    template<>
+    struct hamming_sec_lanes_t<uint32_t, __m256i> {
+        typedef __m128i reg_t;
+        typedef uint64_t code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return _mm_cvtsi64_si128(static_cast<int64_t>(code));
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return static_cast<code_t>(_mm_cvtsi128_si64(reg));
+        }
+
+        static inline __m256i flip(
+                const __m256i data,
+                const reg_t byte0,
+                const reg_t byte1,
+                const reg_t byte2,
+                const reg_t byte3) {
+            const __m256i mask01 = _mm256_or_si256(_mm256_cvtepu8_epi32(byte0), _mm256_slli_epi32(_mm256_cvtepu8_epi32(byte1), 8));
+            const __m256i mask23 = _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtepu8_epi32(byte2), 16), _mm256_slli_epi32(_mm256_cvtepu8_epi32(byte3), 24));
+            return _mm256_xor_si256(data, _mm256_or_si256(mask01, mask23));
+        }
+    };
+#endif
+
+#ifdef __AVX512F__
+#ifdef __AVX512BW__
+    template<>
+    struct hamming_sec_lanes_t<uint16_t, __m512i> {
+        typedef __m256i reg_t;
+        typedef __m256i code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return code;
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return reg;
+        }
+
+        static inline __m512i flip(
+                const __m512i data,
+                const reg_t byte0,
+                const reg_t byte1) {
+            return _mm512_xor_si512(data, _mm512_or_si512(_mm512_cvtepu8_epi16(byte0), _mm512_slli_epi16(_mm512_cvtepu8_epi16(byte1), 8)));
+        }
+    };
+#endif
+
+    template<>
+    struct hamming_sec_lanes_t<uint32_t, __m512i> {
+        typedef __m128i reg_t;
+        typedef __m128i code_t;
+
+        static inline reg_t toReg(
+                const code_t code) {
+            return code;
+        }
+
+        static inline code_t fromReg(
+                const reg_t reg) {
+            return reg;
+        }
+
+        static inline __m512i flip(
+                const __m512i data,
+                const reg_t byte0,
+                const reg_t byte1,
+                const reg_t byte2,
+                const reg_t byte3) {
+            const __m512i mask01 = _mm512_or_si512(_mm512_cvtepu8_epi32(byte0), _mm512_slli_epi32(_mm512_cvtepu8_epi32(byte1), 8));
+            const __m512i mask23 = _mm512_or_si512(_mm512_slli_epi32(_mm512_cvtepu8_epi32(byte2), 16), _mm512_slli_epi32(_mm512_cvtepu8_epi32(byte3), 24));
+            return _mm512_xor_si512(data, _mm512_or_si512(mask01, mask23));
+        }
+    };
+#endif
+
+#ifdef __SSE4_2__
+    /**
+     * Valid code words only cost the computeHamming() of the checks, all others are corrected on their code bytes at
+     * once: the syndromes are looked up in the 4 16-byte slices of hamming_sec_table_t, the parity of the differing bits
+     * in a nibble table. The indexes of the flipped data bits are then expanded into a bit mask per data lane.
+     */
+    template<typename DATAIN, typename VEC>
+    struct hamming_sec_t {
+        typedef hamming_t<DATAIN, VEC> hamming_vec_t;
+        typedef typename hamming_vec_t::code_t code_t;
+        typedef hamming_sec_lanes_t<DATAIN, VEC> lanes;
+        typedef typename lanes::reg_t reg_t;
+        typedef hamming_sec_bytes_t<reg_t> bytes;
+
+        // lane bit 4 selects the upper 16 bits of 32-bit lanes: move it to the MSB, so that the lookups yield 0
+        static inline reg_t lowerHalf(
+                const reg_t index) {
+            return bytes::bitOr(index, bytes::bitAnd(bytes::template slli<3>(index), bytes::set1(0x80)));
+        }
+
+        static inline bool correct(
+                VEC & data,
+                code_t & code,
+                size_t & numCorrected,
+                size_t & numUncorrectable) {
+            if (hamming_vec_t::code_cmp_eq(code, hamming_vec_t::computeHamming(data))) {
+                return false;
+            }
+            const reg_t stored = lanes::toReg(code);
+            const reg_t diff = bytes::bitXor(stored, lanes::toReg(hamming_vec_t::computeHamming(data)));
+            const reg_t nibbleMask = bytes::set1(0x0F);
+            const reg_t parityTable = bytes::table(HAMMING_SEC_PARITY_NIBBLE);
+            const reg_t parity = bytes::bitXor(bytes::lookup(parityTable, bytes::bitAnd(diff, nibbleMask)), bytes::lookup(parityTable, bytes::template srli<4>(diff)));
+            const reg_t syndrome = bytes::template srli<1>(diff);
+            const reg_t syndromeSlice = bytes::template srli<4>(syndrome);
+            reg_t index = bytes::set1(HAMMING_SEC_INVALID);
+            for (uint8_t slice = 0; slice < 4; ++slice) {
+                const reg_t table = bytes::table(hamming_sec_t<DATAIN, DATAIN>::table.index + 16 * slice);
+                index = bytes::blend(index, bytes::lookup(table, syndrome), bytes::cmpeq(syndromeSlice, bytes::set1(slice)));
+            }
+            index = bytes::blend(index, bytes::set1(HAMMING_SEC_PARITY), bytes::cmpeq(syndrome, bytes::set1(64)));
+            const reg_t isValid = bytes::cmpeq(diff, bytes::set1(0));
+            const reg_t isSingle = bytes::bitAndNot(bytes::cmpeq(index, bytes::set1(HAMMING_SEC_INVALID)), bytes::cmpeq(parity, bytes::set1(1)));
+            const reg_t isCorrectable = bytes::bitAndNot(isValid, isSingle);
+            const reg_t isUncorrectable = bytes::bitAndNot(bytes::bitOr(isValid, isSingle), bytes::set1(0xFF));
+            numCorrected += bytes::count(isCorrectable);
+            numUncorrectable += bytes::count(isUncorrectable);
+            index = bytes::blend(bytes::set1(HAMMING_SEC_PARITY), index, isCorrectable);
+            const reg_t bitLo = bytes::table(HAMMING_SEC_BIT_LO);
+            const reg_t bitHi = bytes::table(HAMMING_SEC_BIT_HI);
+            if constexpr (sizeof(DATAIN) == sizeof(uint16_t)) {
+                data = lanes::flip(data, bytes::lookup(bitLo, index), bytes::lookup(bitHi, index));
+            } else {
+                const reg_t indexLo = lowerHalf(index);
+                const reg_t indexHi = lowerHalf(bytes::bitXor(index, bytes::set1(0x10)));
+                data = lanes::flip(data, bytes::lookup(bitLo, indexLo), bytes::lookup(bitHi, indexLo), bytes::lookup(bitLo, indexHi), bytes::lookup(bitHi, indexHi));
+            }
+            code = lanes::fromReg(bytes::blend(stored, lanes::toReg(hamming_vec_t::computeHamming(data)), isCorrectable));
+            return true;
+        }
+    };
+#endif
+
+}
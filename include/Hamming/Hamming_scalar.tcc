@@ -25,10 +25,12 @@
 #endif
 
 #include <Hamming/Hamming_base.hpp>
+#include <Hamming/Hamming_correct.tcc>
 #include <Util/Test.hpp>
 #include <Util/ErrorInfo.hpp>
 #include <Util/Functors.hpp>
 #include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
 
@@ -96,6 +98,76 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto data = config.source.template begin<hamming_scalar_t>();
+                const auto dataEnd = data + config.numValues;
+                while (data <= (dataEnd - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++data) {
+                        bitmap.append(!data->isValid());
+                    }
+                }
+                for (; data < dataEnd; ++data) {
+                    bitmap.append(!data->isValid());
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATAIN> range(config);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto data = config.source.template begin<hamming_scalar_t>();
+                const auto dataEnd = data + config.numValues;
+                while (data <= (dataEnd - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++data) {
+                        if ((!check) || data->isValid()) {
+                            bitmap.append(range.matches(data->data));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<hamming_scalar_t>(), iteration);
+                        }
+                    }
+                }
+                for (; data < dataEnd; ++data) {
+                    if ((!check) || data->isValid()) {
+                        bitmap.append(range.matches(data->data));
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<hamming_scalar_t>(), iteration);
+                    }
+                }
+                bitmap.flush();
+            }
+        }
+
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
         template<bool check>
         struct Arithmetor {
             using hamming_scalar_t = Hamming_scalar::hamming_scalar_t;
@@ -136,6 +208,35 @@ namespace coding_benchmark {
                     }
                 }
             }
+            /**
+             * XORs each value with operand. The code is linear, so the code of the result is the old code XOR the code of
+             * operand, which is computed only once.
+             */
+            void implXor(
+                    const DATAIN operand) {
+                const auto codeOperand = hamming_scalar_t::computeHamming(operand);
+                auto data = config.source.template begin<hamming_scalar_t>();
+                auto dataEnd = data + config.numValues;
+                auto dataOut = config.target.template begin<hamming_scalar_t>();
+                while (data <= (dataEnd - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++data, ++dataOut) {
+                        if ((!check) || data->isValid()) {
+                            dataOut->data = static_cast<DATAIN>(data->data ^ operand);
+                            dataOut->code = hamming_code_xor(data->code, codeOperand);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<hamming_scalar_t>(), iteration);
+                        }
+                    }
+                }
+                for (; data < dataEnd; ++data, ++dataOut) {
+                    if ((!check) || data->isValid()) {
+                        dataOut->data = static_cast<DATAIN>(data->data ^ operand);
+                        dataOut->code = hamming_code_xor(data->code, codeOperand);
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<hamming_scalar_t>(), iteration);
+                    }
+                }
+            }
             void operator()(
                     ArithmeticConfiguration::Add) {
                 impl<add>();
@@ -152,6 +253,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                implXor(static_cast<DATAIN>(config.operand));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                implXor(static_cast<DATAIN>(~DATAIN(0)));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         bool DoArithmetic(
@@ -312,6 +437,84 @@ namespace coding_benchmark {
                 const DecodeConfiguration & config) override {
             RunDecodeInternal<true>(config);
         }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // each data word is followed by its code
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            DecodeView view;
+            view.append(config.source.template begin<hamming_scalar_t>(), config.numValues, 1, sizeof(hamming_scalar_t));
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: each data word is summed up right after its code is verified
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            size_t sum = 0;
+            auto data = config.source.template begin<hamming_scalar_t>();
+            const auto dataEnd = data + config.numValues;
+            for (; data < dataEnd; ++data) {
+                if (!data->isValid()) {
+                    throw ErrorInfo(__FILE__, __LINE__, data - config.source.template begin<hamming_scalar_t>(), 0);
+                }
+                sum += static_cast<size_t>(data->data);
+            }
+            return sum;
+        }
+
+        bool DoCorrect() override {
+            return true;
+        }
+
+        void RunCorrect(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto data = config.target.template begin<hamming_scalar_t>();
+                const auto dataEnd = data + config.numValues;
+                while (data <= (dataEnd - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++data) {
+                        sec_t::correct(data->data, data->code, numCorrected, numUncorrectable);
+                    }
+                }
+                for (; data < dataEnd; ++data) {
+                    sec_t::correct(data->data, data->code, numCorrected, numUncorrectable);
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
+
+        void RunDecodeCorrected(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto data = config.source.template begin<hamming_scalar_t>();
+                const auto dataEnd = data + config.numValues;
+                auto dataOut = config.target.template begin<DATAIN>();
+                while (data <= (dataEnd - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++data, ++dataOut) {
+                        hamming_scalar_t value = *data;
+                        sec_t::correct(value.data, value.code, numCorrected, numUncorrectable);
+                        *dataOut = value.data;
+                    }
+                }
+                for (; data < dataEnd; ++data, ++dataOut) {
+                    hamming_scalar_t value = *data;
+                    sec_t::correct(value.data, value.code, numCorrected, numUncorrectable);
+                    *dataOut = value.data;
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
     };
 
 }
@@ -30,7 +30,9 @@
 #include <Util/ErrorInfo.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
+#include <Util/Accumulators.hpp>
 #include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
 #include <Hamming/Hamming_scalar.hpp>
 #ifdef __SSE4_2__
 #include <SIMD/SSE.hpp>
@@ -72,6 +74,10 @@ namespace coding_benchmark {
         virtual ~Hamming_simd() {
         }
 
+        size_t getEncodedBlockNumValues() override {
+            return sizeof(VEC) / sizeof(DATAIN);
+        }
+
         void RunEncode(
                 const EncodeConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
@@ -138,6 +144,96 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            const constexpr size_t NUM_VALUES_PER_VECTOR = sizeof(VEC) / sizeof(DATAIN);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto inV = config.source.template begin<hamming_simd_t>();
+                const auto inVend = this->template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
+                while (inV <= (inVend - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++inV) {
+                        bitmap.append(hamming_code_mismatch(inV->code, hamming_simd_t::computeHamming(inV->data)), NUM_VALUES_PER_VECTOR);
+                    }
+                }
+                for (; inV <= (inVend - 1); ++inV) {
+                    bitmap.append(hamming_code_mismatch(inV->code, hamming_simd_t::computeHamming(inV->data)), NUM_VALUES_PER_VECTOR);
+                }
+                if (inV < inVend) {
+                    auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+                    const auto inSend = reinterpret_cast<hamming_scalar_t* const >(inVend);
+                    for (; inS < inSend; ++inS) {
+                        bitmap.append(!inS->isValid());
+                    }
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATAIN> range(config);
+            const FilterMatcher<VEC, DATAIN> matcher(range);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                auto inV = config.source.template begin<hamming_simd_t>();
+                const auto inVend = this->template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
+                while (inV <= (inVend - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++inV) {
+                        if ((!check) || inV->isValid()) {
+                            bitmap.append(static_cast<uint64_t>(matcher.match(inV->data)), FilterMatcher<VEC, DATAIN>::NUM_VALUES_PER_VECTOR);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inV) - config.source.template begin<DATAIN>(), iteration);
+                        }
+                    }
+                }
+                for (; inV <= (inVend - 1); ++inV) {
+                    if ((!check) || inV->isValid()) {
+                        bitmap.append(static_cast<uint64_t>(matcher.match(inV->data)), FilterMatcher<VEC, DATAIN>::NUM_VALUES_PER_VECTOR);
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inV) - config.source.template begin<DATAIN>(), iteration);
+                    }
+                }
+                if (inV < inVend) {
+                    auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+                    const auto inSend = reinterpret_cast<hamming_scalar_t* const >(inVend);
+                    for (; inS < inSend; ++inS) {
+                        if ((!check) || inS->isValid()) {
+                            bitmap.append(range.matches(inS->data));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inS) - config.source.template begin<DATAIN>(), iteration);
+                        }
+                    }
+                }
+                bitmap.flush();
+            }
+        }
+
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -173,7 +269,7 @@ namespace coding_benchmark {
                         }
                     }
                 }
-                for (; inV < (inVend - 1); ++inV, ++outV) {
+                for (; inV <= (inVend - 1); ++inV, ++outV) {
                     if ((!check) || inV->isValid()) {
                         outV->template storeI<StoreVersion>(mm_op<VEC, DATAIN, Functor>::compute(inV->data, mmOperand));
                     } else {
@@ -194,6 +290,50 @@ namespace coding_benchmark {
                     }
                 }
             }
+            /**
+             * XORs each value with operand. The code is linear, so the code of the result is the old code XOR the code of
+             * operand, which is computed only once per vector width.
+             */
+            void implXor(
+                    const DATAIN operand) {
+                const auto mmOperand = mm<VEC, DATAIN>::set1(operand);
+                const auto codeOperand = hamming_simd_t::computeHamming(mmOperand);
+                auto inV = config.source.template begin<hamming_simd_t>();
+                const auto inVend = test.template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
+                auto outV = config.target.template begin<hamming_simd_t>();
+                while (inV <= (inVend - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++inV, ++outV) {
+                        if ((!check) || inV->isValid()) {
+                            outV->data = mm_op<VEC, DATAIN, xor_is>::compute(inV->data, mmOperand);
+                            outV->code = hamming_code_xor(inV->code, codeOperand);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inV) - config.source.template begin<DATAIN>(), iteration);
+                        }
+                    }
+                }
+                for (; inV <= (inVend - 1); ++inV, ++outV) {
+                    if ((!check) || inV->isValid()) {
+                        outV->data = mm_op<VEC, DATAIN, xor_is>::compute(inV->data, mmOperand);
+                        outV->code = hamming_code_xor(inV->code, codeOperand);
+                    } else {
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inV) - config.source.template begin<DATAIN>(), iteration);
+                    }
+                }
+                if (inV < inVend) {
+                    const auto codeOperandScalar = hamming_scalar_t::computeHamming(operand);
+                    auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+                    const auto inSend = reinterpret_cast<hamming_scalar_t* const >(inVend);
+                    auto outS = reinterpret_cast<hamming_scalar_t*>(outV);
+                    for (; inS < inSend; ++outS, ++inS) {
+                        if ((!check) || inS->isValid()) {
+                            outS->data = static_cast<DATAIN>(inS->data ^ operand);
+                            outS->code = hamming_code_xor(inS->code, codeOperandScalar);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inS) - config.source.template begin<DATAIN>(), iteration);
+                        }
+                    }
+                }
+            }
             void operator()(
                     ArithmeticConfiguration::Add) {
                 impl<add>();
@@ -210,6 +350,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                implXor(static_cast<DATAIN>(config.operand));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                implXor(static_cast<DATAIN>(~DATAIN(0)));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmetic(
@@ -238,7 +402,7 @@ namespace coding_benchmark {
             return std::visit(AggregateSelector(), config.mode);
         }
 
-        template<bool check>
+        template<bool check, size_t K>
         struct Aggregator {
             using hamming_sse24_t = Hamming_simd::hamming_simd_t;
             using hamming_scalar_t = Hamming_simd::hamming_scalar_t;
@@ -254,33 +418,43 @@ namespace coding_benchmark {
                       config(config),
                       iteration(iteration) {
             }
-            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
             void impl(
                     InitializeVector && funcInitVector,
                     KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
                     VectorToScalar && funcVectorToScalar,
                     KernelScalar && funcKernelScalar,
                     Finalize && funcFinal) {
-                auto mmAggr = funcInitVector();
+                const constexpr size_t STRIDE = Accumulators<VEC, K>::stride(UNROLL);
+                Accumulators<VEC, K> mmAggrs(funcInitVector);
                 auto inV = config.source.template begin<hamming_simd_t>();
                 const auto inVend = test.template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
-                while (inV <= (inVend - UNROLL)) {
-                    for (size_t k = 0; k < UNROLL; ++k) {
-                        if ((!check) || inV->isValid()) {
-                            mmAggr = funcKernelVector(mmAggr, inV++->data);
-                        } else {
-                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<hamming_scalar_t*>(inV) - config.source.template begin<hamming_scalar_t>(), iteration);
+                while (inV <= (inVend - STRIDE)) {
+                    // one test for the whole stride, the accumulators are dropped anyways when it fails
+                    bool __attribute__((unused)) valid = true;
+                    for (size_t k = 0; k < STRIDE; ++k) {
+                        if constexpr (check) {
+                            valid &= inV[k].isValid();
                         }
+                        mmAggrs[k % K] = funcKernelVector(mmAggrs[k % K], inV[k].data);
                     }
+                    if (check && !valid) {
+                        while (inV->isValid()) {
+                            ++inV;
+                        }
+                        throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<hamming_scalar_t*>(inV) - config.source.template begin<hamming_scalar_t>(), iteration);
+                    }
+                    inV += STRIDE;
                 }
-                while (inV < (inVend - 1)) {
+                while (inV <= (inVend - 1)) {
                     if ((!check) || inV->isValid()) {
-                        mmAggr = funcKernelVector(mmAggr, inV++->data);
+                        mmAggrs[0] = funcKernelVector(mmAggrs[0], inV++->data);
                     } else {
                         throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<hamming_scalar_t*>(inV) - config.source.template begin<hamming_scalar_t>(), iteration);
                     }
                 }
-                Aggregate aggr = funcVectorToScalar(mmAggr);
+                Aggregate aggr = funcVectorToScalar(mmAggrs.combine(funcCombineVector));
                 if (inV < inVend) {
                     auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
                     const auto inSend = reinterpret_cast<hamming_scalar_t * const >(inVend);
@@ -300,26 +474,28 @@ namespace coding_benchmark {
             void operator()(
                     AggregateConfiguration::Sum) {
                 impl<larger_t>([] {return mm<VEC, larger_t>::set1(0);}, [](VEC mmSum, VEC inV) {
-                    mmSum = mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_lo(inV));
-                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_hi(inV));
-                }, [] (VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [] (larger_t sum, DATAIN tmp) {return sum + tmp;}, [] (larger_t sum, size_t numValues) {return sum;});
+                    auto mmLo = mm<VEC, DATAIN>::cvt_larger_lo(inV);
+                    auto mmHi = mm<VEC, DATAIN>::cvt_larger_hi(inV);
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [] (VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [] (larger_t sum, DATAIN tmp) {return sum + tmp;}, [] (larger_t sum, size_t numValues) {return sum;});
             }
             void operator()(
                     AggregateConfiguration::Min) {
                 impl<DATAIN>([] {return mm<VEC, DATAIN>::set1(std::numeric_limits<DATAIN>::max());}, [](VEC mmMin, VEC inV) {return mm<VEC, DATAIN>::min(mmMin, inV);},
-                        [](VEC mmMin) {return mm<VEC, DATAIN>::min(mmMin);}, [](DATAIN min, DATAIN tmp) {return std::min(min, tmp);}, [](DATAIN min, size_t numValues) {return min;});
+                        [](VEC mmMin1, VEC mmMin2) {return mm<VEC, DATAIN>::min(mmMin1, mmMin2);}, [](VEC mmMin) {return mm<VEC, DATAIN>::min(mmMin);}, [](DATAIN min, DATAIN tmp) {return std::min(min, tmp);}, [](DATAIN min, size_t numValues) {return min;});
             }
             void operator()(
                     AggregateConfiguration::Max) {
                 impl<DATAIN>([] {return mm<VEC, DATAIN>::set1(std::numeric_limits<DATAIN>::min());}, [](VEC mmMax, VEC inV) {return mm<VEC, DATAIN>::max(mmMax, inV);},
-                        [](VEC mmMax) {return mm<VEC, DATAIN>::max(mmMax);}, [](DATAIN max, DATAIN tmp) {return std::max(max, tmp);}, [](DATAIN max, size_t numValues) {return max;});
+                        [](VEC mmMax1, VEC mmMax2) {return mm<VEC, DATAIN>::max(mmMax1, mmMax2);}, [](VEC mmMax) {return mm<VEC, DATAIN>::max(mmMax);}, [](DATAIN max, DATAIN tmp) {return std::max(max, tmp);}, [](DATAIN max, size_t numValues) {return max;});
             }
             void operator()(
                     AggregateConfiguration::Avg) {
                 impl<larger_t>([] {return mm<VEC, larger_t>::set1(0);}, [](VEC mmSum, VEC inV) {
-                    mmSum = mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_lo(inV));
-                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_hi(inV));
-                }, [] (VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [] (larger_t sum, DATAIN tmp) {return sum + tmp;}, [] (larger_t sum, size_t numValues) {return sum / numValues;});
+                    auto mmLo = mm<VEC, DATAIN>::cvt_larger_lo(inV);
+                    auto mmHi = mm<VEC, DATAIN>::cvt_larger_hi(inV);
+                    return mm_op<VEC, larger_t, add>::compute(mmSum, mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [] (VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, [] (larger_t sum, DATAIN tmp) {return sum + tmp;}, [] (larger_t sum, size_t numValues) {return sum / numValues;});
             }
         };
 
@@ -327,7 +503,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(Aggregator<false>(*this, config, iteration), config.mode);
+                std::visit(Aggregator<false, NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -340,7 +516,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(Aggregator<true>(*this, config, iteration), config.mode);
+                std::visit(Aggregator<true, NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -361,7 +537,7 @@ namespace coding_benchmark {
                         }
                     }
                 }
-                for (; inV < (inVend - 1); ++inV) {
+                for (; inV <= (inVend - 1); ++inV) {
                     if ((!check) || inV->isValid()) {
                         *outV++ = inV->data;
                     } else {
@@ -396,6 +572,118 @@ namespace coding_benchmark {
                 const DecodeConfiguration & config) override {
             RunDecodeInternal<true>(config);
         }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // each data vector is followed by its codes, the remaining values are stored like by Hamming_scalar
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            const size_t numValuesPerVector = sizeof(VEC) / sizeof(DATAIN);
+            const size_t numVectors = config.numValues / numValuesPerVector;
+            auto inV = config.source.template begin<hamming_simd_t>();
+            DecodeView view;
+            view.append(inV, numVectors, numValuesPerVector, sizeof(hamming_simd_t));
+            view.append(inV + numVectors, config.numValues % numValuesPerVector, 1, sizeof(hamming_scalar_t));
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: each data vector is summed up right after its codes are verified
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            const size_t numValuesPerVector = sizeof(VEC) / sizeof(DATAIN);
+            size_t sum = 0;
+            auto inV = config.source.template begin<hamming_simd_t>();
+            const auto inVend = inV + config.numValues / numValuesPerVector;
+            for (; inV < inVend; ++inV) {
+                if (!inV->isValid()) {
+                    throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inV) - config.source.template begin<DATAIN>(), 0);
+                }
+                sum += this->SumValues(reinterpret_cast<const DATAIN*>(&inV->data), numValuesPerVector);
+            }
+            auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+            const auto inSend = inS + config.numValues % numValuesPerVector;
+            for (; inS < inSend; ++inS) {
+                if (!inS->isValid()) {
+                    throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATAIN*>(inS) - config.source.template begin<DATAIN>(), 0);
+                }
+                sum += static_cast<size_t>(inS->data);
+            }
+            return sum;
+        }
+
+        bool DoCorrect() override {
+            return true;
+        }
+
+        void RunCorrect(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, VEC> sec_vec_t;
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_scalar_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto inV = config.target.template begin<hamming_simd_t>();
+                const auto inVend = this->template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
+                while (inV <= (inVend - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++inV) {
+                        sec_vec_t::correct(inV->data, inV->code, numCorrected, numUncorrectable);
+                    }
+                }
+                for (; inV <= (inVend - 1); ++inV) {
+                    sec_vec_t::correct(inV->data, inV->code, numCorrected, numUncorrectable);
+                }
+                if (inV < inVend) {
+                    auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+                    const auto inSend = reinterpret_cast<hamming_scalar_t* const >(inVend);
+                    for (; inS < inSend; ++inS) {
+                        sec_scalar_t::correct(inS->data, inS->code, numCorrected, numUncorrectable);
+                    }
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
+
+        void RunDecodeCorrected(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, VEC> sec_vec_t;
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_scalar_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                auto inV = config.source.template begin<hamming_simd_t>();
+                const auto inVend = this->template ComputeEnd<hamming_scalar_t, hamming_simd_t>(inV, config);
+                auto outV = config.target.template begin<VEC>();
+                while (inV <= (inVend - UNROLL)) {
+                    for (size_t k = 0; k < UNROLL; ++k, ++inV) {
+                        VEC data = inV->data;
+                        typename hamming_simd_t::code_t code = inV->code;
+                        sec_vec_t::correct(data, code, numCorrected, numUncorrectable);
+                        *outV++ = data;
+                    }
+                }
+                for (; inV <= (inVend - 1); ++inV) {
+                    VEC data = inV->data;
+                    typename hamming_simd_t::code_t code = inV->code;
+                    sec_vec_t::correct(data, code, numCorrected, numUncorrectable);
+                    *outV++ = data;
+                }
+                if (inV < inVend) {
+                    auto inS = reinterpret_cast<hamming_scalar_t*>(inV);
+                    const auto inSend = reinterpret_cast<hamming_scalar_t * const >(inVend);
+                    auto outS = reinterpret_cast<DATAIN*>(outV);
+                    for (; inS < inSend; ++inS) {
+                        hamming_scalar_t value = *inS;
+                        sec_scalar_t::correct(value.data, value.code, numCorrected, numUncorrectable);
+                        *outS++ = value.data;
+                    }
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
     };
 
 }
@@ -0,0 +1,647 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Hamming_soa.tcc
+ *
+ * Structure-of-arrays storage of the Hamming codes, see Hamming_soa.
+ */
+
+#pragma once
+
+#ifndef HAMMING_SOA
+#error "Clients must not include this file directly, but file <Hamming/Hamming_soa.hpp>!"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <Util/Test.hpp>
+#include <Util/ErrorInfo.hpp>
+#include <Util/ArithmeticSelector.hpp>
+#include <Util/AggregateSelector.hpp>
+#include <Util/Functors.hpp>
+#include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
+#include <Hamming/Hamming_scalar.hpp>
+#include <Hamming/Hamming_simd.hpp>
+
+namespace coding_benchmark {
+
+    /**
+     * Hamming codes stored as structure of arrays: instead of interleaving each data vector with its code (hamming_t),
+     * the encoded buffer consists of blocks of BLOCK_NUM_VALUES values, each one holding the data column followed by the
+     * column of the values' 8-bit codes. Both columns of a full block start on cache line boundaries, so that all data
+     * loads are aligned and the unchecked filter, aggregate and decode kernels do not touch the codes at all. The last
+     * block holds only the remaining values, with its code column directly after its data.
+     *
+     * VEC == DATAIN selects the scalar kernels.
+     */
+    template<typename DATAIN, typename VEC, size_t UNROLL>
+    struct Hamming_soa :
+            public Test<DATAIN, hamming_t<DATAIN, DATAIN>>,
+            public std::conditional_t<std::is_same_v<VEC, DATAIN>, ScalarTest, SIMDTest<VEC>> {
+
+        typedef hamming_t<DATAIN, VEC> hamming_vec_t;
+        typedef hamming_t<DATAIN, DATAIN> hamming_scalar_t;
+        typedef typename hamming_vec_t::code_t code_vec_t;
+
+        static const constexpr bool IS_SCALAR = std::is_same_v<VEC, DATAIN>;
+        static const constexpr size_t NUM_VALUES_PER_VECTOR = sizeof(VEC) / sizeof(DATAIN);
+        static const constexpr size_t BLOCK_NUM_VALUES = 1024;
+        static const constexpr size_t BLOCK_SIZE = BLOCK_NUM_VALUES * (sizeof(DATAIN) + sizeof(uint8_t));
+
+        static_assert(sizeof(code_vec_t) == NUM_VALUES_PER_VECTOR, "the code column holds exactly one byte per value");
+        static_assert((BLOCK_NUM_VALUES % NUM_VALUES_PER_VECTOR) == 0, "full blocks consist of whole vectors");
+
+        /**
+         * The columns of a single block of an encoded buffer.
+         */
+        struct Block {
+            DATAIN * const data;
+            uint8_t * const code;
+            const size_t numValues;
+
+            Block(
+                    const AlignedBlock & encoded,
+                    const size_t offset,
+                    const size_t numValues)
+                    : data(reinterpret_cast<DATAIN*>(encoded.template begin<uint8_t>() + (offset / BLOCK_NUM_VALUES) * BLOCK_SIZE)),
+                      code(reinterpret_cast<uint8_t*>(data + std::min(BLOCK_NUM_VALUES, numValues - offset))),
+                      numValues(std::min(BLOCK_NUM_VALUES, numValues - offset)) {
+            }
+        };
+
+        using Test<DATAIN, hamming_scalar_t>::Test;
+
+        virtual ~Hamming_soa() {
+        }
+
+        size_t getEncodedBlockNumValues() override {
+            return BLOCK_NUM_VALUES;
+        }
+
+        size_t getEncodedBlockSize() override {
+            return BLOCK_SIZE;
+        }
+
+        static inline VEC load(
+                const DATAIN * const data) {
+            return *reinterpret_cast<const VEC*>(data);
+        }
+
+        static inline void store(
+                DATAIN * const data,
+                const VEC value) {
+            *reinterpret_cast<VEC*>(data) = value;
+        }
+
+        // the code column of the last block is not aligned
+        static inline code_vec_t loadCode(
+                const uint8_t * const code) {
+            code_vec_t result;
+            memcpy(&result, code, sizeof(result));
+            return result;
+        }
+
+        static inline void storeCode(
+                uint8_t * const code,
+                const code_vec_t value) {
+            memcpy(code, &value, sizeof(value));
+        }
+
+        static inline bool isValid(
+                const Block & block,
+                const size_t i) {
+            return hamming_vec_t::code_cmp_eq(loadCode(block.code + i), hamming_vec_t::computeHamming(load(block.data + i)));
+        }
+
+        static inline bool isValidScalar(
+                const Block & block,
+                const size_t i) {
+            return block.code[i] == hamming_scalar_t::computeHamming(block.data[i]);
+        }
+
+        /**
+         * Calls kernelVector(i) for each whole vector of a block's values and kernelScalar(i) for the remaining ones.
+         */
+        template<typename KernelVector, typename KernelScalar>
+        static inline void ForEachValue(
+                const size_t numValues,
+                KernelVector && kernelVector,
+                KernelScalar && kernelScalar) {
+            size_t i = 0;
+            while ((i + UNROLL * NUM_VALUES_PER_VECTOR) <= numValues) {
+                for (size_t k = 0; k < UNROLL; ++k, i += NUM_VALUES_PER_VECTOR) {
+                    kernelVector(i);
+                }
+            }
+            for (; (i + NUM_VALUES_PER_VECTOR) <= numValues; i += NUM_VALUES_PER_VECTOR) {
+                kernelVector(i);
+            }
+            for (; i < numValues; ++i) {
+                kernelScalar(i);
+            }
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const DATAIN * const in = config.source.template begin<DATAIN>() + offset;
+                    const Block out(config.target, offset, config.numValues);
+                    ForEachValue(out.numValues, [&] (size_t i) {
+                        const VEC data = load(in + i);
+                        store(out.data + i, data);
+                        storeCode(out.code + i, hamming_vec_t::computeHamming(data));
+                    }, [&] (size_t i) {
+                        out.data[i] = in[i];
+                        out.code[i] = hamming_scalar_t::computeHamming(in[i]);
+                    });
+                }
+            }
+        }
+
+        bool DoCheck() override {
+            return true;
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.target, offset, config.numValues);
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        if (!isValid(in, i)) {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }, [&] (size_t i) {
+                        if (!isValidScalar(in, i)) {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    });
+                }
+            }
+        }
+
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        bitmap.append(hamming_code_mismatch(loadCode(in.code + i), hamming_vec_t::computeHamming(load(in.data + i))), NUM_VALUES_PER_VECTOR);
+                    }, [&] (size_t i) {
+                        bitmap.append(!isValidScalar(in, i));
+                    });
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATAIN> range(config);
+            typedef std::conditional_t<IS_SCALAR, FilterRange<DATAIN>, FilterMatcher<VEC, DATAIN>> matcher_t;
+            const matcher_t matcher(range);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        if ((!check) || isValid(in, i)) {
+                            if constexpr (IS_SCALAR) {
+                                bitmap.append(matcher.matches(in.data[i]));
+                            } else {
+                                bitmap.append(static_cast<uint64_t>(matcher.match(load(in.data + i))), NUM_VALUES_PER_VECTOR);
+                            }
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }, [&] (size_t i) {
+                        if ((!check) || isValidScalar(in, i)) {
+                            bitmap.append(range.matches(in.data[i]));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    });
+                }
+                bitmap.flush();
+            }
+        }
+
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
+        template<bool check>
+        struct Arithmetor {
+            const ArithmeticConfiguration & config;
+            const size_t iteration;
+            Arithmetor(
+                    const ArithmeticConfiguration & config,
+                    const size_t iteration)
+                    : config(config),
+                      iteration(iteration) {
+            }
+            template<template<typename = void> class Functor>
+            void impl() {
+                Functor<> functor;
+                const DATAIN operand = static_cast<DATAIN>(config.operand);
+                VEC mmOperand;
+                if constexpr (IS_SCALAR) {
+                    mmOperand = operand;
+                } else {
+                    mmOperand = mm<VEC, DATAIN>::set1(operand);
+                }
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    const Block out(config.target, offset, config.numValues);
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        if ((!check) || isValid(in, i)) {
+                            VEC data;
+                            if constexpr (IS_SCALAR) {
+                                data = static_cast<DATAIN>(functor(in.data[i], mmOperand));
+                            } else {
+                                data = mm_op<VEC, DATAIN, Functor>::compute(load(in.data + i), mmOperand);
+                            }
+                            store(out.data + i, data);
+                            storeCode(out.code + i, hamming_vec_t::computeHamming(data));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }, [&] (size_t i) {
+                        if ((!check) || isValidScalar(in, i)) {
+                            const DATAIN data = static_cast<DATAIN>(functor(in.data[i], operand));
+                            out.data[i] = data;
+                            out.code[i] = hamming_scalar_t::computeHamming(data);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    });
+                }
+            }
+            void operator()(
+                    ArithmeticConfiguration::Add) {
+                impl<add>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Sub) {
+                impl<sub>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Mul) {
+                impl<mul>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Div) {
+                impl<div>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                impl<xor_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                impl<complement>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
+        };
+
+        bool DoArithmetic(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        void RunArithmetic(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<false>(config, iteration), config.mode);
+            }
+        }
+
+        bool DoArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            return std::visit(ArithmeticSelector(), config.mode);
+        }
+
+        void RunArithmeticChecked(
+                const ArithmeticConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Arithmetor<true>(config, iteration), config.mode);
+            }
+        }
+
+        template<bool check>
+        struct Aggregator {
+            typedef typename Larger<DATAIN>::larger_t larger_t;
+            Hamming_soa & test;
+            const AggregateConfiguration & config;
+            const size_t iteration;
+            Aggregator(
+                    Hamming_soa & test,
+                    const AggregateConfiguration & config,
+                    const size_t iteration)
+                    : test(test),
+                      config(config),
+                      iteration(iteration) {
+            }
+            /**
+             * For the scalar kernels, the "vector" aggregate is the scalar one.
+             */
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename VectorToScalar, typename KernelScalar, typename Finalize>
+            void impl(
+                    InitializeVector && funcInitVector,
+                    KernelVector && funcKernelVector,
+                    VectorToScalar && funcVectorToScalar,
+                    KernelScalar && funcKernelScalar,
+                    Finalize && funcFinal) {
+                auto mmAggr = funcInitVector();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    const size_t numVectorValues = in.numValues - (in.numValues % NUM_VALUES_PER_VECTOR);
+                    ForEachValue(numVectorValues, [&] (size_t i) {
+                        if ((!check) || isValid(in, i)) {
+                            mmAggr = funcKernelVector(mmAggr, load(in.data + i));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }, [] (size_t) {
+                    });
+                }
+                Aggregate aggr = funcVectorToScalar(mmAggr);
+                if ((config.numValues % NUM_VALUES_PER_VECTOR) != 0) {
+                    const size_t offset = ((config.numValues - 1) / BLOCK_NUM_VALUES) * BLOCK_NUM_VALUES; // only the last block has remaining values
+                    const Block in(config.source, offset, config.numValues);
+                    for (size_t i = in.numValues - (in.numValues % NUM_VALUES_PER_VECTOR); i < in.numValues; ++i) {
+                        if ((!check) || isValidScalar(in, i)) {
+                            aggr = funcKernelScalar(aggr, in.data[i]);
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }
+                }
+                auto dataOut = test.bufScratchPad.template begin<Aggregate>();
+                *dataOut = funcFinal(aggr, config.numValues);
+                EncodeConfiguration encConf(1, 2, test.bufScratchPad, config.target);
+                test.RunEncode(encConf);
+            }
+            template<typename Finalize>
+            void sumImpl(
+                    Finalize && funcFinal) {
+                auto kernelScalar = [] (larger_t sum, DATAIN value) {return static_cast<larger_t>(sum + value);};
+                if constexpr (IS_SCALAR) {
+                    impl<larger_t>([] {return larger_t(0);}, kernelScalar, [] (larger_t sum) {return sum;}, kernelScalar, std::forward<Finalize>(funcFinal));
+                } else {
+                    impl<larger_t>([] {return mm<VEC, larger_t>::set1(0);}, [] (VEC mmSum, VEC data) {
+                        mmSum = mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_lo(data));
+                        return mm_op<VEC, larger_t, add>::compute(mmSum, mm<VEC, DATAIN>::cvt_larger_hi(data));
+                    }, [] (VEC mmSum) {return mm<VEC, larger_t>::sum(mmSum);}, kernelScalar, std::forward<Finalize>(funcFinal));
+                }
+            }
+            void operator()(
+                    AggregateConfiguration::Sum) {
+                sumImpl([] (larger_t sum, size_t numValues) {return sum;});
+            }
+            void operator()(
+                    AggregateConfiguration::Min) {
+                auto kernelScalar = [] (DATAIN min, DATAIN value) {return std::min(min, value);};
+                auto final = [] (DATAIN min, size_t numValues) {return min;};
+                if constexpr (IS_SCALAR) {
+                    impl<DATAIN>([] {return std::numeric_limits<DATAIN>::max();}, kernelScalar, [] (DATAIN min) {return min;}, kernelScalar, final);
+                } else {
+                    impl<DATAIN>([] {return mm<VEC, DATAIN>::set1(std::numeric_limits<DATAIN>::max());}, [] (VEC mmMin, VEC data) {return mm<VEC, DATAIN>::min(mmMin, data);},
+                            [] (VEC mmMin) {return mm<VEC, DATAIN>::min(mmMin);}, kernelScalar, final);
+                }
+            }
+            void operator()(
+                    AggregateConfiguration::Max) {
+                auto kernelScalar = [] (DATAIN max, DATAIN value) {return std::max(max, value);};
+                auto final = [] (DATAIN max, size_t numValues) {return max;};
+                if constexpr (IS_SCALAR) {
+                    impl<DATAIN>([] {return std::numeric_limits<DATAIN>::min();}, kernelScalar, [] (DATAIN max) {return max;}, kernelScalar, final);
+                } else {
+                    impl<DATAIN>([] {return mm<VEC, DATAIN>::set1(std::numeric_limits<DATAIN>::min());}, [] (VEC mmMax, VEC data) {return mm<VEC, DATAIN>::max(mmMax, data);},
+                            [] (VEC mmMax) {return mm<VEC, DATAIN>::max(mmMax);}, kernelScalar, final);
+                }
+            }
+            void operator()(
+                    AggregateConfiguration::Avg) {
+                sumImpl([] (larger_t sum, size_t numValues) {return static_cast<larger_t>(sum / numValues);});
+            }
+        };
+
+        bool DoAggregate(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        void RunAggregate(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<false>(*this, config, iteration), config.mode);
+            }
+        }
+
+        bool DoAggregateChecked(
+                const AggregateConfiguration & config) override {
+            return std::visit(AggregateSelector(), config.mode);
+        }
+
+        void RunAggregateChecked(
+                const AggregateConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                std::visit(Aggregator<true>(*this, config, iteration), config.mode);
+            }
+        }
+
+        template<bool check>
+        void RunDecodeInternal(
+                const DecodeConfiguration & config) {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    DATAIN * const out = config.target.template begin<DATAIN>() + offset;
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        if ((!check) || isValid(in, i)) {
+                            store(out + i, load(in.data + i));
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    }, [&] (size_t i) {
+                        if ((!check) || isValidScalar(in, i)) {
+                            out[i] = in.data[i];
+                        } else {
+                            throw ErrorInfo(__FILE__, __LINE__, offset + i, iteration);
+                        }
+                    });
+                }
+            }
+        }
+
+        bool DoDecode() override {
+            return true;
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            RunDecodeInternal<false>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            RunDecodeInternal<true>(config);
+        }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // the data column of each block precedes its code column
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            const size_t numBlocks = config.numValues / BLOCK_NUM_VALUES;
+            auto data = config.source.template begin<uint8_t>();
+            DecodeView view;
+            view.append(data, numBlocks, BLOCK_NUM_VALUES, BLOCK_SIZE);
+            view.append(data + numBlocks * BLOCK_SIZE, 1, config.numValues % BLOCK_NUM_VALUES, 0);
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: each vector of the data column is summed up right after its codes are verified
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            size_t sum = 0;
+            for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                const Block in(config.source, offset, config.numValues);
+                ForEachValue(in.numValues, [&] (size_t i) {
+                    if (!isValid(in, i)) {
+                        throw ErrorInfo(__FILE__, __LINE__, offset + i, 0);
+                    }
+                    sum += this->SumValues(in.data + i, NUM_VALUES_PER_VECTOR);
+                }, [&] (size_t i) {
+                    if (!isValidScalar(in, i)) {
+                        throw ErrorInfo(__FILE__, __LINE__, offset + i, 0);
+                    }
+                    sum += static_cast<size_t>(in.data[i]);
+                });
+            }
+            return sum;
+        }
+
+        bool DoCorrect() override {
+            return true;
+        }
+
+        // only code words with flipped bits are written back
+        void RunCorrect(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, VEC> sec_vec_t;
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_scalar_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.target, offset, config.numValues);
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        VEC data = load(in.data + i);
+                        code_vec_t code = loadCode(in.code + i);
+                        if (sec_vec_t::correct(data, code, numCorrected, numUncorrectable)) {
+                            store(in.data + i, data);
+                            storeCode(in.code + i, code);
+                        }
+                    }, [&] (size_t i) {
+                        sec_scalar_t::correct(in.data[i], in.code[i], numCorrected, numUncorrectable);
+                    });
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
+
+        void RunDecodeCorrected(
+                const CorrectConfiguration & config) override {
+            typedef hamming_sec_t<DATAIN, VEC> sec_vec_t;
+            typedef hamming_sec_t<DATAIN, DATAIN> sec_scalar_t;
+            size_t numCorrected = 0;
+            size_t numUncorrectable = 0;
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                for (size_t offset = 0; offset < config.numValues; offset += BLOCK_NUM_VALUES) {
+                    const Block in(config.source, offset, config.numValues);
+                    DATAIN * const out = config.target.template begin<DATAIN>() + offset;
+                    ForEachValue(in.numValues, [&] (size_t i) {
+                        VEC data = load(in.data + i);
+                        code_vec_t code = loadCode(in.code + i);
+                        sec_vec_t::correct(data, code, numCorrected, numUncorrectable);
+                        store(out + i, data);
+                    }, [&] (size_t i) {
+                        DATAIN data = in.data[i];
+                        uint8_t code = in.code[i];
+                        sec_scalar_t::correct(data, code, numCorrected, numUncorrectable);
+                        out[i] = data;
+                    });
+                }
+            }
+            config.counts.add(numCorrected, numUncorrectable);
+        }
+    };
+
+}
@@ -206,8 +206,8 @@ namespace coding_benchmark {
 
         template<typename T>
         struct mm_op<__m256i, T, std::equal_to> :
-                public avx2::mm256op<T, std::less> {
-            typedef avx2::mm256op<T, std::less> BASE;
+                public avx2::mm256op<T, std::equal_to> {
+            typedef avx2::mm256op<T, std::equal_to> BASE;
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
@@ -215,8 +215,8 @@ namespace coding_benchmark {
 
         template<typename T>
         struct mm_op<__m256i, T, std::not_equal_to> :
-                public avx2::mm256op<T, std::less> {
-            typedef avx2::mm256op<T, std::less> BASE;
+                public avx2::mm256op<T, std::not_equal_to> {
+            typedef avx2::mm256op<T, std::not_equal_to> BASE;
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
@@ -229,6 +229,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -238,6 +244,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -247,6 +259,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -290,6 +308,55 @@ namespace coding_benchmark {
             using BASE::compute;
         };
 
+        /**
+         * Complements all bits of a and ignores b (see coding_benchmark::complement).
+         */
+        template<typename T>
+        struct mm_op<__m256i, T, coding_benchmark::complement> {
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                return _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+            }
+        };
+
+        /**
+         * Shifts all lanes by the first lane of b, modulo the lane width (see coding_benchmark::shift_left).
+         */
+        template<typename T>
+        struct mm_op<__m256i, T, coding_benchmark::shift_left> {
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(_mm256_castsi256_si128(b)) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+                    return _mm256_sll_epi16(a, count);
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm256_sll_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm256_sll_epi64(a, count);
+                }
+            }
+        };
+
+        template<typename T>
+        struct mm_op<__m256i, T, coding_benchmark::shift_right> {
+            static inline __m256i compute(
+                    __m256i a,
+                    __m256i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(_mm256_castsi256_si128(b)) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+                    return _mm256_srl_epi16(a, count);
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm256_srl_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm256_srl_epi64(a, count);
+                }
+            }
+        };
+
     }
 }
 
@@ -301,9 +301,10 @@ namespace coding_benchmark {
                 template<typename T, template<typename > class Op>
                 struct _mm256op;
 
-                inline uint8_t compact_mask(
+                inline uint16_t compact_mask(
                         __m256i mask) {
-                    return static_cast<uint8_t>(_mm256_movemask_epi8(_mm256_shuffle_epi8(mask, _mm256_set_epi64x(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x1E1C1A1816141210ull, 0x0E0C0A0806040200ull))));
+                    // packs works per 128-bit lane, so the two 64-bit halves holding the 16 lane bytes are moved together afterwards
+                    return static_cast<uint16_t>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(mask, _mm256_setzero_si256()), 0xD8)));
                 }
 
                 template<typename T>
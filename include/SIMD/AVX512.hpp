@@ -151,10 +151,12 @@ namespace coding_benchmark {
 
             using BASE::mask_t;
             using BASE::popcnt_t;
+            using BASE::FULL_MASK;
 
             using BASE::set;
             using BASE::set1;
             using BASE::set_inc;
+            using BASE::extract;
             using BASE::min;
             using BASE::max;
             using BASE::sum;
@@ -164,6 +166,8 @@ namespace coding_benchmark {
             using BASE::popcount;
             using BASE::popcount2;
             using BASE::popcount3;
+            using BASE::cvt_larger_lo;
+            using BASE::cvt_larger_hi;
         };
 
         template<typename T>
@@ -227,6 +231,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -236,6 +246,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -245,6 +261,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -288,6 +310,67 @@ namespace coding_benchmark {
             using BASE::compute;
         };
 
+        /**
+         * Complements all bits of a and ignores b (see coding_benchmark::complement).
+         */
+        template<typename T>
+        struct mm_op<__m512i, T, coding_benchmark::complement> {
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                return _mm512_xor_si512(a, _mm512_set1_epi32(-1));
+            }
+        };
+
+        /**
+         * Shifts all lanes by the first lane of b, modulo the lane width (see coding_benchmark::shift_left).
+         */
+        template<typename T>
+        struct mm_op<__m512i, T, coding_benchmark::shift_left> {
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(_mm512_castsi512_si128(b)) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+#ifdef __AVX512BW__
+                    return _mm512_sll_epi16(a, count);
+#else
+                    const __m256i lo = _mm256_sll_epi16(_mm512_extracti64x4_epi64(a, 0), count);
+                    const __m256i hi = _mm256_sll_epi16(_mm512_extracti64x4_epi64(a, 1), count);
+                    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+#endif
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm512_sll_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm512_sll_epi64(a, count);
+                }
+            }
+        };
+
+        template<typename T>
+        struct mm_op<__m512i, T, coding_benchmark::shift_right> {
+            static inline __m512i compute(
+                    __m512i a,
+                    __m512i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(_mm512_castsi512_si128(b)) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+#ifdef __AVX512BW__
+                    return _mm512_srl_epi16(a, count);
+#else
+                    const __m256i lo = _mm256_srl_epi16(_mm512_extracti64x4_epi64(a, 0), count);
+                    const __m256i hi = _mm256_srl_epi16(_mm512_extracti64x4_epi64(a, 1), count);
+                    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+#endif
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm512_srl_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm512_srl_epi64(a, count);
+                }
+            }
+        };
+
     }
 }
 
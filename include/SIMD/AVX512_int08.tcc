@@ -257,7 +257,7 @@ namespace coding_benchmark {
                             __m512i b) {
 #ifdef __AVX512BW__
                         auto mm = max(a, b);
-                        return _mm512_cmpeq_epi8(a, mm);
+                        return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a, mm));
 #else
                         auto mm256 = coding_benchmark::simd::mm_op<__m256i, T, std::greater_equal>::cmp(_mm512_extracti64x4_epi64(a, 0), _mm512_extracti64x4_epi64(b, 0));
                         auto mm = _mm512_castps256_ps512(mm256);
@@ -278,9 +278,29 @@ namespace coding_benchmark {
 #endif
                     }
 
-                    static inline uint8_t sum(
+                    template<int I>
+                    static inline T extract(
                             __m512i a) {
-                        throw std::runtime_error("__m512i sum uint8_t not supported yet"); // TODO
+                        return reinterpret_cast<T*>(&a)[I];
+                    }
+
+                    static T min(
+                            __m512i a) {
+                        auto x1 = mm<__m256i, T>::min(_mm512_extracti64x4_epi64(a, 0));
+                        auto x2 = mm<__m256i, T>::min(_mm512_extracti64x4_epi64(a, 1));
+                        return x1 < x2 ? x1 : x2;
+                    }
+
+                    static T max(
+                            __m512i a) {
+                        auto x1 = mm<__m256i, T>::max(_mm512_extracti64x4_epi64(a, 0));
+                        auto x2 = mm<__m256i, T>::max(_mm512_extracti64x4_epi64(a, 1));
+                        return x1 > x2 ? x1 : x2;
+                    }
+
+                    static inline T sum(
+                            __m512i a) {
+                        return static_cast<T>(mm<__m256i, T>::sum(_mm512_extracti64x4_epi64(a, 0)) + mm<__m256i, T>::sum(_mm512_extracti64x4_epi64(a, 1)));
                     }
 
                     static inline __m512i pack_right(
@@ -321,9 +341,9 @@ namespace coding_benchmark {
                         auto pattern1 = _mm512_set1_epi8(0x55);
                         auto pattern2 = _mm512_set1_epi8(0x33);
                         auto pattern3 = _mm512_set1_epi8(0x0F);
-                        auto temp = _mm256_sub_epi8(a, _mm256_and_si256(_mm256_srli_epi16(a, 1), pattern1));
-                        temp = _mm256_add_epi8(_mm256_and_si256(temp, pattern2), _mm256_and_si256(_mm256_srli_epi16(temp, 2), pattern2));
-                        temp = _mm256_add_epi8(_mm256_and_si256(temp, pattern3), _mm256_and_si256(_mm256_srli_epi16(temp, 4), pattern3));
+                        auto temp = _mm512_sub_epi8(a, _mm512_and_si512(_mm512_srli_epi16(a, 1), pattern1));
+                        temp = _mm512_add_epi8(_mm512_and_si512(temp, pattern2), _mm512_and_si512(_mm512_srli_epi16(temp, 2), pattern2));
+                        temp = _mm512_add_epi8(_mm512_and_si512(temp, pattern3), _mm512_and_si512(_mm512_srli_epi16(temp, 4), pattern3));
                         return temp;
 #else
                         auto popcnt0 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 0));
@@ -355,6 +375,36 @@ namespace coding_benchmark {
                         auto popcnt1 = mm<__m256i, T>::popcount3(_mm512_extracti64x4_epi64(a, 1));
                         return _mm512_inserti64x4(_mm512_castsi256_si512(popcnt0), popcnt1, 1);
                     }
+
+                    static inline __m512i cvt_larger_lo(
+                            __m512i a) {
+#ifdef __AVX512BW__
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(a, 0));
+                        } else {
+                            return _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a, 0));
+                        }
+#else
+                        auto x0 = mm<__m256i, T>::cvt_larger_lo(_mm512_extracti64x4_epi64(a, 0));
+                        auto x1 = mm<__m256i, T>::cvt_larger_hi(_mm512_extracti64x4_epi64(a, 0));
+                        return _mm512_inserti64x4(_mm512_castsi256_si512(x0), x1, 1);
+#endif
+                    }
+
+                    static inline __m512i cvt_larger_hi(
+                            __m512i a) {
+#ifdef __AVX512BW__
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(a, 1));
+                        } else {
+                            return _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a, 1));
+                        }
+#else
+                        auto x0 = mm<__m256i, T>::cvt_larger_lo(_mm512_extracti64x4_epi64(a, 1));
+                        auto x1 = mm<__m256i, T>::cvt_larger_hi(_mm512_extracti64x4_epi64(a, 1));
+                        return _mm512_inserti64x4(_mm512_castsi256_si512(x0), x1, 1);
+#endif
+                    }
                 };
 
                 template<typename T, template<typename > class Op>
@@ -736,9 +786,11 @@ namespace coding_benchmark {
                 typedef Private08::_mm512<int8_t> BASE;
                 using BASE::mask_t;
                 using BASE::popcnt_t;
+                using BASE::FULL_MASK;
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -747,8 +799,8 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
@@ -861,9 +913,11 @@ namespace coding_benchmark {
                 typedef Private08::_mm512<uint8_t> BASE;
                 using BASE::mask_t;
                 using BASE::popcnt_t;
+                using BASE::FULL_MASK;
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -872,8 +926,8 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
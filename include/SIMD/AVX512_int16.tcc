@@ -216,9 +216,29 @@ namespace coding_benchmark {
 #endif
                     }
 
-                    static inline uint16_t sum(
+                    template<int I>
+                    static inline T extract(
                             __m512i a) {
-                        throw std::runtime_error("__m512i sum int16_t not supported yet");
+                        return reinterpret_cast<T*>(&a)[I];
+                    }
+
+                    static T min(
+                            __m512i a) {
+                        auto x1 = mm<__m256i, T>::min(_mm512_extracti64x4_epi64(a, 0));
+                        auto x2 = mm<__m256i, T>::min(_mm512_extracti64x4_epi64(a, 1));
+                        return x1 < x2 ? x1 : x2;
+                    }
+
+                    static T max(
+                            __m512i a) {
+                        auto x1 = mm<__m256i, T>::max(_mm512_extracti64x4_epi64(a, 0));
+                        auto x2 = mm<__m256i, T>::max(_mm512_extracti64x4_epi64(a, 1));
+                        return x1 > x2 ? x1 : x2;
+                    }
+
+                    static inline T sum(
+                            __m512i a) {
+                        return static_cast<T>(mm<__m256i, T>::sum(_mm512_extracti64x4_epi64(a, 0)) + mm<__m256i, T>::sum(_mm512_extracti64x4_epi64(a, 1)));
                     }
 
                     static inline __m512i pack_right(
@@ -256,39 +276,17 @@ namespace coding_benchmark {
                     static inline popcnt_t popcount(
                             // TODO
                             __m512i a) {
-#ifdef __AVX512BW__
-                        auto pattern1 = _mm512_set1_epi16(0x5555);
-                        auto pattern2 = _mm512_set1_epi16(0x3333);
-                        auto pattern3 = _mm512_set1_epi16(0x0F0F);
-                        auto pattern4 = _mm512_set1_epi16(0x0101);
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301, 0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301);
-                        auto temp = _mm256_sub_epi16(a, _mm256_and_si256(_mm256_srli_epi16(a, 1), pattern1));
-                        temp = _mm256_add_epi16(_mm256_and_si256(temp, pattern2), _mm256_and_si256(_mm256_srli_epi16(temp, 2), pattern2));
-                        temp = _mm256_and_si256(_mm256_add_epi16(temp, _mm256_srli_epi16(temp, 4)), pattern3);
-                        temp = _mm256_mullo_epi16(temp, pattern4);
-                        temp = _mm256_shuffle_epi8(temp, shuffle);
-                        return _mm_set_epi64x(_mm256_extract_epi64(temp, 2), _mm256_extract_epi64(temp, 0));
-#else
                         auto popcnt0 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 0));
                         auto popcnt1 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 1));
                         return _mm256_inserti128_si256(_mm256_castsi128_si256(popcnt0), popcnt1, 1);
-#endif
                     }
 
                     static inline popcnt_t popcount2(
                             // TODO
                             __m512i a) {
-#ifdef __AVX512BW__
-                        auto mask = _mm256_set1_epi16(0x0101);
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301, 0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301);
-                        auto popcount8 = mm256 < uint16_t > ::popcount2(a);
-                        auto temp = _mm256_shuffle_epi8(_mm256_mullo_epi16(popcount8, mask), shuffle);
-                        return _mm_set_epi64x(_mm256_extract_epi64(temp, 2), _mm256_extract_epi64(temp, 0));
-#else
                         auto popcnt0 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 0));
                         auto popcnt1 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 1));
                         return _mm256_inserti128_si256(_mm256_castsi128_si256(popcnt0), popcnt1, 1);
-#endif
                     }
 
                     static inline popcnt_t popcount3(
@@ -298,6 +296,24 @@ namespace coding_benchmark {
                         auto popcnt1 = mm<__m256i, T>::popcount3(_mm512_extracti64x4_epi64(a, 1));
                         return _mm256_inserti128_si256(_mm256_castsi128_si256(popcnt0), popcnt1, 1);
                     }
+
+                    static inline __m512i cvt_larger_lo(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(a, 0));
+                        } else {
+                            return _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(a, 0));
+                        }
+                    }
+
+                    static inline __m512i cvt_larger_hi(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(a, 1));
+                        } else {
+                            return _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(a, 1));
+                        }
+                    }
                 };
 
                 template<typename T, template<typename > class Op>
@@ -622,10 +638,10 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
 #ifdef __AVX512BW__
-                        return _mm512_add_epi8(a, b);
+                        return _mm512_add_epi16(a, b);
 #else
                         auto mm256 = coding_benchmark::simd::mm_op<__m256i, T, coding_benchmark::add>::add(_mm512_extracti64x4_epi64(a, 0), _mm512_extracti64x4_epi64(b, 0));
-                        auto mm = _mm512_castps256_ps512(mm256);
+                        auto mm = _mm512_castsi256_si512(mm256);
                         mm256 = coding_benchmark::simd::mm_op<__m256i, T, coding_benchmark::add>::add(_mm512_extracti64x4_epi64(a, 1), _mm512_extracti64x4_epi64(b, 1));
                         return _mm512_inserti64x4(mm, mm256, 1);
 #endif
@@ -641,9 +657,18 @@ namespace coding_benchmark {
                         return sub(a, b);
                     }
 
-                    static __m512i sub(
+                    static inline __m512i sub(
                             __m512i a,
-                            __m512i b);
+                            __m512i b) {
+#ifdef __AVX512BW__
+                        return _mm512_sub_epi16(a, b);
+#else
+                        auto mm256 = coding_benchmark::simd::mm_op<__m256i, T, coding_benchmark::sub>::sub(_mm512_extracti64x4_epi64(a, 0), _mm512_extracti64x4_epi64(b, 0));
+                        auto mm = _mm512_castsi256_si512(mm256);
+                        mm256 = coding_benchmark::simd::mm_op<__m256i, T, coding_benchmark::sub>::sub(_mm512_extracti64x4_epi64(a, 1), _mm512_extracti64x4_epi64(b, 1));
+                        return _mm512_inserti64x4(mm, mm256, 1);
+#endif
+                    }
                 };
 
                 template<typename T>
@@ -659,7 +684,7 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
 #ifdef __AVX512BW__
-                        _mm512_mullo_epi16(a, b);
+                        return _mm512_mullo_epi16(a, b);
 #else
                         auto mmA0 = _mm512_extracti64x4_epi64(a, 0);
                         auto mmA1 = _mm512_extracti64x4_epi64(a, 1);
@@ -708,6 +733,7 @@ namespace coding_benchmark {
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -717,14 +743,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<int16_t, std::greater_equal> :
-                    private Private08::_mm512op<int16_t, std::greater_equal> {
-                typedef Private08::_mm512op<int16_t, std::greater_equal> BASE;
+                    private Private16::_mm512op<int16_t, std::greater_equal> {
+                typedef Private16::_mm512op<int16_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -732,8 +758,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, std::greater> :
-                    private Private08::_mm512op<int16_t, std::greater> {
-                typedef Private08::_mm512op<int16_t, std::greater> BASE;
+                    private Private16::_mm512op<int16_t, std::greater> {
+                typedef Private16::_mm512op<int16_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -741,8 +767,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, std::less_equal> :
-                    private Private08::_mm512op<int16_t, std::less_equal> {
-                typedef Private08::_mm512op<int16_t, std::less_equal> BASE;
+                    private Private16::_mm512op<int16_t, std::less_equal> {
+                typedef Private16::_mm512op<int16_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -750,8 +776,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, std::less> :
-                    private Private08::_mm512op<int16_t, std::less> {
-                typedef Private08::_mm512op<int16_t, std::less> BASE;
+                    private Private16::_mm512op<int16_t, std::less> {
+                typedef Private16::_mm512op<int16_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -759,8 +785,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, std::equal_to> :
-                    private Private08::_mm512op<int16_t, std::equal_to> {
-                typedef Private08::_mm512op<int16_t, std::equal_to> BASE;
+                    private Private16::_mm512op<int16_t, std::equal_to> {
+                typedef Private16::_mm512op<int16_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -768,8 +794,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, std::not_equal_to> :
-                    private Private08::_mm512op<int16_t, std::not_equal_to> {
-                typedef Private08::_mm512op<int16_t, std::not_equal_to> BASE;
+                    private Private16::_mm512op<int16_t, std::not_equal_to> {
+                typedef Private16::_mm512op<int16_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -777,8 +803,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::and_is> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::and_is> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -786,8 +812,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::or_is> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::or_is> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<int16_t, coding_benchmark::xor_is> :
+                    private Private16::_mm512op<int16_t, coding_benchmark::xor_is> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -795,32 +830,32 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int16_t, coding_benchmark::add> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::add> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::add> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int16_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::sub> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::sub> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int16_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::mul> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::mul> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int16_t, coding_benchmark::div> :
-                    private Private08::_mm512op<int16_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<int16_t, coding_benchmark::div> BASE;
+                    private Private16::_mm512op<int16_t, coding_benchmark::div> {
+                typedef Private16::_mm512op<int16_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
@@ -835,6 +870,7 @@ namespace coding_benchmark {
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -844,14 +880,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<uint16_t, std::greater_equal> :
-                    private Private08::_mm512op<uint16_t, std::greater_equal> {
-                typedef Private08::_mm512op<uint16_t, std::greater_equal> BASE;
+                    private Private16::_mm512op<uint16_t, std::greater_equal> {
+                typedef Private16::_mm512op<uint16_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -859,8 +895,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, std::greater> :
-                    private Private08::_mm512op<uint16_t, std::greater> {
-                typedef Private08::_mm512op<uint16_t, std::greater> BASE;
+                    private Private16::_mm512op<uint16_t, std::greater> {
+                typedef Private16::_mm512op<uint16_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -868,8 +904,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, std::less_equal> :
-                    private Private08::_mm512op<uint16_t, std::less_equal> {
-                typedef Private08::_mm512op<uint16_t, std::less_equal> BASE;
+                    private Private16::_mm512op<uint16_t, std::less_equal> {
+                typedef Private16::_mm512op<uint16_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -877,8 +913,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, std::less> :
-                    private Private08::_mm512op<uint16_t, std::less> {
-                typedef Private08::_mm512op<uint16_t, std::less> BASE;
+                    private Private16::_mm512op<uint16_t, std::less> {
+                typedef Private16::_mm512op<uint16_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -886,8 +922,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, std::equal_to> :
-                    private Private08::_mm512op<uint16_t, std::equal_to> {
-                typedef Private08::_mm512op<uint16_t, std::equal_to> BASE;
+                    private Private16::_mm512op<uint16_t, std::equal_to> {
+                typedef Private16::_mm512op<uint16_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -895,8 +931,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, std::not_equal_to> :
-                    private Private08::_mm512op<uint16_t, std::not_equal_to> {
-                typedef Private08::_mm512op<uint16_t, std::not_equal_to> BASE;
+                    private Private16::_mm512op<uint16_t, std::not_equal_to> {
+                typedef Private16::_mm512op<uint16_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -904,8 +940,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::and_is> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::and_is> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -913,8 +949,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::or_is> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::or_is> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<uint16_t, coding_benchmark::xor_is> :
+                    private Private16::_mm512op<uint16_t, coding_benchmark::xor_is> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -922,32 +967,32 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::add> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::add> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::add> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::sub> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::sub> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::mul> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::mul> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint16_t, coding_benchmark::div> :
-                    private Private08::_mm512op<uint16_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<uint16_t, coding_benchmark::div> BASE;
+                    private Private16::_mm512op<uint16_t, coding_benchmark::div> {
+                typedef Private16::_mm512op<uint16_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
@@ -162,9 +162,33 @@ namespace coding_benchmark {
                         return _mm512_cmpge_epu32_mask(a, b);
                     }
 
-                    static inline uint8_t sum(
+                    template<int I>
+                    static inline T extract(
                             __m512i a) {
-                        throw std::runtime_error("__m512i sum uint32_t not supported yet");
+                        return reinterpret_cast<T*>(&a)[I];
+                    }
+
+                    static T min(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return static_cast<T>(_mm512_reduce_min_epi32(a));
+                        } else {
+                            return static_cast<T>(_mm512_reduce_min_epu32(a));
+                        }
+                    }
+
+                    static T max(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return static_cast<T>(_mm512_reduce_max_epi32(a));
+                        } else {
+                            return static_cast<T>(_mm512_reduce_max_epu32(a));
+                        }
+                    }
+
+                    static inline T sum(
+                            __m512i a) {
+                        return static_cast<T>(_mm512_reduce_add_epi32(a));
                     }
 
                     static inline __m512i pack_right(
@@ -202,51 +226,17 @@ namespace coding_benchmark {
                     static inline popcnt_t popcount(
                             // TODO
                             __m512i a) {
-                        auto pattern1 = set1(0x55555555);
-                        auto pattern2 = set1(0x33333333);
-                        auto pattern3 = set1(0x0F0F0F0F);
-                        auto pattern4 = set1(0x01010101);
-#ifdef __AVX512BW__
-                        auto shuffle = set(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x3F3B37332F2B2723ull, 0x1F1B17130F0B0703ull);
-#else
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFFull, 0x000000000F0B0703ull, 0xFFFFFFFFFFFFFFFFull, 0x000000000F0B0703ull);
-#endif
-                        auto temp = _mm512_sub_epi64(a, _mm512_and_si512(_mm512_srli_epi64(a, 1), pattern1));
-#ifdef __AVX512BW__
-                        temp = _mm512_add_epi16(_mm512_and_si512(temp, pattern2), _mm512_and_si512(_mm512_srli_epi16(temp, 2), pattern2));
-#else
-                        auto tempX = _mm512_and_si512(temp, pattern2);
-                        auto tempY = _mm512_and_si512(_mm512_srli_epi32(temp, 2), pattern2);
-                        auto temp0 = _mm256_add_epi16(_mm512_castsi512_si256(tempX), _mm512_castsi512_si256(tempX));
-                        auto temp1 = _mm256_add_epi16(_mm512_extracti64x4_epi64(tempX, 1), _mm512_extracti64x4_epi64(tempY, 1));
-                        temp = _mm512_inserti64x4(_mm512_castsi256_si512(temp0), temp1, 1);
-#endif
-                        temp = _mm512_and_si512(_mm512_add_epi64(temp, _mm512_srli_epi64(temp, 4)), pattern3);
-                        temp = mm512op<T,coding_benchmark::mul>::mullo(temp, pattern4);
-#ifdef __AVX512BW__
-                        temp = _mm512_shuffle_epi8(temp, shuffle);
-                        return _mm512_castsi512_si128(temp);
-#else
-                        auto mm0 = _mm256_shuffle_epi8(_mm512_extracti64x4_epi64(temp, 0), shuffle);
-                        auto mm1 = _mm256_shuffle_epi8(_mm512_extracti64x4_epi64(temp, 1), shuffle);
-                        return _mm_set_epi32(_mm256_extract_epi32(mm1, 4), _mm256_extract_epi32(mm1, 0), _mm256_extract_epi32(mm0, 4), _mm256_extract_epi32(mm0, 0));
-#endif
+                        auto popcnt0 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 0));
+                        auto popcnt1 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 1));
+                        return _mm_set_epi64x(popcnt1, popcnt0);
                     }
 
                     static inline popcnt_t popcount2(
                             // TODO
                             __m512i a) {
-#ifdef __AVX512BW__
-                        auto mask = _mm256_set1_epi16(0x0101);
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301, 0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301);
-                        auto popcount8 = mm256 < uint8_t > ::popcount2(a);
-                        auto temp = _mm256_shuffle_epi8(_mm256_mullo_epi16(popcount8, mask), shuffle);
-                        return _mm_set_epi64x(_mm256_extract_epi64(temp, 2), _mm256_extract_epi64(temp, 0));
-#else
                         auto popcnt0 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 0));
                         auto popcnt1 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 1));
                         return _mm_set_epi64x(popcnt1, popcnt0);
-#endif
                     }
 
                     static inline popcnt_t popcount3(
@@ -256,6 +246,24 @@ namespace coding_benchmark {
                         auto popcnt1 = mm<__m256i, T>::popcount3(_mm512_extracti64x4_epi64(a, 1));
                         return _mm_set_epi64x(popcnt1, popcnt0);
                     }
+
+                    static inline __m512i cvt_larger_lo(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a, 0));
+                        } else {
+                            return _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(a, 0));
+                        }
+                    }
+
+                    static inline __m512i cvt_larger_hi(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a, 1));
+                        } else {
+                            return _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(a, 1));
+                        }
+                    }
                 };
 
                 template<typename T, template<typename > class Op>
@@ -270,9 +278,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpgt_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpgt_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpgt_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpgt_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -296,9 +304,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpge_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpge_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpge_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpge_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -322,9 +330,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmplt_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmplt_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmplt_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmplt_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -348,9 +356,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmple_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmple_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmple_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmple_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -374,9 +382,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpeq_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpeq_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpeq_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpeq_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -400,9 +408,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpneq_epi32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpneq_epi32_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpneq_epu32_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi32(_mm512_setzero_epi32(), _mm512_cmpneq_epu32_mask(a, b), -1);
                         }
                     }
 
@@ -563,6 +571,7 @@ namespace coding_benchmark {
                     static inline __m512i div(
                             __m512i a,
                             __m512i b) {
+                        // _mm512_div_pd rounds, so convert back with truncation to match integer division
                         if constexpr (std::is_signed_v<T>) {
                             auto mmA0 = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 0));
                             auto mmA1 = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1));
@@ -570,8 +579,8 @@ namespace coding_benchmark {
                             auto mmB1 = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1));
                             auto mm0 = _mm512_div_pd(mmA0, mmB0);
                             auto mm1 = _mm512_div_pd(mmA1, mmB1);
-                            auto mmX0 = _mm512_cvtpd_epi32(mm0);
-                            auto mmX1 = _mm512_cvtpd_epi32(mm1);
+                            auto mmX0 = _mm512_cvttpd_epi32(mm0);
+                            auto mmX1 = _mm512_cvttpd_epi32(mm1);
                             return _mm512_inserti32x8(_mm512_castsi256_si512(mmX0), mmX1, 1);
                         } else {
                             auto mmA0 = _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(a, 0));
@@ -580,8 +589,8 @@ namespace coding_benchmark {
                             auto mmB1 = _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(b, 1));
                             auto mm0 = _mm512_div_pd(mmA0, mmB0);
                             auto mm1 = _mm512_div_pd(mmA1, mmB1);
-                            auto mmX0 = _mm512_cvtpd_epu32(mm0);
-                            auto mmX1 = _mm512_cvtpd_epu32(mm1);
+                            auto mmX0 = _mm512_cvttpd_epu32(mm0);
+                            auto mmX1 = _mm512_cvttpd_epu32(mm1);
                             return _mm512_inserti32x8(_mm512_castsi256_si512(mmX0), mmX1, 1);
                         }
                     }
@@ -599,6 +608,7 @@ namespace coding_benchmark {
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -608,14 +618,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<int32_t, std::greater_equal> :
-                    private Private08::_mm512op<int32_t, std::greater_equal> {
-                typedef Private08::_mm512op<int32_t, std::greater_equal> BASE;
+                    private Private32::_mm512op<int32_t, std::greater_equal> {
+                typedef Private32::_mm512op<int32_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -623,8 +633,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, std::greater> :
-                    private Private08::_mm512op<int32_t, std::greater> {
-                typedef Private08::_mm512op<int32_t, std::greater> BASE;
+                    private Private32::_mm512op<int32_t, std::greater> {
+                typedef Private32::_mm512op<int32_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -632,8 +642,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, std::less_equal> :
-                    private Private08::_mm512op<int32_t, std::less_equal> {
-                typedef Private08::_mm512op<int32_t, std::less_equal> BASE;
+                    private Private32::_mm512op<int32_t, std::less_equal> {
+                typedef Private32::_mm512op<int32_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -641,8 +651,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, std::less> :
-                    private Private08::_mm512op<int32_t, std::less> {
-                typedef Private08::_mm512op<int32_t, std::less> BASE;
+                    private Private32::_mm512op<int32_t, std::less> {
+                typedef Private32::_mm512op<int32_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -650,8 +660,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, std::equal_to> :
-                    private Private08::_mm512op<int32_t, std::equal_to> {
-                typedef Private08::_mm512op<int32_t, std::equal_to> BASE;
+                    private Private32::_mm512op<int32_t, std::equal_to> {
+                typedef Private32::_mm512op<int32_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -659,8 +669,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, std::not_equal_to> :
-                    private Private08::_mm512op<int32_t, std::not_equal_to> {
-                typedef Private08::_mm512op<int32_t, std::not_equal_to> BASE;
+                    private Private32::_mm512op<int32_t, std::not_equal_to> {
+                typedef Private32::_mm512op<int32_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -668,8 +678,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::and_is> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::and_is> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -677,8 +687,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::or_is> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::or_is> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<int32_t, coding_benchmark::xor_is> :
+                    private Private32::_mm512op<int32_t, coding_benchmark::xor_is> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -686,32 +705,32 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int32_t, coding_benchmark::add> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::add> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::add> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int32_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::sub> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::sub> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int32_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::mul> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::mul> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int32_t, coding_benchmark::div> :
-                    private Private08::_mm512op<int32_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<int32_t, coding_benchmark::div> BASE;
+                    private Private32::_mm512op<int32_t, coding_benchmark::div> {
+                typedef Private32::_mm512op<int32_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
@@ -726,6 +745,7 @@ namespace coding_benchmark {
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -734,14 +754,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<uint32_t, std::greater_equal> :
-                    private Private08::_mm512op<uint32_t, std::greater_equal> {
-                typedef Private08::_mm512op<uint32_t, std::greater_equal> BASE;
+                    private Private32::_mm512op<uint32_t, std::greater_equal> {
+                typedef Private32::_mm512op<uint32_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -749,8 +769,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, std::greater> :
-                    private Private08::_mm512op<uint32_t, std::greater> {
-                typedef Private08::_mm512op<uint32_t, std::greater> BASE;
+                    private Private32::_mm512op<uint32_t, std::greater> {
+                typedef Private32::_mm512op<uint32_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -758,8 +778,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, std::less_equal> :
-                    private Private08::_mm512op<uint32_t, std::less_equal> {
-                typedef Private08::_mm512op<uint32_t, std::less_equal> BASE;
+                    private Private32::_mm512op<uint32_t, std::less_equal> {
+                typedef Private32::_mm512op<uint32_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -767,8 +787,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, std::less> :
-                    private Private08::_mm512op<uint32_t, std::less> {
-                typedef Private08::_mm512op<uint32_t, std::less> BASE;
+                    private Private32::_mm512op<uint32_t, std::less> {
+                typedef Private32::_mm512op<uint32_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -776,8 +796,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, std::equal_to> :
-                    private Private08::_mm512op<uint32_t, std::equal_to> {
-                typedef Private08::_mm512op<uint32_t, std::equal_to> BASE;
+                    private Private32::_mm512op<uint32_t, std::equal_to> {
+                typedef Private32::_mm512op<uint32_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -785,8 +805,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, std::not_equal_to> :
-                    private Private08::_mm512op<uint32_t, std::not_equal_to> {
-                typedef Private08::_mm512op<uint32_t, std::not_equal_to> BASE;
+                    private Private32::_mm512op<uint32_t, std::not_equal_to> {
+                typedef Private32::_mm512op<uint32_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -794,8 +814,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::and_is> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::and_is> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -803,8 +823,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::or_is> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::or_is> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<uint32_t, coding_benchmark::xor_is> :
+                    private Private32::_mm512op<uint32_t, coding_benchmark::xor_is> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -812,32 +841,32 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::add> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::add> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::add> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::sub> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::sub> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::mul> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::mul> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint32_t, coding_benchmark::div> :
-                    private Private08::_mm512op<uint32_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<uint32_t, coding_benchmark::div> BASE;
+                    private Private32::_mm512op<uint32_t, coding_benchmark::div> {
+                typedef Private32::_mm512op<uint32_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
@@ -125,9 +125,33 @@ namespace coding_benchmark {
                         }
                     }
 
-                    static inline uint8_t sum(
+                    template<int I>
+                    static inline T extract(
                             __m512i a) {
-                        throw std::runtime_error("__m512i sum uint64_t not supported yet");
+                        return reinterpret_cast<T*>(&a)[I];
+                    }
+
+                    static T min(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return static_cast<T>(_mm512_reduce_min_epi64(a));
+                        } else {
+                            return static_cast<T>(_mm512_reduce_min_epu64(a));
+                        }
+                    }
+
+                    static T max(
+                            __m512i a) {
+                        if constexpr (std::is_signed_v<T>) {
+                            return static_cast<T>(_mm512_reduce_max_epi64(a));
+                        } else {
+                            return static_cast<T>(_mm512_reduce_max_epu64(a));
+                        }
+                    }
+
+                    static inline T sum(
+                            __m512i a) {
+                        return static_cast<T>(_mm512_reduce_add_epi64(a));
                     }
 
                     static inline __m512i pack_right(
@@ -165,44 +189,17 @@ namespace coding_benchmark {
                     static inline popcnt_t popcount(
                             // TODO
                             __m512i a) {
-                        auto pattern1 = set1(0x5555555555555555ull);
-                        auto pattern2 = set1(0x3333333333333333ull);
-                        auto pattern3 = set1(0x0F0F0F0F0F0F0F0Full);
-                        auto pattern4 = set1(0x0101010101010101ull);
-#ifdef __AVX512BW__
-                        auto shuffle = set(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x3F372F271F170F07ull);
-#else
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0F07ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0F07ull);
-#endif
-                        auto temp = _mm512_sub_epi64(a, _mm512_and_si512(_mm512_srli_epi64(a, 1), pattern1));
-                        temp = _mm512_add_epi16(_mm512_and_si512(temp, pattern2), _mm512_and_si512(_mm512_srli_epi16(temp, 2), pattern2));
-                        temp = _mm512_and_si512(_mm512_add_epi64(temp, _mm512_srli_epi64(temp, 4)), pattern3);
-                        temp = mm512op<T,coding_benchmark::mul>::mullo(temp, pattern4);
-#ifdef __AVX512BW__
-                        temp = _mm512_shuffle_epi8(temp, shuffle);
-                        return static_cast<uint64_t>(temp);
-#else
-                        auto mm0 = _mm256_shuffle_epi8(_mm512_extracti64x4_epi64(temp, 0), shuffle);
-                        auto mm1 = _mm256_shuffle_epi8(_mm512_extracti64x4_epi64(temp, 1), shuffle);
-                        auto mm2 = _mm_set_epi16(0, 0, 0, 0, _mm256_extract_epi16(mm1, 8), _mm256_extract_epi16(mm1, 0), _mm256_extract_epi16(mm0, 8), _mm256_extract_epi16(mm0, 0));
-                        return _mm_extract_epi64(mm2, 0);
-#endif
+                        auto popcnt0 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 0));
+                        auto popcnt1 = mm<__m256i, T>::popcount(_mm512_extracti64x4_epi64(a, 1));
+                        return (static_cast<uint64_t>(popcnt1) << 32) | static_cast<uint64_t>(popcnt0);
                     }
 
                     static inline popcnt_t popcount2(
                             // TODO
                             __m512i a) {
-#ifdef __AVX512BW__
-                        auto mask = _mm256_set1_epi16(0x0101);
-                        auto shuffle = _mm256_set_epi64x(0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301, 0xFFFFFFFFFFFFFFFF, 0x0F0D0B0907050301);
-                        auto popcount8 = mm256 < uint8_t > ::popcount2(a);
-                        auto temp = _mm256_shuffle_epi8(_mm256_mullo_epi16(popcount8, mask), shuffle);
-                        return _mm_set_epi64x(_mm256_extract_epi64(temp, 2), _mm256_extract_epi64(temp, 0));
-#else
                         auto popcnt0 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 0));
                         auto popcnt1 = mm<__m256i, T>::popcount2(_mm512_extracti64x4_epi64(a, 1));
                         return (static_cast<uint64_t>(popcnt1) << 32) | static_cast<uint64_t>(popcnt0);
-#endif
                     }
 
                     static inline popcnt_t popcount3(
@@ -212,6 +209,26 @@ namespace coding_benchmark {
                         auto popcnt1 = mm<__m256i, T>::popcount3(_mm512_extracti64x4_epi64(a, 1));
                         return (static_cast<uint64_t>(popcnt1) << 32) | static_cast<uint64_t>(popcnt0);
                     }
+
+                    static inline __m512i cvt_larger_lo(
+                            __m512i a) {
+                        auto x = _mm512_permutexvar_epi64(_mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0), a);
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_mask_blend_epi64(0xAA, x, _mm512_srai_epi64(x, 63));
+                        } else {
+                            return _mm512_maskz_mov_epi64(0x55, x);
+                        }
+                    }
+
+                    static inline __m512i cvt_larger_hi(
+                            __m512i a) {
+                        auto x = _mm512_permutexvar_epi64(_mm512_set_epi64(7, 7, 6, 6, 5, 5, 4, 4), a);
+                        if constexpr (std::is_signed_v<T>) {
+                            return _mm512_mask_blend_epi64(0xAA, x, _mm512_srai_epi64(x, 63));
+                        } else {
+                            return _mm512_maskz_mov_epi64(0x55, x);
+                        }
+                    }
                 };
 
                 template<typename T, template<typename > class Op>
@@ -226,9 +243,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpgt_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpgt_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpgt_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpgt_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -252,9 +269,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpge_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpge_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpge_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpge_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -278,9 +295,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmplt_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmplt_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmplt_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmplt_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -304,9 +321,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmple_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmple_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmple_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmple_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -330,9 +347,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpeq_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpeq_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpeq_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpeq_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -356,9 +373,9 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpneq_epi64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpneq_epi64_mask(a, b), -1);
                         } else {
-                            return _mm512_mask_set1_epi16(_mm512_setzero_epi32(), _mm512_cmpneq_epu64_mask(a, b), static_cast<char>(0xFF));
+                            return _mm512_mask_set1_epi64(_mm512_setzero_epi32(), _mm512_cmpneq_epu64_mask(a, b), -1);
                         }
                     }
 
@@ -526,10 +543,11 @@ namespace coding_benchmark {
                             __m512i a,
                             __m512i b) {
 #ifdef __AVX512DQ__
+                        // _mm512_div_pd rounds, so convert back with truncation to match integer division
                         if constexpr (std::is_signed_v<T>) {
-                            return _mm512_cvtpd_epi64(_mm512_div_pd(_mm512_cvtepi64_pd(a), _mm512_cvtepi64_pd(b)));
+                            return _mm512_cvttpd_epi64(_mm512_div_pd(_mm512_cvtepi64_pd(a), _mm512_cvtepi64_pd(b)));
                         } else {
-                            return _mm512_cvtpd_epu64(_mm512_div_pd(_mm512_cvtepu64_pd(a), _mm512_cvtepu64_pd(b)));
+                            return _mm512_cvttpd_epu64(_mm512_div_pd(_mm512_cvtepu64_pd(a), _mm512_cvtepu64_pd(b)));
                         }
 #else
                         auto r0 = mm_op<__m256i, T, coding_benchmark::div>::div(_mm512_extracti64x4_epi64(a, 0), _mm512_extracti64x4_epi64(b, 0));
@@ -543,14 +561,15 @@ namespace coding_benchmark {
 
             template<>
             struct mm512<int64_t> :
-                    public Private32::_mm512<int64_t> {
-                typedef Private32::_mm512<int64_t> BASE;
+                    public Private64::_mm512<int64_t> {
+                typedef Private64::_mm512<int64_t> BASE;
                 using BASE::mask_t;
                 using BASE::popcnt_t;
                 using BASE::FULL_MASK;
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -560,14 +579,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<int64_t, std::greater_equal> :
-                    private Private08::_mm512op<int64_t, std::greater_equal> {
-                typedef Private08::_mm512op<int64_t, std::greater_equal> BASE;
+                    private Private64::_mm512op<int64_t, std::greater_equal> {
+                typedef Private64::_mm512op<int64_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -575,8 +594,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, std::greater> :
-                    private Private08::_mm512op<int64_t, std::greater> {
-                typedef Private08::_mm512op<int64_t, std::greater> BASE;
+                    private Private64::_mm512op<int64_t, std::greater> {
+                typedef Private64::_mm512op<int64_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -584,8 +603,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, std::less_equal> :
-                    private Private08::_mm512op<int64_t, std::less_equal> {
-                typedef Private08::_mm512op<int64_t, std::less_equal> BASE;
+                    private Private64::_mm512op<int64_t, std::less_equal> {
+                typedef Private64::_mm512op<int64_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -593,8 +612,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, std::less> :
-                    private Private08::_mm512op<int64_t, std::less> {
-                typedef Private08::_mm512op<int64_t, std::less> BASE;
+                    private Private64::_mm512op<int64_t, std::less> {
+                typedef Private64::_mm512op<int64_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -602,8 +621,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, std::equal_to> :
-                    private Private08::_mm512op<int64_t, std::equal_to> {
-                typedef Private08::_mm512op<int64_t, std::equal_to> BASE;
+                    private Private64::_mm512op<int64_t, std::equal_to> {
+                typedef Private64::_mm512op<int64_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -611,8 +630,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, std::not_equal_to> :
-                    private Private08::_mm512op<int64_t, std::not_equal_to> {
-                typedef Private08::_mm512op<int64_t, std::not_equal_to> BASE;
+                    private Private64::_mm512op<int64_t, std::not_equal_to> {
+                typedef Private64::_mm512op<int64_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -620,8 +639,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::and_is> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::and_is> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -629,8 +648,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::or_is> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::or_is> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<int64_t, coding_benchmark::xor_is> :
+                    private Private64::_mm512op<int64_t, coding_benchmark::xor_is> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -638,46 +666,47 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<int64_t, coding_benchmark::add> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::add> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::add> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int64_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::sub> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::sub> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int64_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::mul> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::mul> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<int64_t, coding_benchmark::div> :
-                    private Private08::_mm512op<int64_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<int64_t, coding_benchmark::div> BASE;
+                    private Private64::_mm512op<int64_t, coding_benchmark::div> {
+                typedef Private64::_mm512op<int64_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
 
             template<>
             struct mm512<uint64_t> :
-                    public Private32::_mm512<uint64_t> {
-                typedef Private32::_mm512<uint64_t> BASE;
+                    public Private64::_mm512<uint64_t> {
+                typedef Private64::_mm512<uint64_t> BASE;
                 using BASE::mask_t;
                 using BASE::popcnt_t;
                 using BASE::FULL_MASK;
                 using BASE::set1;
                 using BASE::set;
                 using BASE::set_inc;
+                using BASE::extract;
                 using BASE::min;
                 using BASE::max;
                 using BASE::sum;
@@ -686,14 +715,14 @@ namespace coding_benchmark {
                 using BASE::popcount;
                 using BASE::popcount2;
                 using BASE::popcount3;
-                // TODO using BASE::cvt_larger_lo;
-                // TODO using BASE::cvt_larger_hi;
+                using BASE::cvt_larger_lo;
+                using BASE::cvt_larger_hi;
             };
 
             template<>
             struct mm512op<uint64_t, std::greater_equal> :
-                    private Private08::_mm512op<uint64_t, std::greater_equal> {
-                typedef Private08::_mm512op<uint64_t, std::greater_equal> BASE;
+                    private Private64::_mm512op<uint64_t, std::greater_equal> {
+                typedef Private64::_mm512op<uint64_t, std::greater_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -701,8 +730,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, std::greater> :
-                    private Private08::_mm512op<uint64_t, std::greater> {
-                typedef Private08::_mm512op<uint64_t, std::greater> BASE;
+                    private Private64::_mm512op<uint64_t, std::greater> {
+                typedef Private64::_mm512op<uint64_t, std::greater> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -710,8 +739,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, std::less_equal> :
-                    private Private08::_mm512op<uint64_t, std::less_equal> {
-                typedef Private08::_mm512op<uint64_t, std::less_equal> BASE;
+                    private Private64::_mm512op<uint64_t, std::less_equal> {
+                typedef Private64::_mm512op<uint64_t, std::less_equal> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -719,8 +748,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, std::less> :
-                    private Private08::_mm512op<uint64_t, std::less> {
-                typedef Private08::_mm512op<uint64_t, std::less> BASE;
+                    private Private64::_mm512op<uint64_t, std::less> {
+                typedef Private64::_mm512op<uint64_t, std::less> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -728,8 +757,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, std::equal_to> :
-                    private Private08::_mm512op<uint64_t, std::equal_to> {
-                typedef Private08::_mm512op<uint64_t, std::equal_to> BASE;
+                    private Private64::_mm512op<uint64_t, std::equal_to> {
+                typedef Private64::_mm512op<uint64_t, std::equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -737,8 +766,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, std::not_equal_to> :
-                    private Private08::_mm512op<uint64_t, std::not_equal_to> {
-                typedef Private08::_mm512op<uint64_t, std::not_equal_to> BASE;
+                    private Private64::_mm512op<uint64_t, std::not_equal_to> {
+                typedef Private64::_mm512op<uint64_t, std::not_equal_to> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -746,8 +775,8 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::and_is> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::and_is> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::and_is> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::and_is> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::and_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -755,8 +784,17 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::or_is> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::or_is> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::or_is> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::or_is> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::or_is> BASE;
+                using BASE::mask_t;
+                using BASE::cmp;
+                using BASE::cmp_mask;
+            };
+
+            template<>
+            struct mm512op<uint64_t, coding_benchmark::xor_is> :
+                    private Private64::_mm512op<uint64_t, coding_benchmark::xor_is> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::xor_is> BASE;
                 using BASE::mask_t;
                 using BASE::cmp;
                 using BASE::cmp_mask;
@@ -764,32 +802,32 @@ namespace coding_benchmark {
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::add> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::add> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::add> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::add> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::add> BASE;
                 using BASE::add;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::sub> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::sub> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::sub> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::sub> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::sub> BASE;
                 using BASE::sub;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::mul> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::mul> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::mul> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::mul> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::mul> BASE;
                 using BASE::mullo;
                 using BASE::compute;
             };
 
             template<>
             struct mm512op<uint64_t, coding_benchmark::div> :
-                    private Private08::_mm512op<uint64_t, coding_benchmark::div> {
-                typedef Private08::_mm512op<uint64_t, coding_benchmark::div> BASE;
+                    private Private64::_mm512op<uint64_t, coding_benchmark::div> {
+                typedef Private64::_mm512op<uint64_t, coding_benchmark::div> BASE;
                 using BASE::div;
                 using BASE::compute;
             };
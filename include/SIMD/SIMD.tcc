@@ -29,6 +29,8 @@
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 
 #include <Util/Intrinsics.hpp>
@@ -229,6 +229,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -238,6 +244,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -247,6 +259,12 @@ namespace coding_benchmark {
             using BASE::mask_t;
             using BASE::cmp;
             using BASE::cmp_mask;
+
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                return cmp(a, b);
+            }
         };
 
         template<typename T>
@@ -290,6 +308,56 @@ namespace coding_benchmark {
             using BASE::compute;
         };
 
+        /**
+         * Complements all bits of a and ignores b (see coding_benchmark::complement).
+         */
+        template<typename T>
+        struct mm_op<__m128i, T, coding_benchmark::complement> {
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                return _mm_xor_si128(a, _mm_set1_epi32(-1));
+            }
+        };
+
+        /**
+         * Shifts all lanes by the first lane of b, modulo the lane width (see coding_benchmark::shift_left). There are
+         * no shifts of 8-bit lanes.
+         */
+        template<typename T>
+        struct mm_op<__m128i, T, coding_benchmark::shift_left> {
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(b) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+                    return _mm_sll_epi16(a, count);
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm_sll_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm_sll_epi64(a, count);
+                }
+            }
+        };
+
+        template<typename T>
+        struct mm_op<__m128i, T, coding_benchmark::shift_right> {
+            static inline __m128i compute(
+                    __m128i a,
+                    __m128i b) {
+                const __m128i count = _mm_cvtsi32_si128(_mm_cvtsi128_si32(b) & static_cast<int>(sizeof(T) * CHAR_BIT - 1));
+                if constexpr (sizeof(T) == 2) {
+                    return _mm_srl_epi16(a, count);
+                } else if constexpr (sizeof(T) == 4) {
+                    return _mm_srl_epi32(a, count);
+                } else {
+                    static_assert(sizeof(T) == 8, "no shifts of 8-bit lanes");
+                    return _mm_srl_epi64(a, count);
+                }
+            }
+        };
+
     }
 }
 
@@ -0,0 +1,120 @@
+// Copyright (c) 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Stream.hpp
+ *
+ * Non-temporal (streaming) stores and software prefetching for kernels which write large output buffers. Streaming
+ * stores write whole cache lines around the caches and thus save reading the target lines first (read for ownership),
+ * which pays off once the output does not fit into the caches anymore.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Util/Intrinsics.hpp>
+
+namespace coding_benchmark {
+
+    static const constexpr size_t STREAM_PREFETCH = 512; // bytes the streaming-store variants (*_nt) prefetch their input ahead
+
+    namespace simd {
+
+        /**
+         * The target must be aligned to sizeof(VEC). Streaming stores are weakly ordered, so call stream_fence() before the
+         * data is read again.
+         */
+        template<typename VEC>
+        struct mm_stream;
+
+        /**
+         * Scalar streaming stores (movnti) exist for 32- and 64-bit words only.
+         */
+        template<>
+        struct mm_stream<uint32_t> {
+            static inline void store(
+                    uint32_t * dst,
+                    uint32_t src) {
+                _mm_stream_si32(reinterpret_cast<int*>(dst), static_cast<int>(src));
+            }
+        };
+
+        template<>
+        struct mm_stream<uint64_t> {
+            static inline void store(
+                    uint64_t * dst,
+                    uint64_t src) {
+                _mm_stream_si64(reinterpret_cast<long long*>(dst), static_cast<long long>(src));
+            }
+        };
+
+#ifdef __SSE4_2__
+        template<>
+        struct mm_stream<__m128i> {
+            static inline void store(
+                    __m128i * dst,
+                    __m128i src) {
+                _mm_stream_si128(dst, src);
+            }
+        };
+#endif /* __SSE4_2__ */
+
+#ifdef __AVX2__
+        template<>
+        struct mm_stream<__m256i> {
+            static inline void store(
+                    __m256i * dst,
+                    __m256i src) {
+                _mm256_stream_si256(dst, src);
+            }
+        };
+#endif /* __AVX2__ */
+
+#ifdef __AVX512F__
+        template<>
+        struct mm_stream<__m512i> {
+            static inline void store(
+                    __m512i * dst,
+                    __m512i src) {
+                _mm512_stream_si512(dst, src);
+            }
+        };
+#endif /* __AVX512F__ */
+
+        template<typename VEC>
+        inline bool is_stream_aligned(
+                const void * ptr) {
+            return (reinterpret_cast<uintptr_t>(ptr) % sizeof(VEC)) == 0;
+        }
+
+        inline void stream_fence() {
+            _mm_sfence();
+        }
+
+        /**
+         * Prefetches the cache line DISTANCE bytes ahead of ptr, bypassing the outer caches as far as the CPU supports it.
+         * DISTANCE 0 disables prefetching. Prefetches never fault, so reading ahead past the end of a buffer is fine.
+         */
+        template<size_t DISTANCE>
+        inline void prefetch_ahead(
+                const void * ptr) {
+            if constexpr (DISTANCE != 0) {
+                _mm_prefetch(reinterpret_cast<const char*>(ptr) + DISTANCE, _MM_HINT_NTA);
+            }
+        }
+
+    }
+}
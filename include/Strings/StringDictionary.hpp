@@ -0,0 +1,525 @@
+// Copyright 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   StringDictionary.hpp
+ *
+ * A sorted string dictionary: all entries encoded one after the other in a contiguous heap plus an array of offsets
+ * into it. Lookups run a branch-free binary search and, like mm_strcmp_lp_xor and mm_strcmp_lp_AN_accu, defer the
+ * verification of all entries they touch to a single check at the end of the lookup.
+ *
+ * The entries and keys are compared a vector (VEC) at a time with the helpers of StringsLP.hpp, and the codecs
+ * accumulate vectors as well. Keys are encoded once with encodeKey and then compared against the encoded entries
+ * directly. This is sound for AN as well, since StringDictionaryAN rejects any A for which A * x could wrap around, so
+ * that the encoding preserves the order of the limbs.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Strings/StringsLP.hpp>
+#include <Util/Euclidean.hpp>
+#include <Util/Helpers.hpp>
+
+namespace Private {
+
+    /*
+     * The first numBytes (<= sizeof(VEC) <= 64) bytes at p and zeros in the remaining lanes. Unlike
+     * lpstr_load_tail, this loads a full vector, which the padding of the dictionary heap allows for.
+     */
+    template<typename VEC>
+    inline VEC strdict_load_partial(
+            const void * p,
+            const size_t numBytes) {
+        alignas(64) static const uint8_t MASKS[128] = {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        return coding_benchmark::simd::mm_op<VEC, uint32_t, coding_benchmark::and_is>::compute(lpstr_loadu<VEC>(p), lpstr_loadu<VEC>(MASKS + 64 - numBytes));
+    }
+
+    /*
+     * The XOR checksum of an entry, the same as lpstr_xor computes, with the tail loaded by strdict_load_partial.
+     */
+    template<typename VEC, typename T>
+    inline VEC strdict_xor(
+            const T * entry,
+            const size_t length) {
+        typedef coding_benchmark::simd::mm_op<VEC, uint32_t, coding_benchmark::xor_is> mmXOR;
+        const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(T);
+        VEC mmXor = coding_benchmark::simd::mm<VEC>::setzero();
+        size_t i = 0;
+        for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+            mmXor = mmXOR::compute(mmXor, lpstr_loadu<VEC>(entry + i));
+        }
+        if (i < length) {
+            mmXor = mmXOR::compute(mmXor, strdict_load_partial<VEC>(entry + i, (length - i) * sizeof(T)));
+        }
+        return mmXor;
+    }
+
+    /*
+     * The lanes of a checksum vector XORed into a single limb. This is the XOR of all limbs of the entry, whatever the
+     * vector width.
+     */
+    template<typename VEC, typename T>
+    inline T strdict_fold(
+            const VEC mm) {
+        T limbs[sizeof(VEC) / sizeof(T)];
+        memcpy(limbs, &mm, sizeof(VEC));
+        T folded = 0;
+        for (const T limb : limbs) {
+            folded ^= limb;
+        }
+        return folded;
+    }
+
+}
+
+namespace coding_benchmark {
+
+    /*
+     * Unprotected baseline.
+     */
+    template<typename VEC, typename DATA>
+    struct StringDictionaryPlain {
+
+        typedef VEC vec_t;
+        typedef DATA raw_t;
+        typedef DATA enc_t;
+
+        struct accumulator_t {
+        };
+
+        DATA encode(
+                const DATA x) const {
+            return x;
+        }
+
+        DATA decode(
+                const DATA x) const {
+            return x;
+        }
+
+        void seal(
+                const DATA *,
+                const size_t) {
+        }
+
+        void visit(
+                accumulator_t &,
+                const size_t,
+                const DATA *,
+                const size_t) const {
+        }
+
+        void account(
+                accumulator_t &,
+                const VEC) const {
+        }
+
+        void verify(
+                const accumulator_t &) const {
+        }
+
+        std::string getName() const {
+            return "Plain";
+        }
+
+        size_t getNumBytes() const {
+            return 0;
+        }
+    };
+
+    /*
+     * An XOR checksum limb per entry: the checksum vector of mm_strxor_lp folded into a single limb, so that the
+     * footprint does not depend on the vector width. A lookup XORs each entry it visits completely and ORs the
+     * differences to the checksums, so that it only branches once on them.
+     */
+    template<typename VEC, typename DATA>
+    struct StringDictionaryXOR {
+
+        typedef VEC vec_t;
+        typedef DATA raw_t;
+        typedef DATA enc_t;
+
+        struct accumulator_t {
+            DATA diff = 0;
+        };
+
+        std::vector<DATA> checksums;
+
+        StringDictionaryXOR()
+                : checksums() {
+        }
+
+        DATA encode(
+                const DATA x) const {
+            return x;
+        }
+
+        DATA decode(
+                const DATA x) const {
+            return x;
+        }
+
+        void seal(
+                const DATA * entry,
+                const size_t length) {
+            checksums.push_back(Private::strdict_fold<VEC, DATA>(Private::strdict_xor<VEC, DATA>(entry, length)));
+        }
+
+        void visit(
+                accumulator_t & accu,
+                const size_t index,
+                const DATA * entry,
+                const size_t length) const {
+            accu.diff |= Private::strdict_fold<VEC, DATA>(Private::strdict_xor<VEC, DATA>(entry, length)) ^ checksums[index];
+        }
+
+        void account(
+                accumulator_t &,
+                const VEC) const {
+        }
+
+        void verify(
+                const accumulator_t & accu) const {
+            if (accu.diff != 0) {
+                throw std::runtime_error("[" __FILE__ "] a dictionary entry visited by the lookup is corrupt");
+            }
+        }
+
+        std::string getName() const {
+            return "XOR";
+        }
+
+        size_t getNumBytes() const {
+            return checksums.size() * sizeof(DATA);
+        }
+    };
+
+    /*
+     * AN coded limbs. As in mm_strcmp_lp_AN_accu, the vectors a lookup compares are summed up in lanes of twice the
+     * width of the code words. The sums are code words themselves as long as they do not overflow, which is why the
+     * accumulator is verified and reset after at most max(accu_t) / A / max(DATARAW) code words per lane. A must be odd
+     * and A * max(DATARAW) must fit into DATAENC, otherwise the encoding would not preserve the order of the limbs.
+     */
+    template<typename VEC, typename DATARAW, typename DATAENC>
+    struct StringDictionaryAN {
+
+        typedef VEC vec_t;
+        typedef DATARAW raw_t;
+        typedef DATAENC enc_t;
+
+        typedef typename Larger<DATAENC>::larger_t accu_t;
+
+        static const constexpr DATAENC dMax = std::numeric_limits<DATARAW>::max();
+        static const constexpr size_t LIMBS_PER_LANE = sizeof(accu_t) / sizeof(DATAENC);
+
+        struct accumulator_t {
+            VEC sum = simd::mm<VEC>::setzero();
+            size_t numVectors = 0;
+        };
+
+        DATAENC A;
+        DATAENC A_INV;
+        accu_t ACCU_A_INV;
+        size_t accuVectors;
+
+        StringDictionaryAN(
+                const DATAENC A)
+                : A(checkA(A)),
+                  A_INV(static_cast<DATAENC>(ext_euclidean(uint64_t(A), sizeof(DATAENC) * CHAR_BIT))),
+                  // one Newton step lifts the inverse of A from modulo 2^|DATAENC| to modulo 2^|accu_t|
+                  ACCU_A_INV(static_cast<accu_t>(static_cast<accu_t>(A_INV) * static_cast<accu_t>(2 - static_cast<accu_t>(A) * A_INV))),
+                  accuVectors(std::max<size_t>(std::numeric_limits<accu_t>::max() / A / dMax / LIMBS_PER_LANE, 1)) {
+        }
+
+        static DATAENC checkA(
+                const DATAENC A) {
+            const DATAENC AMax = std::numeric_limits<DATAENC>::max() / dMax;
+            if (((A & 1) == 0) || (A > AMax)) {
+                throw std::invalid_argument("StringDictionaryAN: A = " + std::to_string(A) + " must be odd and at most " + std::to_string(AMax));
+            }
+            return A;
+        }
+
+        DATAENC encode(
+                const DATARAW x) const {
+            return static_cast<DATAENC>(x * A);
+        }
+
+        DATARAW decode(
+                const DATAENC x) const {
+            const DATAENC dec = static_cast<DATAENC>(x * A_INV);
+            if (dec > dMax) {
+                throw std::runtime_error("[" __FILE__ "] corrupt limb");
+            }
+            return static_cast<DATARAW>(dec);
+        }
+
+        void seal(
+                const DATAENC *,
+                const size_t) {
+        }
+
+        void visit(
+                accumulator_t &,
+                const size_t,
+                const DATAENC *,
+                const size_t) const {
+        }
+
+        void account(
+                accumulator_t & accu,
+                const VEC mm) const {
+            typedef simd::mm<VEC, DATAENC> mmEnc;
+            typedef simd::mm_op<VEC, accu_t, add> mmAccuAdd;
+            accu.sum = mmAccuAdd::compute(accu.sum, mmAccuAdd::compute(mmEnc::cvt_larger_lo(mm), mmEnc::cvt_larger_hi(mm)));
+            if (++accu.numVectors == accuVectors) {
+                verify(accu);
+                accu = accumulator_t();
+            }
+        }
+
+        void verify(
+                const accumulator_t & accu) const {
+            typedef simd::mm<VEC, accu_t> mmAccu;
+            typedef simd::mm_op<VEC, accu_t, std::less_equal> mmAccuLE;
+            const VEC mmAccuMax = mmAccu::set1(static_cast<accu_t>(accu.numVectors * LIMBS_PER_LANE * dMax));
+            if (mmAccuLE::cmp_mask(simd::mm_op<VEC, accu_t, mul>::compute(accu.sum, mmAccu::set1(ACCU_A_INV)), mmAccuMax) != mmAccu::FULL_MASK) {
+                throw std::runtime_error("[" __FILE__ "] a dictionary entry visited by the lookup is corrupt");
+            }
+        }
+
+        std::string getName() const {
+            return "AN " + std::to_string(A);
+        }
+
+        size_t getNumBytes() const {
+            return 0;
+        }
+    };
+
+    template<typename Codec>
+    class StringDictionary {
+
+    public:
+        typedef typename Codec::vec_t vec_t;
+        typedef typename Codec::raw_t raw_t;
+        typedef typename Codec::enc_t enc_t;
+        typedef typename Codec::accumulator_t accumulator_t;
+
+        static const constexpr size_t npos = static_cast<size_t>(-1);
+
+        static const constexpr size_t NUM_LIMBS = sizeof(vec_t) / sizeof(enc_t);
+
+        /**
+         * The comparisons load whole vectors, also beyond the end of an entry or key. Therefore, the heap and each key
+         * must be followed by this many readable limbs, whatever their values.
+         */
+        static const constexpr size_t PADDING = NUM_LIMBS;
+
+    private:
+        Codec codec;
+        std::vector<enc_t> heap;
+        std::vector<size_t> offsets; // entry i spans heap[offsets[i], offsets[i + 1]), followed by PADDING zeros
+
+        /*
+         * Compares entry index against the encoded key. With PREFIX, the entries starting with the key compare equal.
+         * The codec accounts each vector of the entry which is compared. Its lanes beyond the entry hold the following
+         * entry or the zero padding, i.e. code words as well.
+         */
+        template<bool PREFIX>
+        int compare(
+                const size_t index,
+                const enc_t * key,
+                const size_t length,
+                accumulator_t & accu) const {
+            const enc_t * entry = heap.data() + offsets[index];
+            const size_t lengthEntry = offsets[index + 1] - offsets[index];
+            const size_t lengthCommon = std::min(lengthEntry, length);
+            codec.visit(accu, index, entry, lengthEntry);
+            for (size_t i = 0; i < lengthCommon; i += NUM_LIMBS) {
+                const vec_t mmEntry = Private::lpstr_loadu<vec_t>(entry + i);
+                codec.account(accu, mmEntry);
+                const auto eq = simd::mm_op<vec_t, enc_t, std::equal_to>::cmp_mask(mmEntry, Private::lpstr_loadu<vec_t>(key + i));
+                if (eq != simd::mm<vec_t, enc_t>::FULL_MASK) {
+                    const size_t k = i + Private::lpstr_first_mismatch(eq);
+                    if (k < lengthCommon) {
+                        return (entry[k] < key[k]) ? -1 : 1;
+                    }
+                }
+            }
+            if (PREFIX && (lengthEntry >= length)) {
+                return 0;
+            }
+            return (lengthEntry > length) - (lengthEntry < length);
+        }
+
+        /*
+         * Index of the first entry which compares greater (UPPER) or greater or equal (!UPPER) than the key. The search
+         * narrows down the range with conditional moves instead of branches.
+         */
+        template<bool PREFIX, bool UPPER>
+        size_t search(
+                const enc_t * key,
+                const size_t length,
+                accumulator_t & accu) const {
+            size_t n = size();
+            if (n == 0) {
+                return 0;
+            }
+            size_t base = 0;
+            while (n > 1) {
+                const size_t half = n / 2;
+                const int cmp = compare<PREFIX>(base + half, key, length, accu);
+                base = (UPPER ? (cmp <= 0) : (cmp < 0)) ? (base + half) : base;
+                n -= half;
+            }
+            const int cmp = compare<PREFIX>(base, key, length, accu);
+            return base + (UPPER ? (cmp <= 0) : (cmp < 0));
+        }
+
+    public:
+        /**
+         * The raw entries are given in the same form: entry i spans heap[offsets[i], offsets[i + 1]), and have to be
+         * sorted and unique.
+         */
+        StringDictionary(
+                const Codec & codec,
+                const raw_t * rawHeap,
+                const std::vector<size_t> & rawOffsets)
+                : codec(codec),
+                  heap((rawOffsets.empty() ? 0 : rawOffsets.back()) + PADDING),
+                  offsets(rawOffsets) {
+            if (offsets.empty()) {
+                offsets.push_back(0);
+            }
+            for (size_t i = 0; i < offsets.back(); ++i) {
+                heap[i] = this->codec.encode(rawHeap[i]);
+            }
+            for (size_t i = 0; i < size(); ++i) {
+                this->codec.seal(heap.data() + offsets[i], offsets[i + 1] - offsets[i]);
+            }
+        }
+
+        size_t size() const {
+            return offsets.size() - 1;
+        }
+
+        const Codec & getCodec() const {
+            return codec;
+        }
+
+        /**
+         * Memory footprint of the heap, the offsets and any checksums.
+         */
+        size_t getNumBytes() const {
+            return heap.size() * sizeof(enc_t) + offsets.size() * sizeof(size_t) + codec.getNumBytes();
+        }
+
+        /**
+         * The encoded key needs PADDING more limbs, see there.
+         */
+        void encodeKey(
+                const raw_t * key,
+                const size_t length,
+                enc_t * out) const {
+            for (size_t i = 0; i < length; ++i) {
+                out[i] = codec.encode(key[i]);
+            }
+        }
+
+        /**
+         * Decodes entry index into out and returns its length.
+         */
+        size_t extract(
+                const size_t index,
+                raw_t * out) const {
+            const size_t length = offsets[index + 1] - offsets[index];
+            const enc_t * entry = heap.data() + offsets[index];
+            for (size_t i = 0; i < length; ++i) {
+                out[i] = codec.decode(entry[i]);
+            }
+            return length;
+        }
+
+        /**
+         * Index of the first entry not less than the key.
+         */
+        size_t lowerBound(
+                const enc_t * key,
+                const size_t length) const {
+            accumulator_t accu;
+            const size_t result = search<false, false>(key, length, accu);
+            codec.verify(accu);
+            return result;
+        }
+
+        /**
+         * Index of the entry equal to the key or npos.
+         */
+        size_t find(
+                const enc_t * key,
+                const size_t length) const {
+            accumulator_t accu;
+            size_t result = search<false, false>(key, length, accu);
+            if ((result == size()) || (compare<false>(result, key, length, accu) != 0)) {
+                result = npos;
+            }
+            codec.verify(accu);
+            return result;
+        }
+
+        /**
+         * The range of indices [first, second) of the entries which start with the prefix.
+         */
+        std::pair<size_t, size_t> findPrefix(
+                const enc_t * prefix,
+                const size_t length) const {
+            accumulator_t accu;
+            const size_t first = search<false, false>(prefix, length, accu);
+            const size_t last = search<true, true>(prefix, length, accu);
+            codec.verify(accu);
+            return std::make_pair(first, last);
+        }
+
+        /**
+         * The range of indices [first, second) of the entries between lo and hi, both inclusive.
+         */
+        std::pair<size_t, size_t> findRange(
+                const enc_t * lo,
+                const size_t lengthLo,
+                const enc_t * hi,
+                const size_t lengthHi) const {
+            accumulator_t accu;
+            const size_t first = search<false, false>(lo, lengthLo, accu);
+            const size_t last = search<false, true>(hi, lengthHi, accu);
+            codec.verify(accu);
+            return std::make_pair(first, std::max(first, last));
+        }
+    };
+
+}
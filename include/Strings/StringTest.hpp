@@ -0,0 +1,354 @@
+// Copyright 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   StringTest.hpp
+ *
+ * The length-prefixed string comparisons of StringsLP.hpp as tests for the standard harness. Encoding turns the raw
+ * column of numValues limbs into two strings, the second of which differs from the first in at most one limb. The check
+ * sub test times their comparison, which verifies the strings where the code allows it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <limits>
+
+#include <Util/Test.hpp>
+#include <Util/ErrorInfo.hpp>
+#include <Util/Intrinsics.hpp>
+#include <Strings/StringsLP.hpp>
+
+namespace coding_benchmark {
+
+    template<typename DATARAW, typename DATAENC>
+    class StringTest :
+            public Test<DATARAW, DATAENC> {
+
+    protected:
+        double mismatchRatio; // position of the differing limb relative to the length, >= 1: both strings are equal
+        int expected; // sign of the comparison result, set in PreCheck
+
+    public:
+        StringTest(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const double mismatchRatio = 1.0)
+                : Test<DATARAW, DATAENC>(name, bufRaw, bufEncoded, bufResult),
+                  mismatchRatio(mismatchRatio),
+                  expected(0) {
+        }
+
+        virtual ~StringTest() {
+        }
+
+        /**
+         * Bytes per string in the encoded buffer, rounded up to whole cache lines so that both strings start aligned.
+         */
+        static size_t getStringNumBytes(
+                const size_t numValues) {
+            return ((LPString<DATAENC>::numBytes(numValues) + 63) / 64) * 64;
+        }
+
+        static size_t getEncodedNumBytes(
+                const size_t numValues) {
+            return 2 * getStringNumBytes(numValues);
+        }
+
+        static void * getString(
+                const AlignedBlock & buf,
+                const size_t numValues,
+                const size_t index) {
+            return buf.template begin<char>() + index * getStringNumBytes(numValues);
+        }
+
+        size_t getMismatch(
+                const size_t numValues) const {
+            return std::min(static_cast<size_t>(mismatchRatio * numValues), numValues);
+        }
+
+        // the raw limb which replaces the one at the mismatch in the second string
+        static DATARAW getOther(
+                const DATARAW x) {
+            return static_cast<DATARAW>(x + 1);
+        }
+
+        template<typename Encoder>
+        void EncodeStrings(
+                const EncodeConfiguration & config,
+                Encoder encoder) {
+            auto in = config.source.template begin<DATARAW>();
+            auto out1 = LPString<DATAENC>::init(getString(config.target, config.numValues, 0), config.numValues);
+            auto out2 = LPString<DATAENC>::init(getString(config.target, config.numValues, 1), config.numValues);
+            for (size_t i = 0; i < config.numValues; ++i) {
+                out1[i] = out2[i] = encoder(in[i]);
+            }
+            const size_t mismatch = getMismatch(config.numValues);
+            if (mismatch < config.numValues) {
+                out2[mismatch] = encoder(getOther(in[mismatch]));
+            }
+        }
+
+        // decodes the first string, which equals the raw data
+        template<typename Decoder>
+        void DecodeString(
+                const DecodeConfiguration & config,
+                Decoder decoder) {
+            auto in = LPString<DATAENC>::limbs(getString(config.source, config.numValues, 0));
+            auto out = config.target.template begin<DATARAW>();
+            for (size_t i = 0; i < config.numValues; ++i) {
+                out[i] = decoder(in[i], i);
+            }
+        }
+
+        void PreCheck(
+                const CheckConfiguration & config) override {
+            Test<DATARAW, DATAENC>::PreCheck(config);
+            const size_t mismatch = getMismatch(config.numValues);
+            expected = 0;
+            if (mismatch < config.numValues) {
+                const DATARAW x = config.source.template begin<DATARAW>()[mismatch];
+                expected = (x > getOther(x)) - (x < getOther(x));
+            }
+        }
+
+        bool DoCheck() override {
+            return true;
+        }
+
+        template<typename Compare>
+        void CheckStrings(
+                const CheckConfiguration & config,
+                Compare compare) {
+            const void * s1 = getString(config.target, config.numValues, 0);
+            const void * s2 = getString(config.target, config.numValues, 1);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                int result;
+                try {
+                    result = compare(s1, s2);
+                } catch (std::runtime_error & e) {
+                    throw ErrorInfo(__FILE__, __LINE__, static_cast<size_t>(-1), iteration, e.what());
+                }
+                if (((result > 0) - (result < 0)) != expected) {
+                    throw ErrorInfo(__FILE__, __LINE__, getMismatch(config.numValues), iteration, "wrong result of the string comparison");
+                }
+            }
+        }
+    };
+
+    template<typename VEC, typename DATA, size_t UNROLL>
+    struct StringTest_plain :
+            public StringTest<DATA, DATA>,
+            public SIMDTest<VEC> {
+
+        using StringTest<DATA, DATA>::StringTest;
+
+        virtual ~StringTest_plain() {
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->EncodeStrings(config, [] (DATA x) {return x;});
+            }
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            this->CheckStrings(config, [] (const void * s1, const void * s2) {return mm_strcmp_lp<VEC, DATA>(s1, s2);});
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->DecodeString(config, [] (DATA x, size_t) {return x;});
+            }
+        }
+    };
+
+    template<typename VEC, typename DATA, size_t UNROLL>
+    struct StringTest_xor :
+            public StringTest<DATA, DATA>,
+            public SIMDTest<VEC> {
+
+        VEC checksum1; // lane-wise XOR over each string, set in RunEncode
+        VEC checksum2;
+
+        StringTest_xor(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const double mismatchRatio = 1.0)
+                : StringTest<DATA, DATA>(name, bufRaw, bufEncoded, bufResult, mismatchRatio),
+                  checksum1(simd::mm<VEC>::setzero()),
+                  checksum2(simd::mm<VEC>::setzero()) {
+        }
+
+        virtual ~StringTest_xor() {
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->EncodeStrings(config, [] (DATA x) {return x;});
+                checksum1 = mm_strxor_lp<VEC, DATA>(this->getString(config.target, config.numValues, 0));
+                checksum2 = mm_strxor_lp<VEC, DATA>(this->getString(config.target, config.numValues, 1));
+            }
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            this->CheckStrings(config, [this] (const void * s1, const void * s2) {return mm_strcmp_lp_xor<VEC, DATA>(s1, s2, checksum1, checksum2);});
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                const VEC checksum = mm_strxor_lp<VEC, DATA>(this->getString(config.source, config.numValues, 0));
+                if (memcmp(&checksum, &checksum1, sizeof(VEC)) != 0) {
+                    throw ErrorInfo(__FILE__, __LINE__, static_cast<size_t>(-1), iteration, "checksum mismatch");
+                }
+                this->DecodeString(config, [] (DATA x, size_t) {return x;});
+            }
+        }
+    };
+
+    /*
+     * ACCU selects the kernel which verifies accumulated sums of the limbs instead of each vector.
+     */
+    template<typename VEC, typename DATARAW, typename DATAENC, bool ACCU, size_t UNROLL>
+    struct StringTest_AN :
+            public StringTest<DATARAW, DATAENC>,
+            public SIMDTest<VEC> {
+
+        DATAENC A;
+        DATAENC A_INV;
+
+        StringTest_AN(
+                const std::string & name,
+                AlignedBlock & bufRaw,
+                AlignedBlock & bufEncoded,
+                AlignedBlock & bufResult,
+                const DATAENC A,
+                const DATAENC A_INV,
+                const double mismatchRatio = 1.0)
+                : StringTest<DATARAW, DATAENC>(name, bufRaw, bufEncoded, bufResult, mismatchRatio),
+                  A(A),
+                  A_INV(A_INV) {
+            this->name += " " + std::to_string(A);
+        }
+
+        virtual ~StringTest_AN() {
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->EncodeStrings(config, [this] (DATARAW x) {return static_cast<DATAENC>(x * A);});
+            }
+        }
+
+        void RunCheck(
+                const CheckConfiguration & config) override {
+            this->CheckStrings(config, [this] (const void * s1, const void * s2) {
+                if constexpr (ACCU) {
+                    return mm_strcmp_lp_AN_accu<VEC, DATARAW, DATAENC>(s1, s2, A, A_INV);
+                } else {
+                    return mm_strcmp_lp_AN<VEC, DATARAW, DATAENC>(s1, s2, A_INV);
+                }
+            });
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                this->DecodeString(config, [this,iteration] (DATAENC x, size_t i) {
+                    const DATAENC dec = static_cast<DATAENC>(x * A_INV);
+                    if (dec > std::numeric_limits<DATARAW>::max()) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                    return static_cast<DATARAW>(dec);
+                });
+            }
+        }
+    };
+
+#define MAKE_STRING_TYPES(ISA, VEC) \
+    template<size_t UNROLL> \
+    struct StringTest_plain_ ## ISA ## _8 : public StringTest_plain<VEC, uint8_t, UNROLL> { \
+        using StringTest_plain<VEC, uint8_t, UNROLL>::StringTest_plain; \
+        virtual ~StringTest_plain_ ## ISA ## _8() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_plain_ ## ISA ## _16 : public StringTest_plain<VEC, uint16_t, UNROLL> { \
+        using StringTest_plain<VEC, uint16_t, UNROLL>::StringTest_plain; \
+        virtual ~StringTest_plain_ ## ISA ## _16() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_xor_ ## ISA ## _8 : public StringTest_xor<VEC, uint8_t, UNROLL> { \
+        using StringTest_xor<VEC, uint8_t, UNROLL>::StringTest_xor; \
+        virtual ~StringTest_xor_ ## ISA ## _8() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_xor_ ## ISA ## _16 : public StringTest_xor<VEC, uint16_t, UNROLL> { \
+        using StringTest_xor<VEC, uint16_t, UNROLL>::StringTest_xor; \
+        virtual ~StringTest_xor_ ## ISA ## _16() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_AN_ ## ISA ## _8_16 : public StringTest_AN<VEC, uint8_t, uint16_t, false, UNROLL> { \
+        using StringTest_AN<VEC, uint8_t, uint16_t, false, UNROLL>::StringTest_AN; \
+        virtual ~StringTest_AN_ ## ISA ## _8_16() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_AN_ ## ISA ## _16_32 : public StringTest_AN<VEC, uint16_t, uint32_t, false, UNROLL> { \
+        using StringTest_AN<VEC, uint16_t, uint32_t, false, UNROLL>::StringTest_AN; \
+        virtual ~StringTest_AN_ ## ISA ## _16_32() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_AN_accu_ ## ISA ## _8_16 : public StringTest_AN<VEC, uint8_t, uint16_t, true, UNROLL> { \
+        using StringTest_AN<VEC, uint8_t, uint16_t, true, UNROLL>::StringTest_AN; \
+        virtual ~StringTest_AN_accu_ ## ISA ## _8_16() {} \
+    }; \
+    template<size_t UNROLL> \
+    struct StringTest_AN_accu_ ## ISA ## _16_32 : public StringTest_AN<VEC, uint16_t, uint32_t, true, UNROLL> { \
+        using StringTest_AN<VEC, uint16_t, uint32_t, true, UNROLL>::StringTest_AN; \
+        virtual ~StringTest_AN_accu_ ## ISA ## _16_32() {} \
+    };
+
+#ifdef __SSE4_2__
+    MAKE_STRING_TYPES(sse42, __m128i)
+#endif
+#ifdef __AVX2__
+    MAKE_STRING_TYPES(avx2, __m256i)
+#endif
+#ifdef __AVX512F__
+    MAKE_STRING_TYPES(avx512, __m512i)
+#endif
+
+#undef MAKE_STRING_TYPES
+
+}
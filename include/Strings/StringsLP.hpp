@@ -0,0 +1,517 @@
+// Copyright 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   StringsLP.hpp
+ *
+ * Comparison of length-prefixed strings for any of the SIMD extensions, unprotected, XOR and AN coded. In contrast to
+ * the zero-terminated variants, the kernels never scan for a terminator but process full vectors up to the shorter
+ * length and the remaining limbs one by one.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <Strings/StringBase.hpp>
+#include <Util/Functors.hpp>
+#include <Util/Helpers.hpp>
+#ifdef __SSE4_2__
+#include <SIMD/SSE.hpp>
+#endif
+#ifdef __AVX2__
+#include <SIMD/AVX2.hpp>
+#endif
+#ifdef __AVX512F__
+#include <SIMD/AVX512.hpp>
+#endif
+
+/*
+ * A length-prefixed string: a size_t holding the number of limbs, directly followed by the limbs.
+ */
+template<typename T>
+struct LPString {
+
+    static size_t length(
+            const void * s) {
+        return *static_cast<const size_t*>(s);
+    }
+
+    static const T * limbs(
+            const void * s) {
+        return reinterpret_cast<const T*>(static_cast<const size_t*>(s) + 1);
+    }
+
+    /**
+     * Writes the length prefix and returns where the limbs go.
+     */
+    static T * init(
+            void * s,
+            const size_t length) {
+        *static_cast<size_t*>(s) = length;
+        return reinterpret_cast<T*>(static_cast<size_t*>(s) + 1);
+    }
+
+    static size_t numBytes(
+            const size_t length) {
+        return sizeof(size_t) + length * sizeof(T);
+    }
+};
+
+namespace Private {
+
+    // the limbs follow the length prefix, so vectors must be loaded unaligned
+    template<typename VEC>
+    inline VEC lpstr_loadu(
+            const void * p) {
+        VEC mm;
+        memcpy(&mm, p, sizeof(VEC));
+        return mm;
+    }
+
+    // the last numBytes (< sizeof(VEC)) bytes of a string, zero-padded to a full vector
+    template<typename VEC>
+    inline VEC lpstr_load_tail(
+            const void * p,
+            const size_t numBytes) {
+        VEC mm;
+        memset(&mm, 0, sizeof(VEC));
+        memcpy(&mm, p, numBytes);
+        return mm;
+    }
+
+    // index of the first lane not set in the equality mask eq
+    template<typename MASK>
+    inline size_t lpstr_first_mismatch(
+            const MASK eq) {
+        return __builtin_ctzll(static_cast<uint64_t>(static_cast<MASK>(~eq)));
+    }
+
+    inline int lpstr_compare_lengths(
+            const size_t length1,
+            const size_t length2) {
+        return (length1 > length2) - (length1 < length2);
+    }
+
+    // XORs the limbs [begin, length) into mmXOR vector by vector, begin must be a multiple of the limbs per vector.
+    // XOR works on bits only, so the 32-bit lanes serve all limb sizes.
+    template<typename VEC, typename T>
+    inline VEC lpstr_xor(
+            VEC mmXOR,
+            const T * limbs,
+            const size_t begin,
+            const size_t length) {
+        const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(T);
+        size_t i = begin;
+        for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+            mmXOR = coding_benchmark::simd::mm_op<VEC, uint32_t, coding_benchmark::xor_is>::cmp(mmXOR, lpstr_loadu<VEC>(limbs + i));
+        }
+        if (i < length) {
+            mmXOR = coding_benchmark::simd::mm_op<VEC, uint32_t, coding_benchmark::xor_is>::cmp(mmXOR, lpstr_load_tail<VEC>(limbs + i, (length - i) * sizeof(T)));
+        }
+        return mmXOR;
+    }
+
+}
+
+/**
+ * Returns <0, 0 or >0 like strcmp. A common prefix makes the shorter string the smaller one.
+ */
+template<typename VEC, typename T>
+int mm_strcmp_lp(
+        const void * s1,
+        const void * s2) {
+    typedef coding_benchmark::simd::mm<VEC, T> mmT;
+    typedef coding_benchmark::simd::mm_op<VEC, T, std::equal_to> mmEQ;
+    const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(T);
+    const size_t length1 = LPString<T>::length(s1);
+    const size_t length2 = LPString<T>::length(s2);
+    const size_t length = std::min(length1, length2);
+    const T * p1 = LPString<T>::limbs(s1);
+    const T * p2 = LPString<T>::limbs(s2);
+    size_t i = 0;
+    for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+        auto eq = mmEQ::cmp_mask(Private::lpstr_loadu<VEC>(p1 + i), Private::lpstr_loadu<VEC>(p2 + i));
+        if (__builtin_expect(eq != mmT::FULL_MASK, 0)) {
+            const size_t k = i + Private::lpstr_first_mismatch(eq);
+            return static_cast<int>(p1[k]) - static_cast<int>(p2[k]);
+        }
+    }
+    for (; i < length; ++i) {
+        if (p1[i] != p2[i]) {
+            return static_cast<int>(p1[i]) - static_cast<int>(p2[i]);
+        }
+    }
+    return Private::lpstr_compare_lengths(length1, length2);
+}
+
+/**
+ * The XOR checksum of a length-prefixed string: all vectors of limbs XORed together, the last one zero-padded.
+ */
+template<typename VEC, typename T>
+VEC mm_strxor_lp(
+        const void * s) {
+    return Private::lpstr_xor<VEC, T>(coding_benchmark::simd::mm<VEC>::setzero(), LPString<T>::limbs(s), 0, LPString<T>::length(s));
+}
+
+/**
+ * Like mm_strcmp_lp, but verifies both strings against their checksums from mm_strxor_lp. The strings must be read
+ * completely for that, also beyond the first difference.
+ */
+template<typename VEC, typename T>
+int mm_strcmp_lp_xor(
+        const void * s1,
+        const void * s2,
+        const VEC old_xor1,
+        const VEC old_xor2) {
+    typedef coding_benchmark::simd::mm<VEC, T> mmT;
+    typedef coding_benchmark::simd::mm<VEC, uint32_t> mm32;
+    typedef coding_benchmark::simd::mm_op<VEC, T, std::equal_to> mmEQ;
+    typedef coding_benchmark::simd::mm_op<VEC, uint32_t, std::equal_to> mm32EQ;
+    typedef coding_benchmark::simd::mm_op<VEC, uint32_t, coding_benchmark::xor_is> mmXOR;
+    const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(T);
+    const size_t length1 = LPString<T>::length(s1);
+    const size_t length2 = LPString<T>::length(s2);
+    const size_t length = std::min(length1, length2);
+    const T * p1 = LPString<T>::limbs(s1);
+    const T * p2 = LPString<T>::limbs(s2);
+    VEC new_xor1 = coding_benchmark::simd::mm<VEC>::setzero();
+    VEC new_xor2 = coding_benchmark::simd::mm<VEC>::setzero();
+    int result = 0;
+    bool isDifferent = false;
+    size_t i = 0;
+    for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+        auto mm1 = Private::lpstr_loadu<VEC>(p1 + i);
+        auto mm2 = Private::lpstr_loadu<VEC>(p2 + i);
+        new_xor1 = mmXOR::cmp(new_xor1, mm1);
+        new_xor2 = mmXOR::cmp(new_xor2, mm2);
+        auto eq = mmEQ::cmp_mask(mm1, mm2);
+        if (__builtin_expect(eq != mmT::FULL_MASK, 0)) {
+            const size_t k = i + Private::lpstr_first_mismatch(eq);
+            result = static_cast<int>(p1[k]) - static_cast<int>(p2[k]);
+            isDifferent = true;
+            i += NUM_LIMBS;
+            break;
+        }
+    }
+    if (!isDifferent) {
+        for (size_t k = i; k < length; ++k) {
+            if (p1[k] != p2[k]) {
+                result = static_cast<int>(p1[k]) - static_cast<int>(p2[k]);
+                isDifferent = true;
+                break;
+            }
+        }
+    }
+    new_xor1 = Private::lpstr_xor<VEC, T>(new_xor1, p1, i, length1);
+    new_xor2 = Private::lpstr_xor<VEC, T>(new_xor2, p2, i, length2);
+    if (mm32EQ::cmp_mask(new_xor1, old_xor1) != mm32::FULL_MASK) {
+        throw std::runtime_error("[" __FILE__ "] old_xor1 != new_xor1");
+    }
+    if (mm32EQ::cmp_mask(new_xor2, old_xor2) != mm32::FULL_MASK) {
+        throw std::runtime_error("[" __FILE__ "] old_xor2 != new_xor2");
+    }
+    return isDifferent ? result : Private::lpstr_compare_lengths(length1, length2);
+}
+
+/**
+ * Compares AN coded limbs, each of which is checked before it is used. As long as A * DATARAW fits into DATAENC, the
+ * code words compare like the data, so only the first differing pair is decoded.
+ */
+template<typename VEC, typename DATARAW, typename DATAENC>
+int mm_strcmp_lp_AN(
+        const void * s1,
+        const void * s2,
+        const DATAENC AInv) {
+    typedef coding_benchmark::simd::mm<VEC, DATAENC> mmEnc;
+    typedef coding_benchmark::simd::mm_op<VEC, DATAENC, std::equal_to> mmEQ;
+    typedef coding_benchmark::simd::mm_op<VEC, DATAENC, std::less_equal> mmLE;
+    typedef coding_benchmark::simd::mm_op<VEC, DATAENC, coding_benchmark::mul> mmMul;
+    const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(DATAENC);
+    const constexpr DATAENC dMax = std::numeric_limits<DATARAW>::max();
+    const size_t length1 = LPString<DATAENC>::length(s1);
+    const size_t length2 = LPString<DATAENC>::length(s2);
+    const size_t length = std::min(length1, length2);
+    const DATAENC * p1 = LPString<DATAENC>::limbs(s1);
+    const DATAENC * p2 = LPString<DATAENC>::limbs(s2);
+    const VEC mmAInv = mmEnc::set1(AInv);
+    const VEC mmDMax = mmEnc::set1(dMax);
+    size_t i = 0;
+    for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+        auto mm1 = Private::lpstr_loadu<VEC>(p1 + i);
+        if (mmLE::cmp_mask(mmMul::compute(mm1, mmAInv), mmDMax) != mmEnc::FULL_MASK) {
+            throw std::runtime_error("[" __FILE__ "] first string is corrupt");
+        }
+        auto mm2 = Private::lpstr_loadu<VEC>(p2 + i);
+        if (mmLE::cmp_mask(mmMul::compute(mm2, mmAInv), mmDMax) != mmEnc::FULL_MASK) {
+            throw std::runtime_error("[" __FILE__ "] second string is corrupt");
+        }
+        auto eq = mmEQ::cmp_mask(mm1, mm2);
+        if (__builtin_expect(eq != mmEnc::FULL_MASK, 0)) {
+            const size_t k = i + Private::lpstr_first_mismatch(eq);
+            return static_cast<int>(static_cast<DATAENC>(p1[k] * AInv)) - static_cast<int>(static_cast<DATAENC>(p2[k] * AInv));
+        }
+    }
+    for (; i < length; ++i) {
+        const DATAENC dec1 = static_cast<DATAENC>(p1[i] * AInv);
+        if (dec1 > dMax) {
+            throw std::runtime_error("[" __FILE__ "] first string is corrupt");
+        }
+        const DATAENC dec2 = static_cast<DATAENC>(p2[i] * AInv);
+        if (dec2 > dMax) {
+            throw std::runtime_error("[" __FILE__ "] second string is corrupt");
+        }
+        if (dec1 != dec2) {
+            return static_cast<int>(dec1) - static_cast<int>(dec2);
+        }
+    }
+    return Private::lpstr_compare_lengths(length1, length2);
+}
+
+/**
+ * Like mm_strcmp_lp_AN, but instead of each limb only the lane-wise sums of the code words are checked. The code words
+ * are summed up in lanes of twice their width, and such sums are code words themselves as long as they do not overflow.
+ * Therefore, the sums are checked and reset after at most max(accu_t) / A / max(DATARAW) code words per lane, at the
+ * first difference and at the end.
+ */
+template<typename VEC, typename DATARAW, typename DATAENC>
+int mm_strcmp_lp_AN_accu(
+        const void * s1,
+        const void * s2,
+        const DATAENC A,
+        const DATAENC AInv) {
+    typedef typename Larger<DATAENC>::larger_t accu_t;
+    typedef coding_benchmark::simd::mm<VEC, DATAENC> mmEnc;
+    typedef coding_benchmark::simd::mm<VEC, accu_t> mmAccu;
+    typedef coding_benchmark::simd::mm_op<VEC, DATAENC, std::equal_to> mmEQ;
+    typedef coding_benchmark::simd::mm_op<VEC, accu_t, std::less_equal> mmAccuLE;
+    typedef coding_benchmark::simd::mm_op<VEC, accu_t, coding_benchmark::mul> mmAccuMul;
+    typedef coding_benchmark::simd::mm_op<VEC, accu_t, coding_benchmark::add> mmAccuAdd;
+    const constexpr size_t NUM_LIMBS = sizeof(VEC) / sizeof(DATAENC);
+    const constexpr size_t LIMBS_PER_LANE = sizeof(accu_t) / sizeof(DATAENC); // each vector adds that many code words to a lane
+    const constexpr accu_t dMax = std::numeric_limits<DATARAW>::max();
+    const size_t ACCU_VECTORS = std::max<size_t>(std::numeric_limits<accu_t>::max() / A / dMax / LIMBS_PER_LANE, 1);
+    const size_t length1 = LPString<DATAENC>::length(s1);
+    const size_t length2 = LPString<DATAENC>::length(s2);
+    const size_t length = std::min(length1, length2);
+    const DATAENC * p1 = LPString<DATAENC>::limbs(s1);
+    const DATAENC * p2 = LPString<DATAENC>::limbs(s2);
+    // one Newton step lifts the inverse of A from modulo 2^|DATAENC| to modulo 2^|accu_t|
+    const accu_t accuAInv = static_cast<accu_t>(static_cast<accu_t>(AInv) * static_cast<accu_t>(2 - static_cast<accu_t>(A) * AInv));
+    const VEC mmAInv = mmAccu::set1(accuAInv);
+    VEC mmAccu1 = coding_benchmark::simd::mm<VEC>::setzero();
+    VEC mmAccu2 = coding_benchmark::simd::mm<VEC>::setzero();
+    size_t numAccumulated = 0;
+    auto accumulate = [] (VEC mmSum, VEC mm) {
+        return mmAccuAdd::compute(mmSum, mmAccuAdd::compute(mmEnc::cvt_larger_lo(mm), mmEnc::cvt_larger_hi(mm)));
+    };
+    auto verify = [&] {
+        const VEC mmAccuMax = mmAccu::set1(static_cast<accu_t>(numAccumulated * LIMBS_PER_LANE * dMax));
+        if (mmAccuLE::cmp_mask(mmAccuMul::compute(mmAccu1, mmAInv), mmAccuMax) != mmAccu::FULL_MASK) {
+            throw std::runtime_error("[" __FILE__ "] first string is corrupt");
+        }
+        if (mmAccuLE::cmp_mask(mmAccuMul::compute(mmAccu2, mmAInv), mmAccuMax) != mmAccu::FULL_MASK) {
+            throw std::runtime_error("[" __FILE__ "] second string is corrupt");
+        }
+        mmAccu1 = coding_benchmark::simd::mm<VEC>::setzero();
+        mmAccu2 = coding_benchmark::simd::mm<VEC>::setzero();
+        numAccumulated = 0;
+    };
+    size_t i = 0;
+    for (; (i + NUM_LIMBS) <= length; i += NUM_LIMBS) {
+        auto mm1 = Private::lpstr_loadu<VEC>(p1 + i);
+        auto mm2 = Private::lpstr_loadu<VEC>(p2 + i);
+        mmAccu1 = accumulate(mmAccu1, mm1);
+        mmAccu2 = accumulate(mmAccu2, mm2);
+        auto eq = mmEQ::cmp_mask(mm1, mm2);
+        if (__builtin_expect(eq != mmEnc::FULL_MASK, 0)) {
+            ++numAccumulated;
+            verify();
+            const size_t k = i + Private::lpstr_first_mismatch(eq);
+            return static_cast<int>(static_cast<DATAENC>(p1[k] * AInv)) - static_cast<int>(static_cast<DATAENC>(p2[k] * AInv));
+        }
+        if (++numAccumulated == ACCU_VECTORS) {
+            verify();
+        }
+    }
+    verify();
+    for (; i < length; ++i) {
+        const DATAENC dec1 = static_cast<DATAENC>(p1[i] * AInv);
+        if (dec1 > dMax) {
+            throw std::runtime_error("[" __FILE__ "] first string is corrupt");
+        }
+        const DATAENC dec2 = static_cast<DATAENC>(p2[i] * AInv);
+        if (dec2 > dMax) {
+            throw std::runtime_error("[" __FILE__ "] second string is corrupt");
+        }
+        if (dec1 != dec2) {
+            return static_cast<int>(dec1) - static_cast<int>(dec2);
+        }
+    }
+    return Private::lpstr_compare_lengths(length1, length2);
+}
+
+#ifdef __SSE4_2__
+extern template int mm_strcmp_lp<__m128i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+extern template int mm_strcmp_lp<__m128i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+extern template __m128i mm_strxor_lp<__m128i, uint8_t>(
+        const void * s);
+
+extern template __m128i mm_strxor_lp<__m128i, uint16_t>(
+        const void * s);
+
+extern template int mm_strcmp_lp_xor<__m128i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m128i old_xor1,
+        const __m128i old_xor2);
+
+extern template int mm_strcmp_lp_xor<__m128i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m128i old_xor1,
+        const __m128i old_xor2);
+
+extern template int mm_strcmp_lp_AN<__m128i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN<__m128i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m128i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m128i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
+
+#ifdef __AVX2__
+extern template int mm_strcmp_lp<__m256i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+extern template int mm_strcmp_lp<__m256i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+extern template __m256i mm_strxor_lp<__m256i, uint8_t>(
+        const void * s);
+
+extern template __m256i mm_strxor_lp<__m256i, uint16_t>(
+        const void * s);
+
+extern template int mm_strcmp_lp_xor<__m256i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m256i old_xor1,
+        const __m256i old_xor2);
+
+extern template int mm_strcmp_lp_xor<__m256i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m256i old_xor1,
+        const __m256i old_xor2);
+
+extern template int mm_strcmp_lp_AN<__m256i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN<__m256i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m256i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m256i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
+
+#ifdef __AVX512F__
+extern template int mm_strcmp_lp<__m512i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+extern template int mm_strcmp_lp<__m512i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+extern template __m512i mm_strxor_lp<__m512i, uint8_t>(
+        const void * s);
+
+extern template __m512i mm_strxor_lp<__m512i, uint16_t>(
+        const void * s);
+
+extern template int mm_strcmp_lp_xor<__m512i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m512i old_xor1,
+        const __m512i old_xor2);
+
+extern template int mm_strcmp_lp_xor<__m512i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m512i old_xor1,
+        const __m512i old_xor2);
+
+extern template int mm_strcmp_lp_AN<__m512i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN<__m512i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m512i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+extern template int mm_strcmp_lp_AN_accu<__m512i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
@@ -0,0 +1,80 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Accumulators.hpp
+ *
+ * Independent vector accumulators for the aggregate kernels. Folding consecutive vectors round-robin into K of them
+ * replaces the single dependency chain through one accumulator by K chains, which the CPU overlaps, so that an
+ * aggregate is bound by memory bandwidth instead of instruction latency.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace coding_benchmark {
+
+    static const constexpr size_t NUM_ACCUMULATORS = 4; // of the SIMD aggregate kernels
+
+    template<typename VEC, size_t K>
+    struct Accumulators {
+
+        static_assert(K > 0, "At least one accumulator is required");
+
+        /**
+         * The number of vectors a kernel processes per iteration of its main loop: UNROLL rounded up to a multiple of K,
+         * so that every accumulator gets the same number of vectors.
+         */
+        static constexpr size_t stride(
+                const size_t unroll) {
+            return ((unroll + K - 1) / K) * K;
+        }
+
+        VEC mm[K];
+
+        template<typename Initialize>
+        explicit Accumulators(
+                Initialize && funcInit)
+                : mm {} {
+            for (size_t k = 0; k < K; ++k) {
+                mm[k] = funcInit();
+            }
+        }
+
+        VEC & operator[](
+                const size_t k) {
+            return mm[k];
+        }
+
+        /**
+         * Combines all accumulators pairwise into a single one, e.g. for the horizontal reduction at the end of a kernel.
+         */
+        template<typename Combine>
+        VEC combine(
+                Combine && funcCombine) const {
+            VEC tmp[K];
+            for (size_t k = 0; k < K; ++k) {
+                tmp[k] = mm[k];
+            }
+            for (size_t n = K; n > 1; n = (n + 1) / 2) {
+                for (size_t k = 0; k < (n / 2); ++k) {
+                    tmp[k] = funcCombine(tmp[k], tmp[n - 1 - k]);
+                }
+            }
+            return tmp[0];
+        }
+    };
+
+}
@@ -14,14 +14,61 @@
 
 #pragma once
 
+#include <cerrno>
 #include <cstring>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <linux/mman.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * How an AlignedBlock obtains its memory. The default is plain new[]. Any other setting maps the block anonymously
+ * (Linux only), so that huge pages, NUMA placement and pre-faulting apply to the whole block.
+ */
+struct AllocationPolicy {
+    enum class Pages {
+        Default,
+        Transparent, // madvise(MADV_HUGEPAGE)
+        Explicit // MAP_HUGETLB with 2 MiB pages, which must be reserved beforehand (vm.nr_hugepages)
+    };
+
+    enum class NUMA {
+        Default,
+        Bind, // all pages on numaNode
+        Interleave // pages round-robin over all nodes the process may use
+    };
+
+    Pages pages;
+    NUMA numa;
+    unsigned numaNode;
+    bool prefault; // touch every page right after the allocation (and NUMA placement), not in the first measured run
+
+    AllocationPolicy()
+            : pages(Pages::Default),
+              numa(NUMA::Default),
+              numaNode(0),
+              prefault(false) {
+    }
+
+    bool isDefault() const {
+        return pages == Pages::Default && numa == NUMA::Default && !prefault;
+    }
+};
 
 struct AlignedBlock {
 
     const size_t nBytes;
     const size_t alignment;
+    const AllocationPolicy policy;
+    const size_t offset; // in bytes, of a view into the block which owns the memory, 0 for that block
 
 private:
     std::shared_ptr<char[]> baseptr;
@@ -30,17 +77,77 @@ private:
     AlignedBlock()
             : nBytes(0),
               alignment(0),
+              policy(),
+              offset(0),
               baseptr(nullptr),
               data(nullptr) {
     }
 
+    static std::shared_ptr<char[]> allocate(
+            size_t nBytes,
+            const AllocationPolicy & policy) {
+        if (policy.isDefault()) {
+            return std::shared_ptr<char[]>(new char[nBytes]);
+        }
+#ifdef __linux__
+        const size_t pageSize = policy.pages == AllocationPolicy::Pages::Default ? static_cast<size_t>(sysconf(_SC_PAGESIZE)) : (2ull << 20);
+        const size_t nMapped = ((nBytes + pageSize - 1) / pageSize) * pageSize;
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        if (policy.pages == AllocationPolicy::Pages::Explicit) {
+            flags |= MAP_HUGETLB | MAP_HUGE_2MB;
+        }
+        void * ptr = mmap(nullptr, nMapped, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (ptr == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(),
+                    policy.pages == AllocationPolicy::Pages::Explicit ? "AlignedBlock: mmap(MAP_HUGETLB), are enough 2 MiB pages reserved?" : "AlignedBlock: mmap");
+        }
+        std::shared_ptr<char[]> result(static_cast<char*>(ptr), [nMapped] (char * p) {munmap(p, nMapped);});
+        if (policy.pages == AllocationPolicy::Pages::Transparent && madvise(ptr, nMapped, MADV_HUGEPAGE) != 0) {
+            throw std::system_error(errno, std::generic_category(), "AlignedBlock: madvise(MADV_HUGEPAGE)");
+        }
+        if (policy.numa != AllocationPolicy::NUMA::Default) {
+            // raw system calls, so that we do not need to link libnuma
+            const unsigned long maxNode = sizeof(unsigned long) * 8;
+            unsigned long nodeMask = 0;
+            int mode;
+            if (policy.numa == AllocationPolicy::NUMA::Bind) {
+                if (policy.numaNode >= maxNode) {
+                    throw std::invalid_argument("AlignedBlock: NUMA node out of range");
+                }
+                nodeMask = 1ul << policy.numaNode;
+                mode = MPOL_BIND;
+            } else {
+                if (syscall(SYS_get_mempolicy, nullptr, &nodeMask, maxNode + 1, nullptr, MPOL_F_MEMS_ALLOWED) != 0) {
+                    throw std::system_error(errno, std::generic_category(), "AlignedBlock: get_mempolicy");
+                }
+                mode = MPOL_INTERLEAVE;
+            }
+            if (syscall(SYS_mbind, ptr, nMapped, mode, &nodeMask, maxNode + 1, 0) != 0) {
+                throw std::system_error(errno, std::generic_category(), "AlignedBlock: mbind");
+            }
+        }
+        if (policy.prefault) {
+            const size_t touchStride = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            for (size_t offset = 0; offset < nMapped; offset += touchStride) {
+                static_cast<volatile char*>(ptr)[offset] = 0;
+            }
+        }
+        return result;
+#else
+        throw std::runtime_error("AlignedBlock: allocation policies other than the default are only supported on Linux");
+#endif
+    }
+
 public:
     AlignedBlock(
             size_t nBytes,
-            size_t alignment)
+            size_t alignment,
+            const AllocationPolicy & policy = AllocationPolicy())
             : nBytes(nBytes),
               alignment(alignment),
-              baseptr(new char[nBytes + alignment]),
+              policy(policy),
+              offset(0),
+              baseptr(allocate(nBytes + alignment, policy)),
               data(baseptr.get() + (alignment - (reinterpret_cast<size_t>(baseptr.get()) & (alignment - 1)))) {
     }
 
@@ -48,14 +155,34 @@ public:
             AlignedBlock & other)
             : nBytes(other.nBytes),
               alignment(other.alignment),
+              policy(other.policy),
+              offset(other.offset),
               baseptr(other.baseptr),
               data(other.data) {
     }
 
+    /**
+     * Creates a view of nBytes bytes, starting at the given byte offset, into the other block.
+     * The view shares (and keeps alive) the other block's memory.
+     */
+    AlignedBlock(
+            const AlignedBlock & other,
+            size_t offset,
+            size_t nBytes)
+            : nBytes(nBytes),
+              alignment(other.alignment),
+              policy(other.policy),
+              offset(other.offset + offset),
+              baseptr(other.baseptr),
+              data(static_cast<char*>(other.data) + offset) {
+    }
+
     AlignedBlock(
             AlignedBlock && other)
             : nBytes(other.nBytes),
               alignment(other.alignment),
+              policy(other.policy),
+              offset(other.offset),
               baseptr(std::move(other.baseptr)),
               data(other.data) {
     }
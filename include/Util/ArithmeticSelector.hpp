@@ -40,4 +40,8 @@ struct ArithmeticSelector {
             ArithmeticConfiguration::Div) {
         return true;
     }
+    bool operator()(
+            ArithmeticConfiguration::Bitwise) {
+        return true;
+    }
 };
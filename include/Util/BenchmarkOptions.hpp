@@ -0,0 +1,101 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   BenchmarkOptions.hpp
+ *
+ * The command line of the benchmark driver. Options taking lists accept comma-separated values and may be repeated.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <Util/TestConfiguration.hpp>
+#include <Util/TestRegistry.hpp>
+
+struct BenchmarkOptions {
+    std::vector<size_t> numElements; // each combination of numElements and numIterations is one run
+    std::vector<size_t> numIterations;
+    size_t sweepMin; // --sweep: numElements grows geometrically from sweepMin to sweepMax, 0: no sweep
+    size_t sweepMax;
+    size_t sweepFactor;
+    size_t numRepetitions;
+    std::optional<bool> rejectOutliers; // see TestConfiguration::rejectOutliers, empty: its default
+    std::vector<std::string> phases; // names as in PhaseNames(), encoding is always executed
+    std::vector<size_t> unrollSizes; // empty: all compiled-in unroll / block sizes
+    std::vector<std::string> families; // empty: all
+    std::vector<CPU::ISA> isas; // empty: all the CPU supports
+    std::vector<size_t> datawidths; // empty: all
+    std::vector<size_t> As;
+    std::vector<PipelineStage> pipeline; // see TestConfiguration::pipeline
+    size_t pipelineChunkBytes;
+    std::vector<double> correctionErrorRates; // see TestConfiguration::correctionErrorRates
+    std::vector<double> faultRates; // see TestConfiguration::faultRates
+    FaultSpec faultSpec;
+    std::vector<std::string> filters; // a test must match at least one of them, empty: all
+    bool enablePerfCounters;
+    std::vector<PerfEvent> perfEvents; // model-specific events counted besides PerfEvent::Defaults()
+    AllocationPolicy allocation; // for the data buffers of all tests
+    std::string exportFileJSON;
+    std::string exportFileCSV;
+    bool doList;
+    bool doHelp;
+
+    BenchmarkOptions();
+
+    /**
+     * Throws std::invalid_argument for unknown options and malformed values.
+     */
+    static BenchmarkOptions Parse(
+            int argc,
+            char* argv[]);
+
+    static void PrintUsage(
+            std::ostream & out,
+            const char* const program);
+
+    /**
+     * check, scrub, filter, filterChk, arithmetic, arithmeticChk, aggregate, aggregateChk, reencodeChk, decode, decodeChk, decodeView.
+     */
+    static const std::vector<std::string> & PhaseNames();
+
+    /**
+     * The stages --pipeline accepts, see PipelineStage.
+     */
+    static const std::vector<PipelineStage> & PipelineStages();
+
+    /**
+     * Enables exactly the selected phases.
+     */
+    void configure(
+            TestConfiguration & testConfig) const;
+
+    bool isSelected(
+            const RegisteredTest & test) const;
+
+    bool isSweep() const;
+
+    /**
+     * In a sweep, the smallest number of values runs numIterations times and larger ones proportionally fewer, so that
+     * each size processes (about) the same amount of data.
+     */
+    size_t getIterations(
+            size_t numValues,
+            size_t numIterations) const;
+};
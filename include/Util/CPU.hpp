@@ -25,6 +25,17 @@ struct CPU {
         Intel
     };
 
+    /**
+     * The instruction sets for which there are kernels, ordered by vector width.
+     */
+    enum class ISA {
+
+        Scalar,
+        SSE42,
+        AVX2,
+        AVX512
+    };
+
     static CPU&
     Instance() {
         static CPU instance;
@@ -60,6 +71,7 @@ struct CPU {
     bool SSE4a;
     bool AES;
     bool SHA;
+    bool PCLMULQDQ;
 
     // AVX
     bool AVX;
@@ -78,6 +90,18 @@ struct CPU {
     bool AVX512_DQ;
     bool AVX512_IFMA;
     bool AVX512_VBMI;
+    bool VPCLMULQDQ;
+
+    /**
+     * Whether both the CPU and the OS (which must save the wider registers) support the kernels of the given instruction set.
+     */
+    bool Supports(
+            ISA isa) const;
+
+    /**
+     * The widest instruction set for which Supports() holds. Used to dispatch to the kernels at run time.
+     */
+    ISA WidestISA() const;
 
 private:
     CPU();
@@ -0,0 +1,102 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   DecodeView.hpp
+ *
+ * Systematic codes (XOR, CRC, Hamming) store the data words verbatim, interleaved with their checksums. Instead of
+ * copying the data words into a buffer of their own, a decode view describes where they lie within the encoded data, so
+ * that downstream operators read them in place.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * A run of equally laid out blocks within a buffer: numBlocks blocks of blockNumValues consecutive values each, whose
+ * first values lie blockStride bytes apart.
+ */
+struct DecodeViewRun {
+    const uint8_t * data;
+    size_t numBlocks;
+    size_t blockNumValues;
+    size_t blockStride;
+};
+
+/**
+ * The values of a buffer as a few runs of blocks, e.g. the full blocks of an encoded buffer followed by the partially
+ * filled ones at its end.
+ */
+struct DecodeView {
+
+    static const constexpr size_t MAX_RUNS = 3;
+
+    std::array<DecodeViewRun, MAX_RUNS> runs;
+    size_t numRuns;
+    size_t numValues;
+
+    DecodeView()
+            : runs(),
+              numRuns(0),
+              numValues(0) {
+    }
+
+    /**
+     * A single block of numValues values of valueSize bytes each, e.g. a decoded buffer.
+     */
+    DecodeView(
+            const void * data,
+            const size_t numValues,
+            const size_t valueSize)
+            : DecodeView() {
+        append(data, 1, numValues, valueSize * numValues);
+    }
+
+    /**
+     * Appends numBlocks blocks of blockNumValues values each, starting at data. Empty runs are skipped.
+     */
+    void append(
+            const void * data,
+            const size_t numBlocks,
+            const size_t blockNumValues,
+            const size_t blockStride) {
+        if (numBlocks == 0 || blockNumValues == 0) {
+            return;
+        }
+        if (numRuns == MAX_RUNS) {
+            throw std::runtime_error("DecodeView: too many runs");
+        }
+        runs[numRuns++] = DecodeViewRun {reinterpret_cast<const uint8_t*>(data), numBlocks, blockNumValues, blockStride};
+        numValues += numBlocks * blockNumValues;
+    }
+
+    /**
+     * Calls funcBlock(values, numValues) for each block in order, where values points to numValues consecutive values of type T.
+     */
+    template<typename T, typename Func>
+    void forEachBlock(
+            Func && funcBlock) const {
+        for (size_t r = 0; r < numRuns; ++r) {
+            const DecodeViewRun & run = runs[r];
+            auto data = run.data;
+            for (size_t block = 0; block < run.numBlocks; ++block, data += run.blockStride) {
+                funcBlock(reinterpret_cast<const T*>(data), run.blockNumValues);
+            }
+        }
+    }
+};
@@ -38,9 +38,11 @@ struct ExpandTest {
             AlignedBlock & bufRaw,
             AlignedBlock & bufEncoded,
             AlignedBlock & bufResult) {
-        std::clog << "#  * " << start << ": " << std::flush;
-        TestType<start>(name, bufRaw, bufEncoded, bufResult).Execute(testConfig, dataGenConfig);
-        std::clog << std::endl;
+        if (testConfig.isBlockSizeEnabled(start)) {
+            std::clog << "#  * " << start << ": " << std::flush;
+            TestType<start>(name, bufRaw, bufEncoded, bufResult).Execute(testConfig, dataGenConfig);
+            std::clog << std::endl;
+        }
         ExpandTest<TestType, start * 2, end>::WarmUp(name, testConfig, dataGenConfig, bufRaw, bufEncoded, bufResult);
     }
 
@@ -54,9 +56,12 @@ struct ExpandTest {
             AlignedBlock & bufEncoded,
             AlignedBlock & bufResult,
             ArgTypes && ... args) {
-        std::clog << "#      * " << start << ": " << std::flush;
-        vecTestInfos.push_back(TestType<start>(name, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...).Execute(testConfig, dataGenConfig));
-        std::clog << std::endl;
+        if (testConfig.isBlockSizeEnabled(start)) {
+            std::clog << "#      * " << start << ": " << std::flush;
+            vecTestInfos.push_back(TestType<start>(name, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...).Execute(testConfig, dataGenConfig));
+            vecTestInfos.rbegin()->blockSize = start;
+            std::clog << std::endl;
+        }
         ExpandTest<TestType, start * 2, end>::Execute(vecTestInfos, name, testConfig, dataGenConfig, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...);
     }
 };
@@ -71,9 +76,11 @@ struct ExpandTest<TestType, start, start> {
             AlignedBlock & bufRaw,
             AlignedBlock & bufEncoded,
             AlignedBlock & bufResult) {
-        std::clog << "#  * " << start << ": " << std::flush;
-        TestType<start>(name, bufRaw, bufEncoded, bufResult).Execute(testConfig, dataGenConfig);
-        std::clog << std::endl;
+        if (testConfig.isBlockSizeEnabled(start)) {
+            std::clog << "#  * " << start << ": " << std::flush;
+            TestType<start>(name, bufRaw, bufEncoded, bufResult).Execute(testConfig, dataGenConfig);
+            std::clog << std::endl;
+        }
     }
 
     template<typename ... ArgTypes>
@@ -86,9 +93,12 @@ struct ExpandTest<TestType, start, start> {
             AlignedBlock & bufEncoded,
             AlignedBlock & bufResult,
             ArgTypes && ... args) {
-        std::clog << "#      * " << start << ": " << std::flush;
-        vecTestInfos.push_back(TestType<start>(name, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...).Execute(testConfig, dataGenConfig));
-        std::clog << std::endl;
+        if (testConfig.isBlockSizeEnabled(start)) {
+            std::clog << "#      * " << start << ": " << std::flush;
+            vecTestInfos.push_back(TestType<start>(name, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...).Execute(testConfig, dataGenConfig));
+            vecTestInfos.rbegin()->blockSize = start;
+            std::clog << std::endl;
+        }
     }
 };
 
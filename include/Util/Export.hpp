@@ -0,0 +1,81 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * Machine-readable counterparts of printResults: one record per test, unroll/block size and sub test, together with
+ * the metadata of the run (host, kernel, compiler, build flags, CPU features), so that runs of different builds and
+ * machines can be compared directly.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <Util/TestInfo.hpp>
+#include <Util/TestConfiguration.hpp>
+
+struct RunMetadata {
+    std::string hostname;
+    std::string kernel; // sysname, release and version from uname
+    std::string compiler;
+    std::string buildType;
+    std::string buildFlags;
+    std::string targetISA; // the instruction set extensions the tree was compiled for (e.g. by -march=native)
+    std::string widestISA; // the widest instruction set the kernels use on this CPU
+    std::vector<std::string> cpuFeatures;
+
+    RunMetadata()
+            : hostname(),
+              kernel(),
+              compiler(),
+              buildType(),
+              buildFlags(),
+              targetISA(),
+              widestISA(),
+              cpuFeatures() {
+    }
+
+    /**
+     * Collects the metadata of the current process and machine.
+     */
+    static RunMetadata Collect();
+};
+
+/**
+ * Writes a single JSON object with the run metadata, the test configuration and all records.
+ */
+void exportJSON(
+        std::ostream & out,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Writes a long-format CSV table with one line per record. The run metadata is repeated in each line, so that
+ * the files of several runs can simply be concatenated (after dropping the repeated headlines).
+ */
+void exportCSV(
+        std::ostream & out,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Writes exportJSON / exportCSV into the given files, skipping empty file names.
+ */
+void exportResults(
+        const std::string & fileJSON,
+        const std::string & fileCSV,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results);
@@ -0,0 +1,75 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   FaultInjector.hpp
+ *
+ * Reproducible corruption of encoded buffers, modelling soft errors and faulty memory cells.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include <Util/AlignedBlock.hpp>
+
+enum class FaultModel {
+    SingleBit, // one flipped bit
+    MultiBit, // FaultSpec::numBits flipped bits within one aligned 64-bit memory word
+    Burst, // FaultSpec::numBits consecutive flipped bits
+    StuckAt0, // one bit forced to 0, which leaves half of the bits as they are
+    StuckAt1
+};
+
+enum class FaultDistribution {
+    Uniform, // the faults hit the buffer uniformly
+    Clustered // groups of faults hit few randomly placed regions of the buffer, like a faulty DRAM row
+};
+
+const char * getFaultModelName(
+        FaultModel model);
+
+const char * getFaultDistributionName(
+        FaultDistribution distribution);
+
+struct FaultSpec {
+    FaultModel model;
+    size_t numBits; // for MultiBit and Burst
+    FaultDistribution distribution;
+    uint64_t seed;
+
+    FaultSpec();
+};
+
+class FaultInjector {
+
+    const FaultSpec spec;
+
+public:
+    static const constexpr size_t CLUSTER_BYTES = 8 * 1024;
+    static const constexpr size_t CLUSTER_NUM_FAULTS = 16;
+
+    explicit FaultInjector(
+            const FaultSpec & spec);
+
+    /**
+     * Injects numFaults faults into the first numBytes bytes of block and returns the number of bits it changed. The
+     * same spec always injects the same faults.
+     */
+    size_t inject(
+            AlignedBlock & block,
+            size_t numBytes,
+            size_t numFaults) const;
+};
@@ -0,0 +1,265 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Filter.hpp
+ *
+ * Helpers of the filter sub tests: the normalized filter predicate, its scalar and SIMD evaluation, and the writer of the
+ * resulting bitmap.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <variant>
+#include <algorithm>
+#include <functional>
+
+#include <Util/AlignedBlock.hpp>
+#include <Util/TestConfiguration.hpp>
+#ifdef __SSE4_2__
+#include <SIMD/SSE.hpp>
+#endif
+#ifdef __AVX2__
+#include <SIMD/AVX2.hpp>
+#endif
+#ifdef __AVX512F__
+#include <SIMD/AVX512.hpp>
+#endif
+
+namespace coding_benchmark {
+
+    /**
+     * Normalized form of the (conjunctive) predicates of a FilterConfiguration for values of type T:
+     * a value qualifies iff lo <= value <= hi and it equals none of the first numExcluded excluded values.
+     * An unsatisfiable filter has lo > hi.
+     */
+    template<typename T>
+    struct FilterRange {
+        T lo;
+        T hi;
+        size_t numExcluded;
+        T excluded[2];
+
+        FilterRange()
+                : lo(std::numeric_limits<T>::min()),
+                  hi(std::numeric_limits<T>::max()),
+                  numExcluded(0),
+                  excluded {T(0), T(0)} {
+        }
+
+        FilterRange(
+                const FilterConfiguration & config)
+                : FilterRange() {
+            std::visit(Restrictor(*this, static_cast<T>(config.predicate1)), config.mode1);
+            std::visit(Restrictor(*this, static_cast<T>(config.predicate2)), config.mode2);
+        }
+
+        bool isEmpty() const {
+            return lo > hi;
+        }
+
+        inline bool matches(
+                const T value) const {
+            return (value >= lo) & (value <= hi) & ((numExcluded < 1) | (value != excluded[0])) & ((numExcluded < 2) | (value != excluded[1]));
+        }
+
+        /**
+         * Maps the range into another domain through a strictly increasing function, e.g. AN encoding.
+         */
+        template<typename U, typename Func>
+        FilterRange<U> transform(
+                Func func) const {
+            FilterRange<U> result;
+            if (isEmpty()) {
+                std::swap(result.lo, result.hi);
+            } else {
+                result.lo = func(lo);
+                result.hi = func(hi);
+            }
+            result.numExcluded = numExcluded;
+            for (size_t i = 0; i < numExcluded; ++i) {
+                result.excluded[i] = func(excluded[i]);
+            }
+            return result;
+        }
+
+    private:
+        struct Restrictor {
+            FilterRange & range;
+            const T predicate;
+            Restrictor(
+                    FilterRange & range,
+                    const T predicate)
+                    : range(range),
+                      predicate(predicate) {
+            }
+            void operator()(
+                    FilterConfiguration::None) {
+            }
+            void operator()(
+                    FilterConfiguration::LT) {
+                if (predicate == std::numeric_limits<T>::min()) {
+                    range.lo = std::numeric_limits<T>::max();
+                    range.hi = std::numeric_limits<T>::min();
+                } else {
+                    range.hi = std::min(range.hi, static_cast<T>(predicate - 1));
+                }
+            }
+            void operator()(
+                    FilterConfiguration::LE) {
+                range.hi = std::min(range.hi, predicate);
+            }
+            void operator()(
+                    FilterConfiguration::EQ) {
+                range.lo = std::max(range.lo, predicate);
+                range.hi = std::min(range.hi, predicate);
+            }
+            void operator()(
+                    FilterConfiguration::NE) {
+                range.excluded[range.numExcluded++] = predicate;
+            }
+            void operator()(
+                    FilterConfiguration::GE) {
+                range.lo = std::max(range.lo, predicate);
+            }
+            void operator()(
+                    FilterConfiguration::GT) {
+                if (predicate == std::numeric_limits<T>::max()) {
+                    range.lo = std::numeric_limits<T>::max();
+                    range.hi = std::numeric_limits<T>::min();
+                } else {
+                    range.lo = std::max(range.lo, static_cast<T>(predicate + 1));
+                }
+            }
+        };
+    };
+
+    /**
+     * Writes filter results as a bitmap with one bit per value: value i is bit (i % 8) of byte (i / 8).
+     * Bits are collected in a 64-bit word which is written whenever it is full. Call flush() after the last value.
+     */
+    class BitmapWriter {
+        uint8_t * out;
+        uint64_t word;
+        size_t numBits;
+
+        inline void store() {
+            memcpy(out, &word, sizeof(word));
+            out += sizeof(word);
+            word = 0;
+            numBits = 0;
+        }
+
+    public:
+        BitmapWriter(
+                const AlignedBlock & target)
+                : out(target.template begin<uint8_t>()),
+                  word(0),
+                  numBits(0) {
+        }
+
+        inline void append(
+                const bool bit) {
+            word |= static_cast<uint64_t>(bit) << numBits;
+            if (++numBits == (sizeof(word) * CHAR_BIT)) {
+                store();
+            }
+        }
+
+        /**
+         * Appends the n (<= 64) least significant bits of bits. All other bits must be zero.
+         */
+        inline void append(
+                const uint64_t bits,
+                const size_t n) {
+            word |= bits << numBits;
+            const size_t total = numBits + n;
+            if (total >= (sizeof(word) * CHAR_BIT)) {
+                store();
+                numBits = total - (sizeof(word) * CHAR_BIT);
+                word = numBits ? (bits >> (n - numBits)) : 0;
+            } else {
+                numBits = total;
+            }
+        }
+
+        /**
+         * Appends n copies of bit, e.g. one for each value of a block.
+         */
+        inline void appendRepeated(
+                const bool bit,
+                size_t n) {
+            const uint64_t bits = -static_cast<uint64_t>(bit);
+            for (; n >= (sizeof(word) * CHAR_BIT); n -= (sizeof(word) * CHAR_BIT)) {
+                append(bits, sizeof(word) * CHAR_BIT);
+            }
+            if (n) {
+                append(bits >> ((sizeof(word) * CHAR_BIT) - n), n);
+            }
+        }
+
+        void flush() {
+            if (numBits) {
+                memcpy(out, &word, (numBits + CHAR_BIT - 1) / CHAR_BIT);
+                out += (numBits + CHAR_BIT - 1) / CHAR_BIT;
+                word = 0;
+                numBits = 0;
+            }
+        }
+    };
+
+#if defined(__SSE4_2__) or defined(__AVX2__) or defined(__AVX512F__)
+    /**
+     * Evaluates a FilterRange on all lanes of a SIMD register at once, resulting in one bit per lane.
+     * Only >=, <= and == are used, because these respect the signedness of T in all SIMD implementations.
+     */
+    template<typename VEC, typename T>
+    struct FilterMatcher {
+        typedef typename simd::mm<VEC, T>::mask_t mask_t;
+        static const constexpr size_t NUM_VALUES_PER_VECTOR = sizeof(VEC) / sizeof(T);
+
+        const VEC mmLo;
+        const VEC mmHi;
+        const VEC mmExcluded0;
+        const VEC mmExcluded1;
+        const size_t numExcluded;
+
+        FilterMatcher(
+                const FilterRange<T> & range)
+                : mmLo(simd::mm<VEC, T>::set1(range.lo)),
+                  mmHi(simd::mm<VEC, T>::set1(range.hi)),
+                  mmExcluded0(simd::mm<VEC, T>::set1(range.excluded[0])),
+                  mmExcluded1(simd::mm<VEC, T>::set1(range.excluded[1])),
+                  numExcluded(range.numExcluded) {
+        }
+
+        inline mask_t match(
+                VEC mm) const {
+            mask_t mask = simd::mm_op<VEC, T, std::greater_equal>::cmp_mask(mm, mmLo) & simd::mm_op<VEC, T, std::less_equal>::cmp_mask(mm, mmHi);
+            if (numExcluded > 0) {
+                mask &= ~simd::mm_op<VEC, T, std::equal_to>::cmp_mask(mm, mmExcluded0);
+            }
+            if (numExcluded > 1) {
+                mask &= ~simd::mm_op<VEC, T, std::equal_to>::cmp_mask(mm, mmExcluded1);
+            }
+            return mask;
+        }
+    };
+#endif
+
+}
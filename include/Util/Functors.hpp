@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <climits>
 #include <cstring>
 #include <utility>
 
@@ -373,10 +374,10 @@ namespace coding_benchmark {
         constexpr
         auto operator()(
                 _Tp && __t,
-                _Up && __u) const noexcept(noexcept(std::forward<_Tp>(__t) | std::forward<_Up>(__u)))
-                -> decltype(std::forward<_Tp>(__t) | std::forward<_Up>(__u))
+                _Up && __u) const noexcept(noexcept(std::forward<_Tp>(__t) ^ std::forward<_Up>(__u)))
+                -> decltype(std::forward<_Tp>(__t) ^ std::forward<_Up>(__u))
                 {
-            return std::forward<_Tp>(__t) | std::forward<_Up>(__u);
+            return std::forward<_Tp>(__t) ^ std::forward<_Up>(__u);
         }
     };
 
@@ -415,6 +416,101 @@ namespace coding_benchmark {
         }
     };
 
+    /**
+     * Bitwise complement of the first operand. Any further operand is ignored, so that the complement fits the binary
+     * arithmetic kernels, just like the SIMD variants of is_not.
+     */
+    template<typename _Op = void>
+    struct complement :
+            public logic_functor {
+        template<typename _Tp, typename ... _Types>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Types && ... args) const noexcept(noexcept(~ _Op().operator()(std::forward<_Tp>(__t), std::forward<_Types>(args)...)))
+                -> decltype(~ _Op().operator()(std::forward<_Tp>(__t), std::forward<_Types>(args)...))
+                {
+            return ~_Op().operator()(std::forward<_Tp>(__t), std::forward<_Types>(args)...);
+        }
+    };
+
+    template<>
+    struct complement<void> :
+            public logic_functor {
+        template<typename _Tp, typename ... _Types>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Types && ...) const noexcept(noexcept(~ std::forward<_Tp>(__t)))
+                -> decltype(~ std::forward<_Tp>(__t))
+                {
+            return ~std::forward<_Tp>(__t);
+        }
+    };
+
+    /**
+     * Shifts the first operand left by the second one, modulo the bit width of the first operand's type, so that any
+     * operand gives a defined shift.
+     */
+    template<typename _Op = void>
+    struct shift_left :
+            public logic_functor {
+        template<typename _Tp, typename ... _Types>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Types && ... args) const noexcept(noexcept(std::forward<_Tp>(__t) << (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT))))
+                -> decltype(std::forward<_Tp>(__t) << (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT)))
+                {
+            return std::forward<_Tp>(__t) << (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT));
+        }
+    };
+
+    template<>
+    struct shift_left<void> :
+            public logic_functor {
+        template<typename _Tp, typename _Up>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Up && __u) const noexcept(noexcept(std::forward<_Tp>(__t) << (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT))))
+                -> decltype(std::forward<_Tp>(__t) << (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT)))
+                {
+            return std::forward<_Tp>(__t) << (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT));
+        }
+    };
+
+    /**
+     * Shifts the first operand right by the second one, modulo the bit width of the first operand's type.
+     */
+    template<typename _Op = void>
+    struct shift_right :
+            public logic_functor {
+        template<typename _Tp, typename ... _Types>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Types && ... args) const noexcept(noexcept(std::forward<_Tp>(__t) >> (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT))))
+                -> decltype(std::forward<_Tp>(__t) >> (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT)))
+                {
+            return std::forward<_Tp>(__t) >> (_Op().operator()(std::forward<_Types>(args)...) % (sizeof(_Tp) * CHAR_BIT));
+        }
+    };
+
+    template<>
+    struct shift_right<void> :
+            public logic_functor {
+        template<typename _Tp, typename _Up>
+        constexpr
+        auto operator()(
+                _Tp && __t,
+                _Up && __u) const noexcept(noexcept(std::forward<_Tp>(__t) >> (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT))))
+                -> decltype(std::forward<_Tp>(__t) >> (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT)))
+                {
+            return std::forward<_Tp>(__t) >> (std::forward<_Up>(__u) % (sizeof(_Tp) * CHAR_BIT));
+        }
+    };
+
     template<typename _Op = void>
     struct eq :
             public comparator_functor {
@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <utility>
 #include <vector>
 
 #include <Util/TestInfo.hpp>
@@ -68,4 +69,79 @@ extern template void printResults<false>(
         std::vector<std::vector<TestInfos>> & results,
         OutputConfiguration config);
 
+/**
+ * Prints the timing statistics of all executed sub tests as a long-format CSV table, one line per test, unroll/block
+ * size and sub test. Does nothing unless each sub test was repeated (testConfig.numRepetitions > 1).
+ */
+void printStatistics(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the hardware performance counters of all executed sub tests, per processed value, as a long-format CSV table
+ * with one line per test, unroll/block size, sub test and counter, followed by the IPC. Does nothing unless
+ * testConfig.enablePerfCounters is set.
+ */
+void printCounters(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Compares the fused pipeline (see TestConfiguration::pipeline) of each test and unroll/block size against running the
+ * same operators phase at a time, in nanoseconds per value. Does nothing unless a pipeline is configured.
+ */
+void printPipeline(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the correcting sub tests of each test and unroll/block size at each rate of injected faults (see
+ * TestConfiguration::correctionErrorRates): the corrected and uncorrectable code words and nanoseconds per value. Does
+ * nothing unless error rates are configured.
+ */
+void printCorrection(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the check and the scrub of each test and unroll/block size which ran both, in nanoseconds per value.
+ */
+void printScrub(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints decode + consume of each test and unroll/block size which can decode as a view: the consumer reads the decoded
+ * copy or the encoded data in place, unchecked and checked, in nanoseconds per value.
+ */
+void printDecodeView(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the bitwise arithmetic (and, or, xor, not, shift left and right) of each test and unroll/block size which ran
+ * any of it, unchecked and checked, in nanoseconds per value.
+ */
+void printBitwise(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the check under faults of each test and unroll/block size at each fault rate (see TestConfiguration::faultRates):
+ * the detected and silently corrupted chunks, the corrupt and corrected values, the values flagged and missed by the
+ * scrub, and nanoseconds per value of the check and scrub under faults and of the check of the intact data. Does nothing
+ * unless fault rates are configured.
+ */
+void printFaults(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results);
+
+/**
+ * Prints the throughput of all executed sub tests of several runs (e.g. a sweep over the number of values) as a single
+ * long-format CSV table: values per nanosecond and bytes of unencoded data per cycle. The cycles are taken from the
+ * "cycles" performance counter if it was counted, otherwise from the nominal TSC frequency (see Stopwatch::TSCGHz).
+ */
+void printThroughput(
+        const std::vector<std::pair<TestConfiguration, std::vector<std::vector<TestInfos>>>> & runs);
+
 #endif /* OUTPUT_HPP */
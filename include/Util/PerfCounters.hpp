@@ -0,0 +1,90 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * A hardware performance counter, as understood by perf_event_open(2).
+ */
+struct PerfEvent {
+    std::string name;
+    uint32_t type; // PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE or PERF_TYPE_RAW
+    uint64_t config;
+
+    /**
+     * cycles, instructions, L1D read misses, LLC misses and branch misses.
+     */
+    static std::vector<PerfEvent> Defaults();
+
+    /**
+     * A model-specific event, e.g. {"uops_port0", 0x01A1} for UOPS_DISPATCHED.PORT_0 on Skylake.
+     */
+    static PerfEvent Raw(
+            const std::string & name,
+            uint64_t config);
+};
+
+/**
+ * Counts the given events for the calling thread (user space only) between Start() and Stop(), summing up over all
+ * Start()/Stop() pairs. The events form one group led by cycles (or else the first event), so that they are scheduled
+ * together and read at once; when the kernel multiplexes the group, the counts are scaled accordingly. A group needs
+ * enough hardware counters for all of its events. Events which cannot be opened (e.g. unsupported raw events,
+ * perf_event_paranoid > 2 or no counter left for the group) are skipped.
+ */
+class PerfCounters {
+
+    struct Counter {
+        PerfEvent event;
+        int fd;
+        uint64_t value;
+    };
+
+    std::vector<Counter> counters;
+
+public:
+    PerfCounters(
+            const std::vector<PerfEvent> & events);
+
+    PerfCounters(
+            const PerfCounters &) = delete;
+
+    ~PerfCounters();
+
+    PerfCounters & operator=(
+            const PerfCounters &) = delete;
+
+    /**
+     * Whether at least one event could be opened.
+     */
+    bool IsAvailable() const;
+
+    void Start();
+
+    void Stop();
+
+    /**
+     * Sets all accumulated counts to zero.
+     */
+    void Clear();
+
+    /**
+     * The accumulated counts of all opened events.
+     */
+    std::vector<std::pair<std::string, uint64_t>> Values() const;
+};
@@ -64,4 +64,10 @@ public:
     void Reset();
 
     int64_t Current();
+
+    /**
+     * The nominal frequency of the time stamp counter in GHz, calibrated once against the clock, or 0 where there is
+     * no TSC. Used to convert nanoseconds into (reference) cycles when no cycle counter is available.
+     */
+    static double TSCGHz();
 };
@@ -31,9 +31,11 @@
 #endif
 
 #include <Util/AlignedBlock.hpp>
+#include <Util/DecodeView.hpp>
 #include <Util/TestInfo.hpp>
 #include <Util/Helpers.hpp>
 #include <Util/Functors.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ErrorInfo.hpp>
 #include <Util/Intrinsics.hpp>
 #include <Util/TestConfiguration.hpp>
@@ -157,6 +159,44 @@ public:
 
     virtual size_t getEncodedDataTypeSize() = 0;
 
+    // Partitioning for data-parallel (OpenMP) execution
+    /**
+     * Number of values which are encoded together into an indivisible block (e.g. XOR and CRC blocks, Hamming SIMD vectors).
+     * Partitions never split such a block.
+     */
+    virtual size_t getEncodedBlockNumValues();
+
+    /**
+     * Number of bytes a single encoded block occupies in an encoded buffer.
+     */
+    virtual size_t getEncodedBlockSize();
+
+    /**
+     * Returns the part of the given configuration which partition (thread) partitionId out of numPartitions works on.
+     * Partitions start on encoded block boundaries and, where there are enough values, on cache line boundaries in both buffers.
+     * The last partition also takes any remainder.
+     */
+    SubTestPartition GetPartition(
+            const SubTestConfiguration & config,
+            BufferLayout layoutSource,
+            BufferLayout layoutTarget,
+            size_t partitionId,
+            size_t numPartitions);
+
+    /**
+     * Number of bytes the first numValues values occupy in a buffer of the given layout. For BufferLayout::Encoded,
+     * numValues must be a multiple of getEncodedBlockNumValues().
+     */
+    size_t GetByteOffset(
+            BufferLayout layout,
+            size_t numValues);
+
+    /**
+     * Number of bytes numValues values occupy in an encoded buffer, including a partially filled last block.
+     */
+    size_t GetEncodedNumBytes(
+            size_t numValues);
+
     // Encoding
     virtual void PreEncode(
             const EncodeConfiguration & config) = 0;
@@ -173,6 +213,12 @@ public:
     virtual void RunCheck(
             const CheckConfiguration & config);
 
+    // Scrub, i.e. check without stopping at the first error
+    virtual bool DoScrub();
+
+    virtual void RunScrub(
+            const ScrubConfiguration & config);
+
     // Filter
     virtual bool DoFilter();
 
@@ -256,6 +302,32 @@ public:
     virtual void RunDecodeChecked(
             const DecodeConfiguration & config) = 0;
 
+    // Decode as view, i.e. describe where the data words lie within config.source instead of copying them to config.target
+    virtual bool DoDecodeView();
+
+    virtual DecodeView RunDecodeView(
+            const DecodeConfiguration & config);
+
+    // Consume, i.e. sum up the values of a view, standing in for the operator downstream of decoding
+    virtual size_t RunConsume(
+            const DecodeView & view) = 0;
+
+    // Decode as view, check and consume in a single pass over config.source: each value is verified right where it is
+    // summed up. By default (for codes without a view of their own) RunCheck followed by RunConsume.
+    virtual size_t RunConsumeChecked(
+            const DecodeConfiguration & config);
+
+    // Single-Error Correction, run at each of TestConfiguration::correctionErrorRates
+    virtual bool DoCorrect();
+
+    // repairs the encoded data in config.target in place, config.source is the raw data
+    virtual void RunCorrect(
+            const CorrectConfiguration & config);
+
+    // decodes config.source into config.target, correcting the values but not the encoded data
+    virtual void RunDecodeCorrected(
+            const CorrectConfiguration & config);
+
     // Execute test:
     virtual TestInfos Execute(
             const TestConfiguration & config,
@@ -316,7 +388,7 @@ struct SIMDTest<__m128i> : public SSE42Test {
 
 #endif /* __SSE4_2__ */
 
-#ifdef __AVX2__
+#if defined(__AVX2__) or defined(RUNTIME_DISPATCH)
 
 extern template
 struct SIMDTestBase<__m256i > ;
@@ -342,9 +414,9 @@ struct SIMDTest<__m256i> : public AVX2Test {
     using AVX2Test::SIMDTestBase::ComputeEnd;
 };
 
-#endif /* __AVX2__ */
+#endif /* defined(__AVX2__) or defined(RUNTIME_DISPATCH) */
 
-#ifdef __AVX512F__
+#if defined(__AVX512F__) or defined(RUNTIME_DISPATCH)
 
 extern template
 struct SIMDTestBase<__m512i > ;
@@ -370,7 +442,7 @@ struct SIMDTest<__m512i> : public AVX512Test {
     using AVX512Test::SIMDTestBase::ComputeEnd;
 };
 
-#endif /* __AVX512F__ */
+#endif /* defined(__AVX512F__) or defined(RUNTIME_DISPATCH) */
 
 template<typename DATARAW, typename DATAENC>
 class Test :
@@ -454,10 +526,29 @@ public:
         this->internalPreCheckCalled = true;
     }
 
+private:
+    void ComputeFilterReference(
+            const FilterConfiguration & config) {
+        // here we prepare the bitmap of the raw data qualifying for the given predicates, against which the
+        // bitmap computed on the encoded data can be checked. The encoded operation will store its bitmap in
+        // bufResult, so we can check bufArith against bufResult then.
+        this->bufArith.clear();
+        const coding_benchmark::FilterRange<DATARAW> range(config);
+        coding_benchmark::BitmapWriter bitmap(this->bufArith);
+        auto beg = this->bufRaw.template begin<DATARAW>();
+        const auto end = beg + config.numValues;
+        while (beg < end) {
+            bitmap.append(range.matches(*beg++));
+        }
+        bitmap.flush();
+    }
+
+public:
     void PreFilter(
             const FilterConfiguration & config) {
         config.target.clear(); // make sure the target buffer is empty
         this->bufScratchPad.clear();
+        ComputeFilterReference(config);
         this->internalPreFilterCalled = true;
     }
 
@@ -465,6 +556,7 @@ public:
             const FilterConfiguration & config) {
         config.target.clear(); // make sure the target buffer is empty
         this->bufScratchPad.clear();
+        ComputeFilterReference(config);
         this->internalPreFilterCheckedCalled = true;
     }
 
@@ -514,6 +606,40 @@ private:
                 *out++ = *beg++ / config.operand;
             }
         }
+        template<template<typename = void> class Functor>
+        void impl() {
+            Functor<> functor;
+            auto beg = config.source.template begin<DATARAW>();
+            auto end = beg + config.numValues;
+            auto out = config.target.template begin<DATARAW>();
+            while (beg < end) {
+                *out++ = static_cast<DATARAW>(functor(*beg++, config.operand));
+            }
+        }
+        void operator()(
+                ArithmeticConfiguration::And) {
+            impl<coding_benchmark::and_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Or) {
+            impl<coding_benchmark::or_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Xor) {
+            impl<coding_benchmark::xor_is>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Not) {
+            impl<coding_benchmark::complement>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Shl) {
+            impl<coding_benchmark::shift_left>();
+        }
+        void operator()(
+                ArithmeticConfiguration::Shr) {
+            impl<coding_benchmark::shift_right>();
+        }
     };
 
 public:
@@ -547,6 +673,43 @@ public:
         this->internalPreArithmeticCheckedCalled = true;
     }
 
+protected:
+    /**
+     * Runs the operator of config on codes which are not closed under it (e.g. the bitwise ones on AN codes): decodes
+     * cache-sized chunks of config.source into the scratch pad, applies the operator to the raw values there and
+     * encodes them again into config.target. Each chunk consists of whole encoded blocks and uses the part of the
+     * scratch pad at the offset of config.target, so that concurrent partitions do not overlap.
+     */
+    void RunArithmeticReencode(
+            const ArithmeticConfiguration & config,
+            const bool checked) {
+        const constexpr size_t CHUNK_BYTES = 16 * 1024; // the decoded values stay in the L1 cache until they are encoded again
+        const size_t blockNumValues = this->getEncodedBlockNumValues();
+        const size_t chunkNumValues = std::max(CHUNK_BYTES / (sizeof(DATARAW) * blockNumValues), size_t(1)) * blockNumValues;
+        const AlignedBlock scratch(this->bufScratchPad, config.target.offset, std::min(chunkNumValues, config.numValues) * sizeof(DATARAW));
+        for (size_t offset = 0; offset < config.numValues; offset += chunkNumValues) {
+            const BasicTestConfiguration chunk(1, std::min(chunkNumValues, config.numValues - offset));
+            const size_t offsetEncoded = this->GetByteOffset(BufferLayout::Encoded, offset);
+            const AlignedBlock source(config.source, offsetEncoded, config.source.nBytes - offsetEncoded);
+            const AlignedBlock target(config.target, offsetEncoded, config.target.nBytes - offsetEncoded);
+            try {
+                if (checked) {
+                    this->RunDecodeChecked(DecodeConfiguration(chunk, source, scratch));
+                } else {
+                    this->RunDecode(DecodeConfiguration(chunk, source, scratch));
+                }
+            } catch (ErrorInfo & ei) {
+                if (ei.i && ei.i.value() != static_cast<size_t>(-1)) {
+                    ei.i = ei.i.value() + offset;
+                }
+                throw;
+            }
+            const ArithmeticConfiguration raw(chunk, scratch, scratch, config.mode, config.operand);
+            std::visit(Arithmetor(*this, raw), raw.mode);
+            this->RunEncode(EncodeConfiguration(chunk, scratch, target));
+        }
+    }
+
 private:
 
     struct Aggregator {
@@ -645,6 +808,26 @@ public:
         this->internalPreReencodeCheckedCalled = true;
     }
 
+    // the sum RunConsume adds up for numValues consecutive values
+    static size_t SumValues(
+            const DATARAW * values,
+            const size_t numValues) {
+        size_t sum = 0;
+        for (size_t i = 0; i < numValues; ++i) {
+            sum += static_cast<size_t>(values[i]);
+        }
+        return sum;
+    }
+
+    size_t RunConsume(
+            const DecodeView & view) override {
+        size_t sum = 0;
+        view.template forEachBlock<DATARAW>([&sum] (const DATARAW * values, size_t numValues) {
+            sum += SumValues(values, numValues);
+        });
+        return sum;
+    }
+
     void PreDecode(
             const DecodeConfiguration & config) {
         config.target.clear(); // make sure the target buffer is empty
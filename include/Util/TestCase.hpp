@@ -93,6 +93,10 @@ void TestCase(
     auto & vec = *vecTestInfos.rbegin();
     vec.reserve(ComputeNumRuns<UNROLL_LO, UNROLL_HI>::value);
     ExpandTest<TestType, UNROLL_LO, UNROLL_HI>::Execute(vec, pzsName, testConfig, dataGenConfig, bufRawdata, bufEncoded, bufResult, A, AInv);
+    for (auto & ti : vec) {
+        ti.A = A;
+        ti.AInv = AInv;
+    }
     std::clog << '#' << std::endl;
 }
 
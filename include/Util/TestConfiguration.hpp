@@ -21,9 +21,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <variant>
+#include <vector>
 
 #include <Util/AlignedBlock.hpp>
+#include <Util/FaultInjector.hpp>
+#include <Util/PerfCounters.hpp>
 
 /**
  * This benchmark suite has a structure where there are individual ``tests'' which
@@ -50,12 +55,71 @@ struct BasicTestConfiguration {
     }
 };
 
+/**
+ * The operators of the fused pipeline sub test (see TestConfiguration::pipeline). Each stage works on the output of the
+ * previous one, Check passes its input on unchanged. The arithmetic stages use the same operand as the arithmetic sub
+ * tests.
+ */
+enum class PipelineStage {
+    Encode, Check, Add, Sub, Mul, Div, AddChk, SubChk, MulChk, DivChk, Decode, DecodeChk
+};
+
+inline const char * getPipelineStageName(
+        PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::Encode:
+            return "encode";
+        case PipelineStage::Check:
+            return "check";
+        case PipelineStage::Add:
+            return "add";
+        case PipelineStage::Sub:
+            return "sub";
+        case PipelineStage::Mul:
+            return "mul";
+        case PipelineStage::Div:
+            return "div";
+        case PipelineStage::AddChk:
+            return "addChk";
+        case PipelineStage::SubChk:
+            return "subChk";
+        case PipelineStage::MulChk:
+            return "mulChk";
+        case PipelineStage::DivChk:
+            return "divChk";
+        case PipelineStage::Decode:
+            return "decode";
+        case PipelineStage::DecodeChk:
+        default:
+            return "decodeChk";
+    }
+}
+
+/**
+ * Whether each stage gets the data it works on: Encode takes raw data, all other stages take encoded data. A pipeline
+ * starts on the encoded data, or on the raw data if its first stage is Encode.
+ */
+inline bool isValidPipeline(
+        const std::vector<PipelineStage> & pipeline) {
+    bool isEncoded = pipeline.empty() || pipeline.front() != PipelineStage::Encode;
+    for (auto stage : pipeline) {
+        if ((stage == PipelineStage::Encode) == isEncoded) {
+            return false;
+        }
+        isEncoded = (stage != PipelineStage::Decode) && (stage != PipelineStage::DecodeChk);
+    }
+    return true;
+}
+
 /**
  * The TestConfiguration contains the settings
  */
 struct TestConfiguration :
         public BasicTestConfiguration {
     bool enableCheck;
+    bool enableScrub;
+    bool enableFilter;
+    bool enableFilterChk;
     bool enableArithmetic;
     bool enableArithmeticChk;
     bool enableAggregate;
@@ -63,23 +127,58 @@ struct TestConfiguration :
     bool enableReencodeChk;
     bool enableDecode;
     bool enableDecodeChk;
+    bool enableDecodeView; // decode + consume, with a decoded copy and in place, see TestBase::RunDecodeView
+    AllocationPolicy allocation; // for the data buffers, see AlignedBlock
+    size_t numRepetitions; // how often each sub test is timed, each time running numIterations times over the data
+    bool rejectOutliers; // see TimingSamples
+    bool enablePerfCounters; // count PerfEvent::Defaults() and perfEvents around each sub test (Linux only, not with OMP)
+    std::vector<PerfEvent> perfEvents;
+    std::vector<size_t> blockSizes; // the unroll / block sizes a TestCase runs, empty: all
+    std::vector<PipelineStage> pipeline; // operator chain run fused over cache-sized chunks and phase at a time, empty: disabled
+    size_t pipelineChunkBytes; // of encoded data per chunk of the fused pipeline and of the checks under faults
+    std::vector<double> correctionErrorRates; // faults per value injected before the correcting sub tests, empty: disabled
+    std::vector<double> faultRates; // faults per value injected between encoding and checking, empty: disabled
+    FaultSpec faultSpec; // the faults injected for correctionErrorRates and faultRates
 
     TestConfiguration(
             const size_t numIterations,
             const size_t numValues)
             : BasicTestConfiguration(numIterations, numValues),
               enableCheck(true),
+              enableScrub(true),
+              enableFilter(true),
+              enableFilterChk(true),
               enableArithmetic(true),
               enableArithmeticChk(true),
               enableAggregate(true),
               enableAggregateChk(true),
               enableReencodeChk(true),
               enableDecode(true),
-              enableDecodeChk(true) {
+              enableDecodeChk(true),
+              enableDecodeView(true),
+              allocation(),
+              numRepetitions(1),
+              rejectOutliers(true),
+              enablePerfCounters(false),
+              perfEvents(),
+              blockSizes(),
+              pipeline(),
+              pipelineChunkBytes(16 * 1024),
+              correctionErrorRates(),
+              faultRates(),
+              faultSpec() {
+    }
+
+    bool isBlockSizeEnabled(
+            const size_t blockSize) const {
+        return blockSizes.empty() || std::find(blockSizes.begin(), blockSizes.end(), blockSize) != blockSizes.end();
     }
 
     void disableAll() {
         enableCheck = false;
+        enableScrub = false;
+        enableFilter = false;
+        enableFilterChk = false;
         enableArithmetic = false;
         enableArithmeticChk = false;
         enableAggregate = false;
@@ -87,6 +186,10 @@ struct TestConfiguration :
         enableReencodeChk = false;
         enableDecode = false;
         enableDecodeChk = false;
+        enableDecodeView = false;
+        pipeline.clear();
+        correctionErrorRates.clear();
+        faultRates.clear();
     }
 };
 
@@ -115,6 +218,37 @@ struct SubTestConfiguration :
             const SubTestConfiguration &) = default;
 };
 
+/**
+ * Data-parallel (OpenMP) execution splits a SubTestConfiguration into one partition per thread.
+ * The source and target buffers of a sub test are laid out like the raw data, like the encoded data, or as a bitmap
+ * with one bit per value (filter results).
+ */
+enum class BufferLayout {
+    Raw, Encoded, Bitmap
+};
+
+/**
+ * A single thread's share of a SubTestConfiguration. The blocks are views into the original buffers,
+ * starting at the partition's first value.
+ */
+struct SubTestPartition {
+    const size_t offset; // index of the partition's first value
+    const size_t numValues;
+    const AlignedBlock source;
+    const AlignedBlock target;
+
+    SubTestPartition(
+            const size_t offset,
+            const size_t numValues,
+            AlignedBlock && source,
+            AlignedBlock && target)
+            : offset(offset),
+              numValues(numValues),
+              source(std::move(source)),
+              target(std::move(target)) {
+    }
+};
+
 struct EncodeConfiguration :
         public SubTestConfiguration {
     using SubTestConfiguration::SubTestConfiguration;
@@ -125,6 +259,16 @@ struct CheckConfiguration :
     using SubTestConfiguration::SubTestConfiguration;
 };
 
+/**
+ * Checks all of the encoded data in source instead of stopping at the first error. The target is a bitmap with one bit
+ * per value (see BitmapWriter), which is set for each corrupt value. Codes which detect errors per block (XOR, CRC)
+ * set the bits of all values of a corrupt block.
+ */
+struct ScrubConfiguration :
+        public SubTestConfiguration {
+    using SubTestConfiguration::SubTestConfiguration;
+};
+
 struct FilterConfiguration :
         public SubTestConfiguration {
     struct None {
@@ -207,7 +351,32 @@ struct ArithmeticConfiguration :
     };
     struct Div {
     };
-    typedef std::variant<Add, Sub, Mul, Div> Mode;
+    /**
+     * The bitwise operators: NOT ignores the operand and the shifts go by the operand modulo the bit width of the raw
+     * data type. Codes which are not closed under them decode, apply the operator and encode again, see
+     * Test::RunArithmeticReencode.
+     */
+    struct Bitwise {
+    };
+    struct And :
+            public Bitwise {
+    };
+    struct Or :
+            public Bitwise {
+    };
+    struct Xor :
+            public Bitwise {
+    };
+    struct Not :
+            public Bitwise {
+    };
+    struct Shl :
+            public Bitwise {
+    };
+    struct Shr :
+            public Bitwise {
+    };
+    typedef std::variant<Add, Sub, Mul, Div, And, Or, Xor, Not, Shl, Shr> Mode;
     Mode mode;
     size_t operand;
     ArithmeticConfiguration(
@@ -247,6 +416,30 @@ struct ArithmeticConfigurationModeName {
             ArithmeticConfiguration::Div) {
         return "div";
     }
+    const char * operator()(
+            ArithmeticConfiguration::And) {
+        return "and";
+    }
+    const char * operator()(
+            ArithmeticConfiguration::Or) {
+        return "or";
+    }
+    const char * operator()(
+            ArithmeticConfiguration::Xor) {
+        return "xor";
+    }
+    const char * operator()(
+            ArithmeticConfiguration::Not) {
+        return "not";
+    }
+    const char * operator()(
+            ArithmeticConfiguration::Shl) {
+        return "shl";
+    }
+    const char * operator()(
+            ArithmeticConfiguration::Shr) {
+        return "shr";
+    }
 };
 
 struct AggregateConfiguration :
@@ -296,6 +489,45 @@ struct AggregateConfigurationModeName {
     }
 };
 
+/**
+ * The numbers of code words the correcting sub tests repaired, and found to have more flipped bits than they can
+ * correct. Each partition (thread) adds its counts once it is done.
+ */
+struct CorrectionCounts {
+    std::atomic<size_t> numCorrected;
+    std::atomic<size_t> numUncorrectable;
+
+    CorrectionCounts()
+            : numCorrected(0),
+              numUncorrectable(0) {
+    }
+
+    void add(
+            const size_t corrected,
+            const size_t uncorrectable) {
+        numCorrected += corrected;
+        numUncorrectable += uncorrectable;
+    }
+
+    void clear() {
+        numCorrected = 0;
+        numUncorrectable = 0;
+    }
+};
+
+struct CorrectConfiguration :
+        public SubTestConfiguration {
+    CorrectionCounts & counts;
+    CorrectConfiguration(
+            const BasicTestConfiguration & config,
+            const AlignedBlock & source,
+            const AlignedBlock & target,
+            CorrectionCounts & counts)
+            : SubTestConfiguration(config, source, target),
+              counts(counts) {
+    }
+};
+
 struct ReencodeConfiguration :
         public SubTestConfiguration {
     size_t newA;
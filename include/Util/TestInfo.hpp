@@ -14,16 +14,38 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <optional>
+#include <utility>
 
 #include <Util/Stopwatch.hpp>
 
+/**
+ * The run times of all repetitions of a sub test.
+ */
+struct TimingSamples {
+    std::vector<int64_t> nanos;
+    bool rejectOutliers; // drop samples further than 3 scaled MADs (median absolute deviations) from the median
+    std::vector<std::pair<std::string, uint64_t>> counters; // hardware performance counters, summed up over all repetitions
+    size_t numValues; // processed in all repetitions together, for the per-value counters
+};
+
 struct TestInfo {
 
     bool isExecuted;
-    int64_t nanos;
+    int64_t nanos; // the median over all repetitions, used for the plain and relative result tables
+    size_t numRepetitions;
+    size_t numOutliers; // rejected repetitions, not included in any of the statistics
+    int64_t nanosMin;
+    int64_t nanosMedian;
+    int64_t nanosP90;
+    int64_t nanosP99;
+    double nanosMean;
+    double nanosStddev;
+    std::vector<std::pair<std::string, double>> countersPerValue; // see TestConfiguration::enablePerfCounters
+    double ipc; // instructions per cycle, 0 when not counted
     std::string error;
 
     TestInfo();
@@ -47,6 +69,9 @@ struct TestInfo {
     void set(
             int64_t nanos);
 
+    void set(
+            const TimingSamples & samples);
+
     void set(
             const std::string & error);
 
@@ -54,6 +79,48 @@ struct TestInfo {
             const TestInfo &);
 };
 
+/**
+ * The correcting sub tests at one rate of injected faults, see TestConfiguration::correctionErrorRates.
+ */
+struct CorrectionInfo {
+
+    double errorRate; // faults per value
+    size_t numFaults; // injected into the encoded data
+    size_t numCorrected; // code words, counted in a single pass of correct
+    size_t numUncorrectable;
+    TestInfo correct; // in place, a single pass per repetition
+    TestInfo decodeCorrected;
+
+    CorrectionInfo(
+            double errorRate,
+            size_t numFaults);
+};
+
+/**
+ * The check of the encoded data at one rate of injected faults, see TestConfiguration::faultRates. The data is checked
+ * in chunks, a chunk counts as detected if its check reports an error.
+ */
+struct FaultInfo {
+
+    double faultRate; // faults per value
+    size_t numFaults; // injected into the encoded data
+    size_t numBitsChanged; // stuck-at faults may leave a bit as it is
+    size_t numChunks;
+    size_t numDetected; // chunks
+    std::optional<size_t> numSilent; // undetected chunks with wrong decoded values, unless the test cannot decode
+    std::optional<size_t> numCorruptValues; // decoded values which differ from the raw data
+    std::optional<size_t> numCorrectedValues; // of numCorruptValues, for tests which can correct
+    std::optional<size_t> numFlaggedValues; // by the scrub, for tests which can scrub
+    std::optional<size_t> numMissedValues; // corrupt values the scrub did not flag
+    TestInfo check;
+    TestInfo scrub;
+
+    FaultInfo(
+            double faultRate,
+            size_t numFaults,
+            size_t numChunks);
+};
+
 struct TestInfos {
 
     size_t datawidth;
@@ -61,6 +128,8 @@ struct TestInfos {
     std::string simd;
     TestInfo encode;
     TestInfo check;
+    TestInfo filter;
+    TestInfo filterChecked;
     TestInfo add;
     TestInfo sub;
     TestInfo mul;
@@ -80,7 +149,31 @@ struct TestInfos {
     TestInfo reencodeChecked;
     TestInfo decode;
     TestInfo decodeChecked;
+    TestInfo pipelineFused; // TestConfiguration::pipeline over cache-sized chunks, set by TestBase::Execute
+    TestInfo pipelinePhased; // the same operators each over the whole data, one after the other
+    TestInfo scrub; // set by TestBase::Execute
+    TestInfo consumeDecoded; // decode and sum up the decoded copy, set by TestBase::Execute
+    TestInfo consumeView; // sum up the values in place, see TestBase::RunDecodeView
+    TestInfo consumeDecodedChecked;
+    TestInfo consumeViewChecked; // check and sum up in place in a single pass, see TestBase::RunConsumeChecked
+    TestInfo bitAnd; // the bitwise arithmetic modes, set by TestBase::Execute
+    TestInfo bitOr;
+    TestInfo bitXor;
+    TestInfo bitNot;
+    TestInfo shiftLeft;
+    TestInfo shiftRight;
+    TestInfo bitAndChecked;
+    TestInfo bitOrChecked;
+    TestInfo bitXorChecked;
+    TestInfo bitNotChecked;
+    TestInfo shiftLeftChecked;
+    TestInfo shiftRightChecked;
+    std::vector<CorrectionInfo> corrections; // one per TestConfiguration::correctionErrorRates, set by TestBase::Execute
+    std::vector<FaultInfo> faults; // one per TestConfiguration::faultRates, set by TestBase::Execute
     const TestInfos * reference;
+    size_t blockSize; // unroll or block size, set by ExpandTest
+    std::optional<size_t> A; // AN coding parameters, set by the TestCases for AN tests
+    std::optional<size_t> AInv;
 
     TestInfos(
             const size_t datawidth,
@@ -93,6 +186,8 @@ struct TestInfos {
             const std::string & simd,
             TestInfo & encode,
             TestInfo & check,
+            TestInfo & filter,
+            TestInfo & filterChecked,
             TestInfo & add,
             TestInfo & sub,
             TestInfo & mul,
@@ -119,6 +214,8 @@ struct TestInfos {
             const std::string & simd,
             TestInfo & encode,
             TestInfo & check,
+            TestInfo & filter,
+            TestInfo & filterChecked,
             TestInfo & add,
             TestInfo & sub,
             TestInfo & mul,
@@ -149,6 +246,11 @@ struct TestInfos {
             const TestInfos &) = default;
 };
 
+/**
+ * Short names of all sub tests, in the order of the columns of printResults, and the corresponding member of TestInfos.
+ */
+extern const std::array<std::pair<const char *, TestInfo TestInfos::*>, 42> TestInfosPhases;
+
 void setTestInfosReference(
         std::vector<TestInfos> & vecTarget,
         const std::vector<TestInfos> & vecReferences);
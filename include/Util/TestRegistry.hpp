@@ -0,0 +1,123 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   TestRegistry.hpp
+ *
+ * All test types the benchmark driver knows about. Each entry wraps the compile-time expansion of a test over the
+ * unroll / block sizes (TestCase), so that the driver can select the tests to run at run time.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Util/AlignedBlock.hpp>
+#include <Util/CPU.hpp>
+#include <Util/TestCase.hpp>
+
+/**
+ * Everything the test cases of one data width share: the buffers, A and its inverse (only used by AN tests), the
+ * configurations and the results.
+ */
+struct TestContext {
+    AlignedBlock & bufRawdata;
+    AlignedBlock & bufEncoded;
+    AlignedBlock & bufResult;
+    const size_t A;
+    const size_t AInv;
+    TestConfiguration & testConfig;
+    DataGenerationConfiguration & dataGenConfig;
+    std::vector<std::vector<TestInfos>> & vecTestInfos;
+};
+
+struct RegisteredTest {
+    std::string name; // e.g. "AN_avx2_16_32_u_inv", matched by the driver's name filters
+    std::string family; // Copy, XOR, AN, Hamming or CRC
+    CPU::ISA isa;
+    size_t datawidth; // of the unencoded data, in bits
+    bool usesA; // AN tests are run once for each A
+    std::function<void(TestContext &)> run; // appends one std::vector<TestInfos> to context.vecTestInfos
+
+    RegisteredTest(
+            const std::string & name,
+            const std::string & family,
+            CPU::ISA isa,
+            size_t datawidth,
+            bool usesA,
+            std::function<void(TestContext &)> && run)
+            : name(name),
+              family(family),
+              isa(isa),
+              datawidth(datawidth),
+              usesA(usesA),
+              run(std::move(run)) {
+    }
+};
+
+class TestRegistry {
+
+    std::vector<RegisteredTest> tests;
+
+    TestRegistry()
+            : tests() {
+    }
+
+public:
+    static TestRegistry & Instance();
+
+    /**
+     * Registers a test of the form TestType(name, bufRaw, bufEncoded, bufResult).
+     */
+    template<template<size_t BlockSize> class TestType, size_t UNROLL_LO, size_t UNROLL_HI>
+    void Add(
+            const char* const pzsType,
+            const char* const pzsName,
+            const char* const family,
+            CPU::ISA isa,
+            size_t datawidth) {
+        tests.emplace_back(pzsType, family, isa, datawidth, false, [pzsType, pzsName] (TestContext & ctx) {
+            TestCase<TestType, UNROLL_LO, UNROLL_HI>(pzsType, pzsName, ctx.bufRawdata, ctx.bufEncoded, ctx.bufResult, ctx.testConfig, ctx.dataGenConfig, ctx.vecTestInfos);
+        });
+    }
+
+    /**
+     * Registers a test of the form TestType(name, bufRaw, bufEncoded, bufResult, A, AInv).
+     */
+    template<template<size_t BlockSize> class TestType, size_t UNROLL_LO, size_t UNROLL_HI>
+    void AddAN(
+            const char* const pzsType,
+            const char* const pzsName,
+            CPU::ISA isa,
+            size_t datawidth) {
+        tests.emplace_back(pzsType, "AN", isa, datawidth, true, [pzsType, pzsName] (TestContext & ctx) {
+            TestCase<TestType, UNROLL_LO, UNROLL_HI>(pzsType, pzsName, ctx.bufRawdata, ctx.bufEncoded, ctx.bufResult, ctx.A, ctx.AInv, ctx.testConfig, ctx.dataGenConfig, ctx.vecTestInfos);
+        });
+    }
+
+    const std::vector<RegisteredTest> & Tests() const;
+};
+
+/**
+ * Shell-style wildcard match of the whole name: '*' matches any sequence, '?' any single character.
+ */
+bool matchesPattern(
+        const std::string & pattern,
+        const std::string & name);
+
+const char* getISAName(
+        CPU::ISA isa);
@@ -24,6 +24,7 @@
 #include <Util/ErrorInfo.hpp>
 #include <Util/Functors.hpp>
 #include <Util/Helpers.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
 
@@ -38,6 +39,14 @@ namespace coding_benchmark {
         virtual ~XOR_scalar() {
         }
 
+        size_t getEncodedBlockNumValues() override {
+            return BLOCKSIZE;
+        }
+
+        size_t getEncodedBlockSize() override {
+            return BLOCKSIZE * sizeof(DATA) + sizeof(CS);
+        }
+
         void RunEncode(
                 const EncodeConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
@@ -114,6 +123,176 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto data = config.source.template begin<CS>();
+                if (config.numValues >= BLOCKSIZE) {
+                    while (i <= (config.numValues - BLOCKSIZE)) {
+                        auto data2 = reinterpret_cast<DATA*>(data);
+                        DATA checksum = 0;
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            checksum ^= *data2++;
+                        }
+                        i += BLOCKSIZE;
+                        data = reinterpret_cast<CS*>(data2);
+                        bitmap.appendRepeated(XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum)), BLOCKSIZE);
+                        ++data;
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (i < config.numValues) {
+                    auto data2 = reinterpret_cast<DATA*>(data);
+                    DATA checksum = 0;
+                    const size_t numRemaining = config.numValues - i;
+                    do {
+                        ++i;
+                        checksum ^= *data2++;
+                    } while (i < config.numValues);
+                    data = reinterpret_cast<CS*>(data2);
+                    bitmap.appendRepeated(XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum)), numRemaining);
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATA> range(config);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto data = config.source.template begin<CS>();
+                if (config.numValues >= BLOCKSIZE) {
+                    while (i <= (config.numValues - BLOCKSIZE)) {
+                        auto data2 = reinterpret_cast<DATA*>(data);
+                        DATA checksum = 0;
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            const auto tmp = *data2++;
+                            if constexpr (check) {
+                                checksum ^= tmp;
+                            }
+                            bitmap.append(range.matches(tmp));
+                        }
+                        i += BLOCKSIZE;
+                        data = reinterpret_cast<CS*>(data2);
+                        if constexpr (check) {
+                            if (XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum))) {
+                                throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                            }
+                        }
+                        ++data;
+                    }
+                }
+                // filter remaining values which do not fit in the block size
+                if (i < config.numValues) {
+                    auto data2 = reinterpret_cast<DATA*>(data);
+                    DATA checksum = 0;
+                    do {
+                        ++i;
+                        const auto tmp = *data2++;
+                        if constexpr (check) {
+                            checksum ^= tmp;
+                        }
+                        bitmap.append(range.matches(tmp));
+                    } while (i < config.numValues);
+                    data = reinterpret_cast<CS*>(data2);
+                    if constexpr (check) {
+                        if (XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum))) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
+                    }
+                }
+                bitmap.flush();
+            }
+        }
+
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
+        /**
+         * Xor and Not XOR each value with a mask, which commutes with the checksum: the checksum of n values changes by the
+         * mask folded n times, i.e. by the mask if n is odd and by 0 if it is even. So the new checksum is the stored one
+         * XOR the folded mask, and the old one is only recomputed to verify it.
+         */
+        template<bool check>
+        void ArithmeticXor(
+                const ArithmeticConfiguration & config,
+                const DATA mask,
+                const size_t iteration) {
+            const CS csMaskBlock = XOR<DATA, CS>::computeFinalChecksum((BLOCKSIZE & 1) ? mask : DATA(0));
+            size_t i = 0;
+            auto dataIn = config.source.template begin<CS>();
+            auto dataOut = config.target.template begin<DATA>();
+            if (config.numValues >= BLOCKSIZE) {
+                for (; i <= (config.numValues - BLOCKSIZE); i += BLOCKSIZE) {
+                    DATA __attribute__((unused)) oldChecksum = 0;
+                    auto dataIn2 = reinterpret_cast<DATA*>(dataIn);
+                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                        const auto tmp = *dataIn2++;
+                        if constexpr (check) {
+                            oldChecksum ^= tmp;
+                        }
+                        *dataOut++ = static_cast<DATA>(tmp ^ mask);
+                    }
+                    dataIn = reinterpret_cast<CS*>(dataIn2);
+                    if constexpr (check) {
+                        if (XORdiff<CS>::checksumsDiffer(*dataIn, XOR<DATA, CS>::computeFinalChecksum(oldChecksum))) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
+                    }
+                    auto chkOut = reinterpret_cast<CS*>(dataOut);
+                    *chkOut++ = static_cast<CS>(*dataIn++ ^ csMaskBlock);
+                    dataOut = reinterpret_cast<DATA*>(chkOut);
+                }
+            }
+            // checksum remaining values which do not fit in the block size
+            if (i < config.numValues) {
+                const CS csMaskRest = XOR<DATA, CS>::computeFinalChecksum(((config.numValues - i) & 1) ? mask : DATA(0));
+                DATA __attribute__((unused)) oldChecksum = 0;
+                auto dataIn2 = reinterpret_cast<DATA*>(dataIn);
+                for (; i < config.numValues; ++i) {
+                    const auto tmp = *dataIn2++;
+                    if constexpr (check) {
+                        oldChecksum ^= tmp;
+                    }
+                    *dataOut++ = static_cast<DATA>(tmp ^ mask);
+                }
+                dataIn = reinterpret_cast<CS*>(dataIn2);
+                if constexpr (check) {
+                    if (XORdiff<CS>::checksumsDiffer(*dataIn, XOR<DATA, CS>::computeFinalChecksum(oldChecksum))) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                    }
+                }
+                auto chkOut = reinterpret_cast<CS*>(dataOut);
+                *chkOut = static_cast<CS>(*dataIn ^ csMaskRest);
+            }
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -178,6 +357,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                test.template ArithmeticXor<false>(config, static_cast<DATA>(config.operand), 0);
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                test.template ArithmeticXor<false>(config, static_cast<DATA>(~DATA(0)), 0);
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmetic(
@@ -272,6 +475,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                test.template ArithmeticXor<true>(config, static_cast<DATA>(config.operand), iteration);
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                test.template ArithmeticXor<true>(config, static_cast<DATA>(~DATA(0)), iteration);
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmeticChecked(
@@ -515,6 +742,59 @@ namespace coding_benchmark {
                 }
             }
         }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // the data words of each block precede its checksum
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            const size_t numBlocks = config.numValues / BLOCKSIZE;
+            auto data = config.source.template begin<uint8_t>();
+            DecodeView view;
+            view.append(data, numBlocks, BLOCKSIZE, this->getEncodedBlockSize());
+            view.append(data + numBlocks * this->getEncodedBlockSize(), 1, config.numValues % BLOCKSIZE, 0);
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: the values of each block are summed up while its checksum is computed
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            size_t sum = 0;
+            size_t i = 0;
+            auto data = config.source.template begin<CS>();
+            if (config.numValues >= BLOCKSIZE) {
+                while (i <= (config.numValues - BLOCKSIZE)) {
+                    auto data2 = reinterpret_cast<DATA*>(data);
+                    DATA checksum = 0;
+                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                        checksum ^= data2[k];
+                        sum += static_cast<size_t>(data2[k]);
+                    }
+                    i += BLOCKSIZE;
+                    data = reinterpret_cast<CS*>(data2 + BLOCKSIZE);
+                    if (XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum))) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                    }
+                    ++data;
+                }
+            }
+            if (i < config.numValues) {
+                auto data2 = reinterpret_cast<DATA*>(data);
+                DATA checksum = 0;
+                do {
+                    ++i;
+                    checksum ^= *data2;
+                    sum += static_cast<size_t>(*data2++);
+                } while (i < config.numValues);
+                data = reinterpret_cast<CS*>(data2);
+                if (XORdiff<CS>::checksumsDiffer(*data, XOR<DATA, CS>::computeFinalChecksum(checksum))) {
+                    throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                }
+            }
+            return sum;
+        }
     };
 
 }
@@ -27,6 +27,7 @@
 #define XOR_SIMD
 
 #include <XOR/XOR_simd.tcc>
+#include <XOR/XOR_simd_nt.tcc>
 
 #undef XOR_SIMD
 
@@ -166,6 +167,78 @@ namespace coding_benchmark {
     extern template
     struct XOR_sse42_8x16_8x16<1024> ;
 
+    /**
+     * XOR_sse42_4x32_4x32 with streaming stores, see XOR_simd_nt.
+     */
+    template<size_t BLOCKSIZE>
+    struct XOR_sse42_4x32_4x32_nt :
+            public XOR_simd_nt<uint32_t, __m128i, BLOCKSIZE, STREAM_PREFETCH> {
+
+        using XOR_simd_nt<uint32_t, __m128i, BLOCKSIZE, STREAM_PREFETCH>::XOR_simd_nt;
+
+        virtual ~XOR_sse42_4x32_4x32_nt() {
+        }
+    };
+
+    /**
+     * XOR_sse42_8x16_8x16 with streaming stores, see XOR_simd_nt.
+     */
+    template<size_t BLOCKSIZE>
+    struct XOR_sse42_8x16_8x16_nt :
+            public XOR_simd_nt<uint16_t, __m128i, BLOCKSIZE, STREAM_PREFETCH> {
+
+        using XOR_simd_nt<uint16_t, __m128i, BLOCKSIZE, STREAM_PREFETCH>::XOR_simd_nt;
+
+        virtual ~XOR_sse42_8x16_8x16_nt() {
+        }
+    };
+
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<1> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<2> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<4> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<8> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<16> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<32> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<64> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<128> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<256> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<512> ;
+    extern template
+    struct XOR_sse42_4x32_4x32_nt<1024> ;
+
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<1> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<2> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<4> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<8> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<16> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<32> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<64> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<128> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<256> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<512> ;
+    extern template
+    struct XOR_sse42_8x16_8x16_nt<1024> ;
+
 #endif /* __SSE4_2__ */
 
 #ifdef __AVX2__
@@ -302,6 +375,78 @@ namespace coding_benchmark {
     extern template
     struct XOR_avx2_8x32_8x32<1024> ;
 
+    /**
+     * XOR_avx2_16x16_16x16 with streaming stores, see XOR_simd_nt.
+     */
+    template<size_t BLOCKSIZE>
+    struct XOR_avx2_16x16_16x16_nt :
+            public XOR_simd_nt<uint16_t, __m256i, BLOCKSIZE, STREAM_PREFETCH> {
+
+        using XOR_simd_nt<uint16_t, __m256i, BLOCKSIZE, STREAM_PREFETCH>::XOR_simd_nt;
+
+        virtual ~XOR_avx2_16x16_16x16_nt() {
+        }
+    };
+
+    /**
+     * XOR_avx2_8x32_8x32 with streaming stores, see XOR_simd_nt.
+     */
+    template<size_t BLOCKSIZE>
+    struct XOR_avx2_8x32_8x32_nt :
+            public XOR_simd_nt<uint32_t, __m256i, BLOCKSIZE, STREAM_PREFETCH> {
+
+        using XOR_simd_nt<uint32_t, __m256i, BLOCKSIZE, STREAM_PREFETCH>::XOR_simd_nt;
+
+        virtual ~XOR_avx2_8x32_8x32_nt() {
+        }
+    };
+
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<1> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<2> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<4> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<8> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<16> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<32> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<64> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<128> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<256> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<512> ;
+    extern template
+    struct XOR_avx2_16x16_16x16_nt<1024> ;
+
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<1> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<2> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<4> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<8> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<16> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<32> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<64> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<128> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<256> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<512> ;
+    extern template
+    struct XOR_avx2_8x32_8x32_nt<1024> ;
+
 #endif /* __AVX2__ */
 
 }
@@ -28,8 +28,10 @@
 
 #include <Util/Test.hpp>
 #include <XOR/XOR_base.hpp>
+#include <Util/Filter.hpp>
 #include <Util/ArithmeticSelector.hpp>
 #include <Util/AggregateSelector.hpp>
+#include <Util/Accumulators.hpp>
 #ifdef __SSE4_2__
 #include <SIMD/SSE.hpp>
 #endif
@@ -125,6 +127,14 @@ namespace coding_benchmark {
         virtual ~XOR_simd() {
         }
 
+        size_t getEncodedBlockNumValues() override {
+            return NUM_VALUES_PER_BLOCK;
+        }
+
+        size_t getEncodedBlockSize() override {
+            return BLOCKSIZE * sizeof(VEC) + sizeof(CS);
+        }
+
         void RunEncode(
                 const EncodeConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
@@ -223,6 +233,141 @@ namespace coding_benchmark {
             }
         }
 
+        bool DoScrub() override {
+            return true;
+        }
+
+        void RunScrub(
+                const ScrubConfiguration & config) override {
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto inV = config.source.template begin<VEC>();
+                if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                    for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                        VEC checksum = simd::mm<VEC>::setzero();
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, simd::mm<VEC>::loadu(inV++));
+                        }
+                        auto pChksum = reinterpret_cast<CS*>(inV);
+                        bitmap.appendRepeated(XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum)), NUM_VALUES_PER_BLOCK);
+                        inV = reinterpret_cast<VEC *>(pChksum + 1);
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                    VEC checksum = simd::mm<VEC>::setzero();
+                    const size_t begin = i;
+                    do {
+                        checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, simd::mm<VEC>::loadu(inV++));
+                        i += NUM_VALUES_PER_SIMDREG;
+                    } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                    auto pChksum = reinterpret_cast<CS*>(inV);
+                    bitmap.appendRepeated(XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum)), i - begin);
+                    inV = reinterpret_cast<VEC *>(pChksum + 1);
+                }
+                // checksum remaining integers which do not fit in the SIMD register
+                if (i < config.numValues) {
+                    DATA checksum = 0;
+                    auto inS = reinterpret_cast<DATA*>(inV);
+                    const size_t begin = i;
+                    for (; i < config.numValues; ++i) {
+                        checksum ^= *inS++;
+                    }
+                    bitmap.appendRepeated(XORdiff<DATA>::checksumsDiffer(*inS, checksum), i - begin);
+                }
+                bitmap.flush();
+            }
+        }
+
+        template<bool check>
+        void InternalFilter(
+                const FilterConfiguration & config) {
+            const FilterRange<DATA> range(config);
+            const FilterMatcher<VEC, DATA> matcher(range);
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                BitmapWriter bitmap(config.target);
+                size_t i = 0;
+                auto inV = config.source.template begin<VEC>();
+                if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                    for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                        VEC checksum = simd::mm<VEC>::setzero();
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            auto tmp = simd::mm<VEC>::loadu(inV++);
+                            if constexpr (check) {
+                                checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, tmp);
+                            }
+                            bitmap.append(static_cast<uint64_t>(matcher.match(tmp)), NUM_VALUES_PER_SIMDREG);
+                        }
+                        auto pChksum = reinterpret_cast<CS*>(inV);
+                        if constexpr (check) {
+                            if (XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum))) {
+                                throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                            }
+                        }
+                        inV = reinterpret_cast<VEC *>(pChksum + 1);
+                    }
+                }
+                // filter remaining values which do not fit in the block size
+                if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                    VEC checksum = simd::mm<VEC>::setzero();
+                    do {
+                        auto tmp = simd::mm<VEC>::loadu(inV++);
+                        if constexpr (check) {
+                            checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, tmp);
+                        }
+                        bitmap.append(static_cast<uint64_t>(matcher.match(tmp)), NUM_VALUES_PER_SIMDREG);
+                        i += NUM_VALUES_PER_SIMDREG;
+                    } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                    auto pChksum = reinterpret_cast<CS*>(inV);
+                    if constexpr (check) {
+                        if (XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum))) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
+                    }
+                    inV = reinterpret_cast<VEC *>(pChksum + 1);
+                }
+                // filter remaining integers which do not fit in the SIMD register
+                if (i < config.numValues) {
+                    DATA checksum = 0;
+                    auto inS = reinterpret_cast<DATA*>(inV);
+                    for (; i < config.numValues; ++i) {
+                        auto tmp = *inS++;
+                        if constexpr (check) {
+                            checksum ^= tmp;
+                        }
+                        bitmap.append(range.matches(tmp));
+                    }
+                    if constexpr (check) {
+                        if (XORdiff<DATA>::checksumsDiffer(*inS, checksum)) {
+                            throw ErrorInfo(__FILE__, __LINE__, i, iteration);
+                        }
+                    }
+                }
+                bitmap.flush();
+            }
+        }
+
+        bool DoFilter() override {
+            return true;
+        }
+
+        void RunFilter(
+                const FilterConfiguration & config) override {
+            InternalFilter<false>(config);
+        }
+
+        bool DoFilterChecked() override {
+            return true;
+        }
+
+        void RunFilterChecked(
+                const FilterConfiguration & config) override {
+            InternalFilter<true>(config);
+        }
+
         bool DoArithmetic(
                 const ArithmeticConfiguration & config) override {
             return std::visit(ArithmeticSelector(), config.mode);
@@ -321,6 +466,87 @@ namespace coding_benchmark {
                     }
                 }
             }
+            /**
+             * Xor and Not XOR each value with a mask, which commutes with the checksum: each lane of the checksum of n
+             * vectors changes by the mask folded n times, i.e. by the mask if n is odd and by 0 if it is even. So the new
+             * checksum is the stored one XOR the folded mask, and the old one is only recomputed to verify it.
+             */
+            void implXor(
+                    const VEC mmMask,
+                    const DATA mask) {
+                size_t i = 0;
+                auto inV = config.source.template begin<VEC>();
+                auto outV = config.target.template begin<VEC>();
+                VEC mmMaskBlock = (BLOCKSIZE & 1) ? mmMask : simd::mm<VEC>::setzero();
+                const CS csMaskBlock = XOR<VEC, CS>::computeFinalChecksum(mmMaskBlock);
+                if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                    for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                        VEC __attribute__((unused)) oldChecksum = simd::mm<VEC>::setzero();
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            auto mmTmp = simd::mm<VEC>::loadu(inV++);
+                            if constexpr (check) {
+                                oldChecksum = simd::mm_op<VEC, DATA, xor_is>::cmp(oldChecksum, mmTmp);
+                            }
+                            simd::mm<VEC>::storeu(outV++, simd::mm_op<VEC, DATA, xor_is>::compute(mmTmp, mmMask));
+                        }
+                        CS * const pStoredChecksum = reinterpret_cast<CS*>(inV);
+                        if constexpr (check) {
+                            if (XORdiff<CS>::checksumsDiffer(*pStoredChecksum, XOR<VEC, CS>::computeFinalChecksum(oldChecksum))) {
+                                throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inV) - config.source.template begin<DATA>(), iteration);
+                            }
+                        }
+                        auto pChkOut = reinterpret_cast<CS*>(outV);
+                        *pChkOut++ = static_cast<CS>(*pStoredChecksum ^ csMaskBlock);
+                        outV = reinterpret_cast<VEC *>(pChkOut);
+                        inV = reinterpret_cast<VEC *>(pStoredChecksum + 1);
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                    VEC __attribute__((unused)) oldChecksum = simd::mm<VEC>::setzero();
+                    size_t numVectors = 0;
+                    do {
+                        auto mmTmp = simd::mm<VEC>::loadu(inV++);
+                        if constexpr (check) {
+                            oldChecksum = simd::mm_op<VEC, DATA, xor_is>::cmp(oldChecksum, mmTmp);
+                        }
+                        simd::mm<VEC>::storeu(outV++, simd::mm_op<VEC, DATA, xor_is>::compute(mmTmp, mmMask));
+                        ++numVectors;
+                        i += NUM_VALUES_PER_SIMDREG;
+                    } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                    CS * const pStoredChecksum = reinterpret_cast<CS*>(inV);
+                    if constexpr (check) {
+                        if (XORdiff<CS>::checksumsDiffer(*pStoredChecksum, XOR<VEC, CS>::computeFinalChecksum(oldChecksum))) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inV) - config.source.template begin<DATA>(), iteration);
+                        }
+                    }
+                    VEC mmMaskRest = (numVectors & 1) ? mmMask : simd::mm<VEC>::setzero();
+                    auto pChkOut = reinterpret_cast<CS*>(outV);
+                    *pChkOut++ = static_cast<CS>(*pStoredChecksum ^ XOR<VEC, CS>::computeFinalChecksum(mmMaskRest));
+                    outV = reinterpret_cast<VEC *>(pChkOut);
+                    inV = reinterpret_cast<VEC *>(pStoredChecksum + 1);
+                }
+                // checksum remaining integers which do not fit in the SIMD register
+                if (i < config.numValues) {
+                    const DATA maskRest = ((config.numValues - i) & 1) ? mask : 0;
+                    DATA __attribute__((unused)) oldChecksum = 0;
+                    auto inS = reinterpret_cast<DATA*>(inV);
+                    auto outS = reinterpret_cast<DATA*>(outV);
+                    for (; i < config.numValues; ++i) {
+                        auto tmp = *inS++;
+                        if constexpr (check) {
+                            oldChecksum ^= tmp;
+                        }
+                        *outS++ = static_cast<DATA>(tmp ^ mask);
+                    }
+                    if constexpr (check) {
+                        if (XORdiff<DATA>::checksumsDiffer(*inS, oldChecksum)) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inS) - config.source.template begin<DATA>(), iteration);
+                        }
+                    }
+                    *outS = static_cast<DATA>(*inS ^ maskRest);
+                }
+            }
             void operator()(
                     ArithmeticConfiguration::Add) {
                 impl<add>();
@@ -337,6 +563,30 @@ namespace coding_benchmark {
                     ArithmeticConfiguration::Div) {
                 impl<div>();
             }
+            void operator()(
+                    ArithmeticConfiguration::And) {
+                impl<and_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Or) {
+                impl<or_is>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Xor) {
+                implXor(simd::mm<VEC, DATA>::set1(static_cast<DATA>(config.operand)), static_cast<DATA>(config.operand));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Not) {
+                implXor(simd::mm<VEC, DATA>::set1(static_cast<DATA>(~DATA(0))), static_cast<DATA>(~DATA(0)));
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shl) {
+                impl<shift_left>();
+            }
+            void operator()(
+                    ArithmeticConfiguration::Shr) {
+                impl<shift_right>();
+            }
         };
 
         void RunArithmetic(
@@ -360,7 +610,7 @@ namespace coding_benchmark {
             }
         }
 
-        template<bool check>
+        template<bool check, size_t K>
         struct Aggregator {
             typedef typename Larger<DATA>::larger_t larger_t;
             XOR_simd & test;
@@ -374,28 +624,32 @@ namespace coding_benchmark {
                       config(config),
                       iteration(iteration) {
             }
-            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
+            template<typename Aggregate, typename InitializeVector, typename KernelVector, typename CombineVector, typename KernelScalar, typename VectorToScalar, typename Finalize>
             void impl(
                     InitializeVector && funcInitVector,
                     KernelVector && funcKernelVector,
+                    CombineVector && funcCombineVector,
                     VectorToScalar && funcVectorToScalar,
                     KernelScalar && funcKernelScalar,
                     Finalize && funcFinal) {
+                auto funcInitChecksum = [] {return simd::mm<VEC>::setzero();};
+                auto __attribute__((unused)) funcCombineChecksum = [] (VEC mmChecksum1, VEC mmChecksum2) {return simd::mm_op<VEC, DATA, xor_is>::cmp(mmChecksum1, mmChecksum2);};
                 size_t i = 0;
                 auto inV = config.source.template begin<VEC>();
-                auto mmValue = funcInitVector();
+                Accumulators<VEC, K> mmValues(funcInitVector);
                 if (config.numValues >= NUM_VALUES_PER_BLOCK) {
                     for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
-                        VEC __attribute__((unused)) oldChecksum = simd::mm<VEC>::setzero();
+                        Accumulators<VEC, K> __attribute__((unused)) oldChecksums(funcInitChecksum);
                         for (size_t k = 0; k < BLOCKSIZE; ++k) {
                             auto mmTmp = simd::mm<VEC>::loadu(inV++);
                             if constexpr (check) {
-                                oldChecksum = simd::mm_op<VEC, DATA, xor_is>::cmp(oldChecksum, mmTmp);
+                                oldChecksums[k % K] = simd::mm_op<VEC, DATA, xor_is>::cmp(oldChecksums[k % K], mmTmp);
                             }
-                            mmValue = funcKernelVector(mmValue, mmTmp);
+                            mmValues[k % K] = funcKernelVector(mmValues[k % K], mmTmp);
                         }
                         CS * const pStoredChecksum = reinterpret_cast<CS*>(inV);
                         if constexpr (check) {
+                            VEC oldChecksum = oldChecksums.combine(funcCombineChecksum);
                             if (XORdiff<CS>::checksumsDiffer(*pStoredChecksum, XOR<VEC, CS>::computeFinalChecksum(oldChecksum))) {
                                 throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inV) - config.source.template begin<DATA>(), iteration);
                             }
@@ -405,13 +659,13 @@ namespace coding_benchmark {
                 }
                 // checksum remaining values which do not fit in the block size
                 if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
-                VEC __attribute__((unused)) oldChecksum = simd::mm<VEC>::setzero();
+                    VEC __attribute__((unused)) oldChecksum = simd::mm<VEC>::setzero();
                     do {
                         auto mmTmp = simd::mm<VEC>::loadu(inV++);
                         if constexpr (check) {
                             oldChecksum = simd::mm_op<VEC, DATA, xor_is>::cmp(oldChecksum, mmTmp);
                         }
-                        mmValue = funcKernelVector(mmValue, mmTmp);
+                        mmValues[0] = funcKernelVector(mmValues[0], mmTmp);
                         i += NUM_VALUES_PER_SIMDREG;
                     } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
                     CS * const pStoredChecksum = reinterpret_cast<CS*>(inV);
@@ -422,7 +676,7 @@ namespace coding_benchmark {
                     }
                     inV = reinterpret_cast<VEC *>(pStoredChecksum + 1);
                 }
-                Aggregate value = funcVectorToScalar(mmValue);
+                Aggregate value = funcVectorToScalar(mmValues.combine(funcCombineVector));
                 // checksum remaining integers which do not fit in the SIMD register, so we do it on the actual data width denoted by template parameter IN
                 if (i < config.numValues) {
                     DATA __attribute__((unused)) oldChecksum = 0;
@@ -450,29 +704,29 @@ namespace coding_benchmark {
                     AggregateConfiguration::Sum) {
                 impl<larger_t>([] {return simd::mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATA>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATA>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmValue) {return simd::mm<VEC, larger_t>::sum(mmValue);}, [](larger_t value, DATA tmp) {return value + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmValue) {return simd::mm<VEC, larger_t>::sum(mmValue);},
+                        [](larger_t value, DATA tmp) {return value + tmp;}, [](larger_t sum, size_t numValues) {return sum;});
             }
             void operator()(
                     AggregateConfiguration::Min) {
                 impl<DATA>([] {return simd::mm<VEC, DATA>::set1(std::numeric_limits<DATA>::max());}, [](VEC mmValue, VEC mmTmp) {return simd::mm<VEC, DATA>::min(mmValue, mmTmp);},
-                        [](VEC mmValue) {return simd::mm<VEC, DATA>::min(mmValue);}, [](DATA value, DATA tmp) {return value < tmp ? value : tmp;}, [](DATA min, size_t numValues) {return min;});
+                        [](VEC mmValue1, VEC mmValue2) {return simd::mm<VEC, DATA>::min(mmValue1, mmValue2);}, [](VEC mmValue) {return simd::mm<VEC, DATA>::min(mmValue);}, [](DATA value, DATA tmp) {return value < tmp ? value : tmp;}, [](DATA min, size_t numValues) {return min;});
             }
             void operator()(
                     AggregateConfiguration::Max) {
                 impl<DATA>([] {return simd::mm<VEC, DATA>::set1(std::numeric_limits<DATA>::min());}, [](VEC mmValue, VEC mmTmp) {return simd::mm<VEC, DATA>::max(mmValue, mmTmp);},
-                        [](VEC mmValue) {return simd::mm<VEC, DATA>::max(mmValue);}, [](DATA value, DATA tmp) {return value > tmp ? value : tmp;}, [](DATA max, size_t numValues) {return max;});
+                        [](VEC mmValue1, VEC mmValue2) {return simd::mm<VEC, DATA>::max(mmValue1, mmValue2);}, [](VEC mmValue) {return simd::mm<VEC, DATA>::max(mmValue);}, [](DATA value, DATA tmp) {return value > tmp ? value : tmp;}, [](DATA max, size_t numValues) {return max;});
             }
             void operator()(
                     AggregateConfiguration::Avg) {
                 impl<larger_t>([] {return simd::mm<VEC>::setzero();}, [](VEC mmSum, VEC mmTmp) {
                     auto mmLo = simd::mm<VEC, DATA>::cvt_larger_lo(mmTmp);
-                    mmLo = simd::mm_op<VEC, larger_t, add>::compute(mmSum, mmLo);
                     auto mmHi = simd::mm<VEC, DATA>::cvt_larger_hi(mmTmp);
-                    return simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi);
-                }, [](VEC mmValue) {return simd::mm<VEC, larger_t>::sum(mmValue);}, [](larger_t value, DATA tmp) {return value + tmp;}, [](larger_t sum, size_t numValues) {return sum / numValues;});
+                    return simd::mm_op<VEC, larger_t, add>::compute(mmSum, simd::mm_op<VEC, larger_t, add>::compute(mmLo, mmHi));
+                }, [](VEC mmSum1, VEC mmSum2) {return simd::mm_op<VEC, larger_t, add>::compute(mmSum1, mmSum2);}, [](VEC mmValue) {return simd::mm<VEC, larger_t>::sum(mmValue);},
+                        [](larger_t value, DATA tmp) {return value + tmp;}, [](larger_t sum, size_t numValues) {return sum / numValues;});
             }
         };
 
@@ -485,7 +739,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(Aggregator<false>(*this, config, iteration), config.mode);
+                std::visit(Aggregator<false, NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -498,7 +752,7 @@ namespace coding_benchmark {
                 const AggregateConfiguration & config) override {
             for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
                 _ReadWriteBarrier();
-                std::visit(Aggregator<true>(*this, config, iteration), config.mode);
+                std::visit(Aggregator<true, NUM_ACCUMULATORS>(*this, config, iteration), config.mode);
             }
         }
 
@@ -585,6 +839,78 @@ public:
                 const DecodeConfiguration & config) override {
             this->Decode<true>(config);
         }
+
+        bool DoDecodeView() override {
+            return true;
+        }
+
+        // the data vectors of each block precede its checksum, see RunEncode for the last, partially filled blocks
+        DecodeView RunDecodeView(
+                const DecodeConfiguration & config) override {
+            const size_t numBlocks = config.numValues / NUM_VALUES_PER_BLOCK;
+            const size_t numVectors = (config.numValues % NUM_VALUES_PER_BLOCK) / NUM_VALUES_PER_SIMDREG;
+            auto data = config.source.template begin<uint8_t>();
+            DecodeView view;
+            view.append(data, numBlocks, NUM_VALUES_PER_BLOCK, this->getEncodedBlockSize());
+            data += numBlocks * this->getEncodedBlockSize();
+            if (numVectors) {
+                view.append(data, 1, numVectors * NUM_VALUES_PER_SIMDREG, 0);
+                data += numVectors * sizeof(VEC) + sizeof(CS);
+            }
+            view.append(data, 1, config.numValues % NUM_VALUES_PER_SIMDREG, 0);
+            return view;
+        }
+
+        // RunCheck and RunConsume fused: the values of each block are summed up right after its checksum is computed,
+        // while they are still in the L1 cache
+        size_t RunConsumeChecked(
+                const DecodeConfiguration & config) override {
+            size_t sum = 0;
+            size_t i = 0;
+            auto inV = config.source.template begin<VEC>();
+            if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                    auto values = reinterpret_cast<const DATA*>(inV);
+                    VEC checksum = simd::mm<VEC>::setzero();
+                    for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                        checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, simd::mm<VEC>::loadu(inV++));
+                    }
+                    auto pChksum = reinterpret_cast<CS*>(inV);
+                    if (XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum))) {
+                        throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                    }
+                    sum += this->SumValues(values, NUM_VALUES_PER_BLOCK);
+                    inV = reinterpret_cast<VEC *>(pChksum + 1);
+                }
+            }
+            if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                auto values = reinterpret_cast<const DATA*>(inV);
+                const size_t begin = i;
+                VEC checksum = simd::mm<VEC>::setzero();
+                do {
+                    checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, simd::mm<VEC>::loadu(inV++));
+                    i += NUM_VALUES_PER_SIMDREG;
+                } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                auto pChksum = reinterpret_cast<CS*>(inV);
+                if (XORdiff<CS>::checksumsDiffer(*pChksum, XOR<VEC, CS>::computeFinalChecksum(checksum))) {
+                    throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                }
+                sum += this->SumValues(values, i - begin);
+                inV = reinterpret_cast<VEC *>(pChksum + 1);
+            }
+            if (i < config.numValues) {
+                DATA checksum = 0;
+                auto inS = reinterpret_cast<DATA*>(inV);
+                for (; i < config.numValues; ++i) {
+                    checksum ^= *inS;
+                    sum += static_cast<size_t>(*inS++);
+                }
+                if (XORdiff<DATA>::checksumsDiffer(*inS, checksum)) {
+                    throw ErrorInfo(__FILE__, __LINE__, i, 0);
+                }
+            }
+            return sum;
+        }
     };
 
 }
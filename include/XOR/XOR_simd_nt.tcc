@@ -0,0 +1,194 @@
+// Copyright 2016-2018 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   XOR_simd_nt.tcc
+ *
+ * Streaming-store variants of the XOR SIMD kernels with full-vector checksums, see SIMD/Stream.hpp.
+ */
+
+#pragma once
+
+#ifndef XOR_SIMD
+#error "Clients must not include this file directly, but file <XOR/XOR_simd.hpp>!"
+#endif
+
+#include <XOR/XOR_simd.tcc>
+#include <SIMD/Stream.hpp>
+
+namespace coding_benchmark {
+
+    /**
+     * XOR_simd with a full-vector checksum, but encoding and decoding write their output with streaming stores and
+     * prefetch their input PREFETCH bytes ahead (0: no prefetching). The checksum keeps the encoded blocks aligned to a
+     * vector, which narrower checksums would not. Targets which are not aligned to a vector fall back to the regular kernels.
+     */
+    template<typename DATA, typename VEC, size_t BLOCKSIZE, size_t PREFETCH>
+    struct XOR_simd_nt :
+            public XOR_simd<DATA, VEC, VEC, BLOCKSIZE> {
+
+        typedef XOR_simd<DATA, VEC, VEC, BLOCKSIZE> BASE;
+
+        using BASE::XOR_simd;
+        using BASE::NUM_VALUES_PER_SIMDREG;
+        using BASE::NUM_VALUES_PER_BLOCK;
+
+        virtual ~XOR_simd_nt() {
+        }
+
+        static inline void Prefetch(
+                const VEC * in) {
+            // one prefetch per cache line
+            if ((reinterpret_cast<uintptr_t>(in) % 64) < sizeof(VEC)) {
+                simd::prefetch_ahead<PREFETCH>(in);
+            }
+        }
+
+        void RunEncode(
+                const EncodeConfiguration & config) override {
+            if (!simd::is_stream_aligned<VEC>(config.target.begin())) {
+                BASE::RunEncode(config);
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                size_t i = 0;
+                auto inV = config.source.template begin<VEC>();
+                auto outV = config.target.template begin<VEC>();
+                if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                    for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                        VEC checksum = simd::mm<VEC>::setzero();
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            Prefetch(inV);
+                            auto tmp = simd::mm<VEC>::loadu(inV++);
+                            simd::mm_stream<VEC>::store(outV++, tmp);
+                            checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, tmp);
+                        }
+                        simd::mm_stream<VEC>::store(outV++, XOR<VEC, VEC>::computeFinalChecksum(checksum));
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                    VEC checksum = simd::mm<VEC>::setzero();
+                    do {
+                        auto tmp = simd::mm<VEC>::loadu(inV++);
+                        simd::mm_stream<VEC>::store(outV++, tmp);
+                        checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, tmp);
+                        i += NUM_VALUES_PER_SIMDREG;
+                    } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                    simd::mm_stream<VEC>::store(outV++, XOR<VEC, VEC>::computeFinalChecksum(checksum));
+                }
+                // checksum remaining integers which do not fit in the SIMD register
+                if (i < config.numValues) {
+                    DATA checksum = 0;
+                    auto inS = reinterpret_cast<DATA*>(inV);
+                    auto outS = reinterpret_cast<DATA*>(outV);
+                    for (; i < config.numValues; ++i) {
+                        auto tmp = *inS++;
+                        *outS++ = tmp;
+                        checksum ^= tmp;
+                    }
+                    *outS = checksum;
+                }
+                simd::stream_fence();
+            }
+        }
+
+        template<bool check>
+        void InternalDecode(
+                const DecodeConfiguration & config) {
+            if (!simd::is_stream_aligned<VEC>(config.target.begin())) {
+                if constexpr (check) {
+                    BASE::RunDecodeChecked(config);
+                } else {
+                    BASE::RunDecode(config);
+                }
+                return;
+            }
+            for (size_t iteration = 0; iteration < config.numIterations; ++iteration) {
+                _ReadWriteBarrier();
+                size_t i = 0;
+                auto inV = config.source.template begin<VEC>();
+                auto outV = config.target.template begin<VEC>();
+                if (config.numValues >= NUM_VALUES_PER_BLOCK) {
+                    for (; i <= (config.numValues - NUM_VALUES_PER_BLOCK); i += NUM_VALUES_PER_BLOCK) {
+                        VEC __attribute__((unused)) checksum = simd::mm<VEC>::setzero();
+                        for (size_t k = 0; k < BLOCKSIZE; ++k) {
+                            Prefetch(inV);
+                            VEC mmTmp = simd::mm<VEC>::loadu(inV++);
+                            if constexpr (check) {
+                                checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, mmTmp);
+                            }
+                            simd::mm_stream<VEC>::store(outV++, mmTmp);
+                        }
+                        if constexpr (check) {
+                            if (XORdiff<VEC>::checksumsDiffer(simd::mm<VEC>::loadu(inV), XOR<VEC, VEC>::computeFinalChecksum(checksum))) {
+                                throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inV) - config.source.template begin<DATA>(), iteration);
+                            }
+                        }
+                        ++inV;
+                    }
+                }
+                // checksum remaining values which do not fit in the block size
+                if (config.numValues >= NUM_VALUES_PER_SIMDREG && i <= (config.numValues - NUM_VALUES_PER_SIMDREG)) {
+                    VEC __attribute__((unused)) checksum = simd::mm<VEC>::setzero();
+                    do {
+                        VEC mmTmp = simd::mm<VEC>::loadu(inV++);
+                        if constexpr (check) {
+                            checksum = simd::mm_op<VEC, DATA, xor_is>::cmp(checksum, mmTmp);
+                        }
+                        simd::mm_stream<VEC>::store(outV++, mmTmp);
+                        i += NUM_VALUES_PER_SIMDREG;
+                    } while (i <= (config.numValues - NUM_VALUES_PER_SIMDREG));
+                    if constexpr (check) {
+                        if (XORdiff<VEC>::checksumsDiffer(simd::mm<VEC>::loadu(inV), XOR<VEC, VEC>::computeFinalChecksum(checksum))) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inV) - config.source.template begin<DATA>(), iteration);
+                        }
+                    }
+                    ++inV;
+                }
+                // checksum remaining integers which do not fit in the SIMD register
+                if (i < config.numValues) {
+                    DATA __attribute__((unused)) oldChecksum = 0;
+                    auto inS = reinterpret_cast<DATA*>(inV);
+                    auto outS = reinterpret_cast<DATA*>(outV);
+                    for (; i < config.numValues; ++i) {
+                        DATA tmp = *inS++;
+                        if constexpr (check) {
+                            oldChecksum ^= tmp;
+                        }
+                        *outS++ = tmp;
+                    }
+                    if constexpr (check) {
+                        if (XORdiff<DATA>::checksumsDiffer(*inS, oldChecksum)) {
+                            throw ErrorInfo(__FILE__, __LINE__, reinterpret_cast<DATA*>(inS) - config.source.template begin<DATA>(), iteration);
+                        }
+                    }
+                }
+                simd::stream_fence();
+            }
+        }
+
+        void RunDecode(
+                const DecodeConfiguration & config) override {
+            InternalDecode<false>(config);
+        }
+
+        void RunDecodeChecked(
+                const DecodeConfiguration & config) override {
+            InternalDecode<true>(config);
+        }
+    };
+
+}
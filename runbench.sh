@@ -1,5 +1,5 @@
 #!/bin/bash
 pushd build/Release
-make -j$(nproc) && (reset; ./benchmark16 1> >(tee benchmark.out) 2> >(tee benchmark.err >&2))
+make -j$(nproc) && (reset; ./coding_benchmark --datawidth 16 1> >(tee benchmark.out) 2> >(tee benchmark.err >&2))
 popd
 
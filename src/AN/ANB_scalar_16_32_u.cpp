@@ -0,0 +1,69 @@
+// Copyright (c) 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * ANB_scalar_16_32_u.cpp
+ */
+
+#include <AN/ANB_scalar.hpp>
+
+namespace coding_benchmark {
+
+    template
+    struct ANB_scalar_16_32_u<1>;
+    template
+    struct ANB_scalar_16_32_u<2>;
+    template
+    struct ANB_scalar_16_32_u<4>;
+    template
+    struct ANB_scalar_16_32_u<8>;
+    template
+    struct ANB_scalar_16_32_u<16>;
+    template
+    struct ANB_scalar_16_32_u<32>;
+    template
+    struct ANB_scalar_16_32_u<64>;
+    template
+    struct ANB_scalar_16_32_u<128>;
+    template
+    struct ANB_scalar_16_32_u<256>;
+    template
+    struct ANB_scalar_16_32_u<512>;
+    template
+    struct ANB_scalar_16_32_u<1024>;
+
+    template
+    struct ANBD_scalar_16_32_u<1>;
+    template
+    struct ANBD_scalar_16_32_u<2>;
+    template
+    struct ANBD_scalar_16_32_u<4>;
+    template
+    struct ANBD_scalar_16_32_u<8>;
+    template
+    struct ANBD_scalar_16_32_u<16>;
+    template
+    struct ANBD_scalar_16_32_u<32>;
+    template
+    struct ANBD_scalar_16_32_u<64>;
+    template
+    struct ANBD_scalar_16_32_u<128>;
+    template
+    struct ANBD_scalar_16_32_u<256>;
+    template
+    struct ANBD_scalar_16_32_u<512>;
+    template
+    struct ANBD_scalar_16_32_u<1024>;
+
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * AN_avx512_32_64_u_inv_nt.cpp
+ */
+
+#ifdef __AVX512F__
+
+#include <AN/AN_simd.hpp>
+
+namespace coding_benchmark {
+
+    template
+    struct AN_avx512_32_64_u_inv_nt<1>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<2>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<4>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<8>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<16>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<32>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<64>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<128>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<256>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<512>;
+    template
+    struct AN_avx512_32_64_u_inv_nt<1024>;
+
+}
+
+#endif
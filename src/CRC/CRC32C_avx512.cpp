@@ -0,0 +1,102 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   CRC32C_avx512.cpp
+ */
+
+#if defined(__AVX512F__) and defined(__VPCLMULQDQ__)
+
+#include <immintrin.h>
+
+#include <CRC/CRC32C.hpp>
+
+namespace coding_benchmark {
+
+    namespace {
+
+        /**
+         * Folding a 128-bit lane forward by DISTANCE bits multiplies its low and high 64 bits (carry-less) by
+         * x^(DISTANCE+31) and x^(DISTANCE-33) mod P, respectively. The result stays congruent to the data it replaces.
+         */
+        template<size_t DISTANCE>
+        struct FoldConstants {
+            static const constexpr uint64_t LO = CRC32C::xPowModP(DISTANCE + 31);
+            static const constexpr uint64_t HI = CRC32C::xPowModP(DISTANCE - 33);
+        };
+
+        inline __m512i fold(
+                __m512i mmAcc,
+                __m512i mmK,
+                __m512i mmData) {
+            return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(mmAcc, mmK, 0x00), _mm512_clmulepi64_epi128(mmAcc, mmK, 0x11), mmData, 0x96);
+        }
+
+    }
+
+    uint32_t CRC32C_avx512::compute(
+            uint32_t crc32,
+            const void * data,
+            size_t numBytes) {
+        auto in = static_cast<const uint8_t*>(data);
+        if (numBytes >= sizeof(__m512i)) {
+            const __m512i mmK1 = _mm512_set_epi64(FoldConstants<512>::HI, FoldConstants<512>::LO, FoldConstants<512>::HI, FoldConstants<512>::LO,
+                    FoldConstants<512>::HI, FoldConstants<512>::LO, FoldConstants<512>::HI, FoldConstants<512>::LO);
+            auto mmIn = reinterpret_cast<const __m512i*>(in);
+            __m512i mmAcc = _mm512_xor_si512(_mm512_loadu_si512(mmIn++), _mm512_inserti32x4(_mm512_setzero_si512(), _mm_cvtsi32_si128(crc32), 0));
+            numBytes -= sizeof(__m512i);
+            if (numBytes >= (3 * sizeof(__m512i))) {
+                // four independent accumulators hide the latency of the carry-less multiplications
+                const __m512i mmK4 = _mm512_set_epi64(FoldConstants<2048>::HI, FoldConstants<2048>::LO, FoldConstants<2048>::HI, FoldConstants<2048>::LO,
+                        FoldConstants<2048>::HI, FoldConstants<2048>::LO, FoldConstants<2048>::HI, FoldConstants<2048>::LO);
+                __m512i mmAcc1 = _mm512_loadu_si512(mmIn++);
+                __m512i mmAcc2 = _mm512_loadu_si512(mmIn++);
+                __m512i mmAcc3 = _mm512_loadu_si512(mmIn++);
+                numBytes -= 3 * sizeof(__m512i);
+                for (; numBytes >= (4 * sizeof(__m512i)); numBytes -= 4 * sizeof(__m512i), mmIn += 4) {
+                    mmAcc = fold(mmAcc, mmK4, _mm512_loadu_si512(mmIn));
+                    mmAcc1 = fold(mmAcc1, mmK4, _mm512_loadu_si512(mmIn + 1));
+                    mmAcc2 = fold(mmAcc2, mmK4, _mm512_loadu_si512(mmIn + 2));
+                    mmAcc3 = fold(mmAcc3, mmK4, _mm512_loadu_si512(mmIn + 3));
+                }
+                mmAcc = fold(mmAcc, mmK1, mmAcc1);
+                mmAcc = fold(mmAcc, mmK1, mmAcc2);
+                mmAcc = fold(mmAcc, mmK1, mmAcc3);
+            }
+            for (; numBytes >= sizeof(__m512i); numBytes -= sizeof(__m512i)) {
+                mmAcc = fold(mmAcc, mmK1, _mm512_loadu_si512(mmIn++));
+            }
+            // lanes 0, 1 and 2 are 384, 256 and 128 bits ahead of lane 3, which is kept as is
+            const __m512i mmKLanes = _mm512_set_epi64(0, 0, FoldConstants<128>::HI, FoldConstants<128>::LO, FoldConstants<256>::HI, FoldConstants<256>::LO,
+                    FoldConstants<384>::HI, FoldConstants<384>::LO);
+            mmAcc = _mm512_mask_blend_epi64(0xC0, fold(mmAcc, mmKLanes, _mm512_setzero_si512()), mmAcc);
+            auto mm256 = _mm256_xor_si256(_mm512_castsi512_si256(mmAcc), _mm512_extracti64x4_epi64(mmAcc, 1));
+            auto mm128 = _mm_xor_si128(_mm256_castsi256_si128(mm256), _mm256_extracti128_si256(mm256, 1));
+            crc32 = static_cast<uint32_t>(_mm_crc32_u64(_mm_crc32_u64(0, _mm_cvtsi128_si64(mm128)), _mm_extract_epi64(mm128, 1)));
+            in = reinterpret_cast<const uint8_t*>(mmIn);
+        }
+        uint64_t crc = crc32;
+        for (; numBytes >= sizeof(uint64_t); numBytes -= sizeof(uint64_t), in += sizeof(uint64_t)) {
+            crc = _mm_crc32_u64(crc, *reinterpret_cast<const uint64_t*>(in));
+        }
+        crc32 = static_cast<uint32_t>(crc);
+        for (; numBytes > 0; --numBytes) {
+            crc32 = _mm_crc32_u8(crc32, *in++);
+        }
+        return crc32;
+    }
+
+}
+
+#endif /* defined(__AVX512F__) and defined(__VPCLMULQDQ__) */
@@ -0,0 +1,86 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   CRC32C_sse42.cpp
+ */
+
+#if defined(__SSE4_2__) and defined(__PCLMUL__)
+
+#include <immintrin.h>
+
+#include <CRC/CRC32C.hpp>
+
+namespace coding_benchmark {
+
+    namespace {
+
+        /**
+         * One round of three crc32 chains over three adjacent streams of STREAM bytes each. The checksums of the first two
+         * streams are then advanced over the bytes that follow them by a carry-less multiplication with x^(8*bytes) mod P,
+         * whose 128-bit product the final crc32 reduces again. That reduction and the bit-reflected product account for the
+         * offset of 33 in the exponents.
+         */
+        template<size_t STREAM>
+        inline const uint8_t *
+        round3(
+                uint64_t & crc,
+                const uint8_t * data) {
+            static const constexpr uint32_t K1 = CRC32C::xPowModP(8 * STREAM - 33);
+            static const constexpr uint32_t K2 = CRC32C::xPowModP(16 * STREAM - 33);
+            auto in0 = reinterpret_cast<const uint64_t*>(data);
+            auto in1 = in0 + STREAM / sizeof(uint64_t);
+            auto in2 = in1 + STREAM / sizeof(uint64_t);
+            uint64_t crc1 = 0;
+            uint64_t crc2 = 0;
+            for (size_t k = 0; k < (STREAM / sizeof(uint64_t)); ++k) {
+                crc = _mm_crc32_u64(crc, in0[k]);
+                crc1 = _mm_crc32_u64(crc1, in1[k]);
+                crc2 = _mm_crc32_u64(crc2, in2[k]);
+            }
+            auto mm0 = _mm_clmulepi64_si128(_mm_cvtsi64_si128(crc), _mm_cvtsi32_si128(K2), 0x00);
+            auto mm1 = _mm_clmulepi64_si128(_mm_cvtsi64_si128(crc1), _mm_cvtsi32_si128(K1), 0x00);
+            crc = _mm_crc32_u64(0, _mm_cvtsi128_si64(_mm_xor_si128(mm0, mm1))) ^ crc2;
+            return data + 3 * STREAM;
+        }
+
+    }
+
+    uint32_t CRC32C_sse42::compute(
+            uint32_t crc32,
+            const void * data,
+            size_t numBytes) {
+        const constexpr size_t STREAM_LONG = 256;
+        const constexpr size_t STREAM_SHORT = 32;
+        auto in = static_cast<const uint8_t*>(data);
+        uint64_t crc = crc32;
+        for (; numBytes >= (3 * STREAM_LONG); numBytes -= 3 * STREAM_LONG) {
+            in = round3<STREAM_LONG>(crc, in);
+        }
+        for (; numBytes >= (3 * STREAM_SHORT); numBytes -= 3 * STREAM_SHORT) {
+            in = round3<STREAM_SHORT>(crc, in);
+        }
+        for (; numBytes >= sizeof(uint64_t); numBytes -= sizeof(uint64_t), in += sizeof(uint64_t)) {
+            crc = _mm_crc32_u64(crc, *reinterpret_cast<const uint64_t*>(in));
+        }
+        crc32 = static_cast<uint32_t>(crc);
+        for (; numBytes > 0; --numBytes) {
+            crc32 = _mm_crc32_u8(crc32, *in++);
+        }
+        return crc32;
+    }
+
+}
+
+#endif /* defined(__SSE4_2__) and defined(__PCLMUL__) */
@@ -39,112 +39,109 @@ namespace coding_benchmark {
 
 #ifdef __AVX512BW__
     template<>
-    __m128i hamming_t<uint16_t, __m512i >::computeHamming(
+    __m256i hamming_t<uint16_t, __m512i >::computeHamming(
             __m512i data) {
-        typedef typename mm<__m512i, uint16_t>::popcnt_t popcnt_t;
         auto pattern1 = _mm512_set1_epi16(static_cast<int16_t>(0xAD5B));
         auto pattern2 = _mm512_set1_epi16(static_cast<int16_t>(0x366D));
         auto pattern3 = _mm512_set1_epi16(static_cast<int16_t>(0xC78E));
         auto pattern4 = _mm512_set1_epi16(static_cast<int16_t>(0x07F0));
         auto pattern5 = _mm512_set1_epi16(static_cast<int16_t>(0xF800));
-        static auto pattern_and = _mm256_set1_epi8(0x01);
-        __m256i hamming = _mm256_setzero_si256();
-        __m256i tmp1 = _mm256_setzero_si256();
-        __m256i tmp2 = _mm256_setzero_si256();
-        tmp2 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern1)), pattern_and);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 1));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern2)), pattern_and);
+        auto mask = _mm256_set1_epi8(0x01);
+        __m256i tmp2 = mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern1));
+        __m256i hamming = _mm256_slli_epi16(_mm256_and_si256(tmp2, mask), 1);
+        __m256i tmp1 = mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern2));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 2));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern3)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 2));
+        tmp1 = mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern3));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 3));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern4)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 3));
+        tmp1 = mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern4));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 4));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern5)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 4));
+        tmp1 = mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern5));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 5));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount(_mm512_and_si512(data, pattern6)), pattern_and);
-        tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 6));
-        hamming = _mm256_or_si256(hamming, _mm256_and_si256(mm256_add_epi8(mm<__m512i, uint16_t>::popcount(data), tmp2), pattern_and));
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 5));
+        tmp1 = _mm256_add_epi8(mm<__m512i, uint16_t>::popcount(data), tmp2);
+        tmp1 = _mm256_and_si256(tmp1, mask);
+        hamming = _mm256_or_si256(hamming, tmp1);
         return hamming;
     }
 
     template<>
-    __m128i hamming_t<uint16_t, __m512i >::computeHamming2(
+    __m256i hamming_t<uint16_t, __m512i >::computeHamming2(
             __m512i data) {
-        typedef typename mm<__m512i, uint16_t>::popcnt_t popcnt_t;
-        auto pattern1 = _mm512_set1_epi16(static_cast<int16_t>(0xAD5B));
-        auto pattern2 = _mm512_set1_epi16(static_cast<int16_t>(0x366D));
-        auto pattern3 = _mm512_set1_epi16(static_cast<int16_t>(0xC78E));
-        auto pattern4 = _mm512_set1_epi16(static_cast<int16_t>(0x07F0));
-        auto pattern5 = _mm512_set1_epi16(static_cast<int16_t>(0xF800));
-        static auto pattern_and = _mm256_set1_epi8(0x01);
-        __m256i hamming = _mm256_setzero_si256();
-        __m256i tmp1 = _mm256_setzero_si256();
-        __m256i tmp2 = _mm256_setzero_si256();
-        tmp2 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern1)), pattern_and);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 1));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern2)), pattern_and);
-        tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 2));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern3)), pattern_and);
+        static auto pattern1 = _mm512_set1_epi16(static_cast<int16_t>(0xAD5B));
+        static auto pattern2 = _mm512_set1_epi16(static_cast<int16_t>(0x366D));
+        static auto pattern3 = _mm512_set1_epi16(static_cast<int16_t>(0xC78E));
+        static auto pattern4 = _mm512_set1_epi16(static_cast<int16_t>(0x07F0));
+        static auto pattern5 = _mm512_set1_epi16(static_cast<int16_t>(0xF800));
+        static auto mask = _mm256_set1_epi8(0x01);
+        __m256i tmp2 = mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern1));
+        __m256i hamming = _mm256_slli_epi16(_mm256_and_si256(tmp2, mask), 1);
+        __m256i tmp1 = mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern2));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 3));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern4)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 2));
+        tmp1 = mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern3));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 4));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern5)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 3));
+        tmp1 = mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern4));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 5));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern6)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 4));
+        tmp1 = mm<__m512i, uint16_t>::popcount2(_mm512_and_si512(data, pattern5));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 6));
-        hamming = _mm256_or_si256(hamming, _mm256_and_si256(mm256_add_epi8(mm<__m512i, uint16_t>::popcount2(data), tmp2), pattern_and));
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 5));
+        tmp1 = _mm256_add_epi8(mm<__m512i, uint16_t>::popcount2(data), tmp2);
+        tmp1 = _mm256_and_si256(tmp1, mask);
+        hamming = _mm256_or_si256(hamming, tmp1);
         return hamming;
     }
 
     template<>
-    __m128i hamming_t<uint16_t, __m512i >::computeHamming3(
+    __m256i hamming_t<uint16_t, __m512i >::computeHamming3(
             __m512i data) {
-        typedef typename mm<__m512i, uint16_t>::popcnt_t popcnt_t;
-        auto pattern1 = _mm512_set1_epi16(static_cast<int16_t>(0xAD5B));
-        auto pattern2 = _mm512_set1_epi16(static_cast<int16_t>(0x366D));
-        auto pattern3 = _mm512_set1_epi16(static_cast<int16_t>(0xC78E));
-        auto pattern4 = _mm512_set1_epi16(static_cast<int16_t>(0x07F0));
-        auto pattern5 = _mm512_set1_epi16(static_cast<int16_t>(0xF800));
-        static auto pattern_and = _mm256_set1_epi8(0x01);
-        __m256i hamming = _mm256_setzero_si256();
-        __m256i tmp1 = _mm256_setzero_si256();
-        __m256i tmp2 = _mm256_setzero_si256();
-        tmp2 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern1)), pattern_and);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 1));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern2)), pattern_and);
+        static auto pattern1 = _mm512_set1_epi16(static_cast<int16_t>(0xAD5B));
+        static auto pattern2 = _mm512_set1_epi16(static_cast<int16_t>(0x366D));
+        static auto pattern3 = _mm512_set1_epi16(static_cast<int16_t>(0xC78E));
+        static auto pattern4 = _mm512_set1_epi16(static_cast<int16_t>(0x07F0));
+        static auto pattern5 = _mm512_set1_epi16(static_cast<int16_t>(0xF800));
+        static auto mask = _mm256_set1_epi8(0x01);
+        __m256i tmp2 = mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern1));
+        __m256i hamming = _mm256_slli_epi16(_mm256_and_si256(tmp2, mask), 1);
+        __m256i tmp1 = mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern2));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp2, 2));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern3)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 2));
+        tmp1 = mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern3));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 3));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern4)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 3));
+        tmp1 = mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern4));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 4));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern5)), pattern_and);
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 4));
+        tmp1 = mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern5));
+        tmp1 = _mm256_and_si256(tmp1, mask);
         tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 5));
-        tmp1 = _mm256_and_si256(mm<__m512i, uint16_t>::popcount3(_mm512_and_si512(data, pattern6)), pattern_and);
-        tmp2 = _mm256_xor_si256(tmp2, tmp1);
-        hamming = _mm256_or_si256(hamming, mm256_slli_epi16(tmp2, 6));
-        hamming = _mm256_or_si256(hamming, _mm256_and_si256(mm256_add_epi8(mm<__m512i, uint16_t>::popcount3(data), tmp2), pattern_and));
+        hamming = _mm256_or_si256(hamming, _mm256_slli_epi16(tmp1, 5));
+        tmp1 = _mm256_add_epi8(mm<__m512i, uint16_t>::popcount3(data), tmp2);
+        tmp1 = _mm256_and_si256(tmp1, mask);
+        hamming = _mm256_or_si256(hamming, tmp1);
         return hamming;
     }
 
     template<>
     bool hamming_t<uint16_t, __m512i >::code_cmp_eq(
-            __m128i hamming1,
-            __m128i hamming2) {
-        return _mm_movemask_epi8(_mm_cmpeq_epi8(hamming1, hamming2)) == 0xFFFF; // all equal?
+            __m256i hamming1,
+            __m256i hamming2) {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hamming1, hamming2))) == 0xFFFFFFFFu; // all equal?
     }
 
     template<>
@@ -155,22 +152,22 @@ namespace coding_benchmark {
     template<>
     void hamming_t<uint16_t, __m512i >::store(
             __m512i data) {
-        _mm256_storeu_si256(&this->data, data);
-        _mm_storeu_si128(&this->code, computeHamming(data));
+        _mm512_storeu_si512(&this->data, data);
+        _mm256_storeu_si256(&this->code, computeHamming(data));
     }
 
     template<>
     void hamming_t<uint16_t, __m512i >::store2(
             __m512i data) {
-        _mm256_storeu_si256(&this->data, data);
-        _mm_storeu_si128(&this->code, computeHamming2(data));
+        _mm512_storeu_si512(&this->data, data);
+        _mm256_storeu_si256(&this->code, computeHamming2(data));
     }
 
     template<>
     void hamming_t<uint16_t, __m512i >::store3(
             __m512i data) {
-        _mm256_storeu_si256(&this->data, data);
-        _mm_storeu_si128(&this->code, computeHamming3(data));
+        _mm512_storeu_si512(&this->data, data);
+        _mm256_storeu_si256(&this->code, computeHamming3(data));
     }
 #endif
 
@@ -191,19 +188,19 @@ namespace coding_benchmark {
         hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 1));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount(_mm512_and_si512(data, pattern2)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 2));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 2));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount(_mm512_and_si512(data, pattern3)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 3));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 3));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount(_mm512_and_si512(data, pattern4)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 4));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 4));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount(_mm512_and_si512(data, pattern5)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 5));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 5));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount(_mm512_and_si512(data, pattern6)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 6));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 6));
         hamming = _mm_or_si128(hamming, _mm_and_si128(_mm_add_epi8(mm<__m512i, uint32_t>::popcount(data), tmp2), pattern_and));
         return hamming;
     }
@@ -225,19 +222,19 @@ namespace coding_benchmark {
         hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 1));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount2(_mm512_and_si512(data, pattern2)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 2));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 2));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount2(_mm512_and_si512(data, pattern3)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 3));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 3));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount2(_mm512_and_si512(data, pattern4)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 4));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 4));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount2(_mm512_and_si512(data, pattern5)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 5));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 5));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount2(_mm512_and_si512(data, pattern6)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 6));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 6));
         hamming = _mm_or_si128(hamming, _mm_and_si128(_mm_add_epi8(mm<__m512i, uint32_t>::popcount2(data), tmp2), pattern_and));
         return hamming;
     }
@@ -259,19 +256,19 @@ namespace coding_benchmark {
         hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 1));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount3(_mm512_and_si512(data, pattern2)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 2));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 2));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount3(_mm512_and_si512(data, pattern3)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 3));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 3));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount3(_mm512_and_si512(data, pattern4)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 4));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 4));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount3(_mm512_and_si512(data, pattern5)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 5));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 5));
         tmp1 = _mm_and_si128(mm<__m512i, uint32_t>::popcount3(_mm512_and_si512(data, pattern6)), pattern_and);
         tmp2 = _mm_xor_si128(tmp2, tmp1);
-        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp2, 6));
+        hamming = _mm_or_si128(hamming, _mm_slli_epi16(tmp1, 6));
         hamming = _mm_or_si128(hamming, _mm_and_si128(_mm_add_epi8(mm<__m512i, uint32_t>::popcount3(data), tmp2), pattern_and));
         return hamming;
     }
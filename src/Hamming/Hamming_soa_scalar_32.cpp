@@ -0,0 +1,42 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Hamming/Hamming_soa.hpp>
+
+namespace coding_benchmark {
+
+    template
+    struct Hamming_soa_scalar_32<1>;
+    template
+    struct Hamming_soa_scalar_32<2>;
+    template
+    struct Hamming_soa_scalar_32<4>;
+    template
+    struct Hamming_soa_scalar_32<8>;
+    template
+    struct Hamming_soa_scalar_32<16>;
+    template
+    struct Hamming_soa_scalar_32<32>;
+    template
+    struct Hamming_soa_scalar_32<64>;
+    template
+    struct Hamming_soa_scalar_32<128>;
+    template
+    struct Hamming_soa_scalar_32<256>;
+    template
+    struct Hamming_soa_scalar_32<512>;
+    template
+    struct Hamming_soa_scalar_32<1024>;
+
+}
@@ -12,11 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+/*
+ * File:   Main.cpp
+ *
+ * The benchmark driver: runs the tests of the TestRegistry selected on the command line (see BenchmarkOptions) for each
+ * combination of the given element and iteration counts.
+ */
+
 #include <string>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
 
 #ifdef _MSC_VER
 // disable stupid diamond-inheritance warnings (the compiler does not see that there is only a single implementation for each of the functions)
@@ -34,6 +43,10 @@
 #include <Util/ExpandTest.hpp>
 #include <Util/TestCase.hpp>
 #include <Util/Output.hpp>
+#include <Util/Export.hpp>
+#include <Util/CPU.hpp>
+#include <Util/TestRegistry.hpp>
+#include <Util/BenchmarkOptions.hpp>
 
 #include <Copy/CopyTest.hpp>
 
@@ -42,246 +55,286 @@
 
 #include <AN/AN_scalar.hpp>
 #include <AN/AN_simd.hpp>
+#include <AN/ANB_scalar.hpp>
+#include <AN/ANB_simd.hpp>
 
 #include <Hamming/Hamming_scalar.hpp>
 #include <Hamming/Hamming_simd.hpp>
+#include <Hamming/Hamming_soa.hpp>
 
-#ifdef TESTCRC
 #include <CRC/CRC_scalar.hpp>
-#endif
+#include <CRC/CRC_simd.hpp>
+
+#include <Main.hpp>
 
 using namespace coding_benchmark;
 
-#ifdef TEST32
-#include <boost/multiprecision/cpp_int.hpp>
+static void RegisterTests(
+        TestRegistry & registry) {
+    // the memcpy / memcmp baselines are the reference of all other tests of the same data width
+    registry.Add<CopyTest16, UNROLL_LO, UNROLL_HI>("CopyTest16", "Copy", "Copy", CPU::ISA::Scalar, 16);
+    registry.Add<CopyTest32, UNROLL_LO, UNROLL_HI>("CopyTest32", "Copy", "Copy", CPU::ISA::Scalar, 32);
+
+    // 16-bit data sequential tests
+    registry.Add<XOR_scalar_16_16, UNROLL_LO, UNROLL_HI>("XOR_scalar_16_16", "XOR Scalar", "XOR", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_divmod", "AN Scalar U DivMod", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_s_divmod", "AN Scalar S DivMod", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_inv", "AN Scalar U Inv", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_inv_nt", "AN Scalar U Inv NT", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_inv_deferred", "AN Scalar U Inv Deferred", CPU::ISA::Scalar, 16);
+    registry.AddAN<AN_scalar_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_s_inv", "AN Scalar S Inv", CPU::ISA::Scalar, 16);
+    registry.AddAN<ANB_scalar_16_32_u, UNROLL_LO, UNROLL_HI>("ANB_scalar_16_32_u", "ANB Scalar U", CPU::ISA::Scalar, 16);
+    registry.AddAN<ANBD_scalar_16_32_u, UNROLL_LO, UNROLL_HI>("ANBD_scalar_16_32_u", "ANBD Scalar U", CPU::ISA::Scalar, 16);
+    registry.Add<Hamming_scalar_16, UNROLL_LO, UNROLL_HI>("Hamming_scalar_16", "Hamming Scalar", "Hamming", CPU::ISA::Scalar, 16);
+    registry.Add<Hamming_soa_scalar_16, UNROLL_LO, UNROLL_HI>("Hamming_soa_scalar_16", "Hamming SoA Scalar", "Hamming", CPU::ISA::Scalar, 16);
+    registry.Add<CRC32_scalar_16, UNROLL_LO, UNROLL_HI>("CRC32_scalar_16", "CRC32 Scalar", "CRC", CPU::ISA::Scalar, 16);
+
+    // 32-bit data sequential tests
+    registry.Add<XOR_scalar_32_32, UNROLL_LO, UNROLL_HI>("XOR_scalar_32_32", "XOR Scalar", "XOR", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_divmod", "AN Scalar U DivMod", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_s_divmod", "AN Scalar S DivMod", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_inv", "AN Scalar U Inv", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_inv_nt", "AN Scalar U Inv NT", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_inv_deferred", "AN Scalar U Inv Deferred", CPU::ISA::Scalar, 32);
+    registry.AddAN<AN_scalar_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_s_inv", "AN Scalar S Inv", CPU::ISA::Scalar, 32);
+    registry.AddAN<ANB_scalar_32_64_u, UNROLL_LO, UNROLL_HI>("ANB_scalar_32_64_u", "ANB Scalar U", CPU::ISA::Scalar, 32);
+    registry.AddAN<ANBD_scalar_32_64_u, UNROLL_LO, UNROLL_HI>("ANBD_scalar_32_64_u", "ANBD Scalar U", CPU::ISA::Scalar, 32);
+    registry.Add<Hamming_scalar_32, UNROLL_LO, UNROLL_HI>("Hamming_scalar_32", "Hamming Scalar", "Hamming", CPU::ISA::Scalar, 32);
+    registry.Add<Hamming_soa_scalar_32, UNROLL_LO, UNROLL_HI>("Hamming_soa_scalar_32", "Hamming SoA Scalar", "Hamming", CPU::ISA::Scalar, 32);
+    registry.Add<CRC32_scalar_32, UNROLL_LO, UNROLL_HI>("CRC32_scalar_32", "CRC32 Scalar", "CRC", CPU::ISA::Scalar, 32);
 
-using uint128_t = boost::multiprecision::uint128_t;
+#ifdef __SSE4_2__
+    // 16-bit data vectorized tests
+    registry.Add<XOR_sse42_8x16_8x16, UNROLL_LO, UNROLL_HI>("XOR_sse42_8x16_8x16", "XOR SSE4.2", "XOR", CPU::ISA::SSE42, 16);
+    registry.Add<XOR_sse42_8x16_8x16_nt, UNROLL_LO, UNROLL_HI>("XOR_sse42_8x16_8x16_nt", "XOR SSE4.2 NT", "XOR", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_divmod", "AN SSE4.2 U DivMod", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_s_divmod", "AN SSE4.2 S DivMod", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_inv", "AN SSE4.2 U Inv", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_inv_nt", "AN SSE4.2 U Inv NT", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_inv_deferred", "AN SSE4.2 U Inv Deferred", CPU::ISA::SSE42, 16);
+    registry.AddAN<AN_sse42_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_s_inv", "AN SSE4.2 S Inv", CPU::ISA::SSE42, 16);
+    registry.AddAN<ANB_sse42_16_32_u, UNROLL_LO, UNROLL_HI>("ANB_sse42_16_32_u", "ANB SSE4.2 U", CPU::ISA::SSE42, 16);
+    registry.AddAN<ANBD_sse42_16_32_u, UNROLL_LO, UNROLL_HI>("ANBD_sse42_16_32_u", "ANBD SSE4.2 U", CPU::ISA::SSE42, 16);
+    registry.Add<Hamming_sse42_16, UNROLL_LO, UNROLL_HI>("Hamming_sse42_16", "Hamming SSE4.2", "Hamming", CPU::ISA::SSE42, 16);
+    registry.Add<Hamming_soa_sse42_16, UNROLL_LO, UNROLL_HI>("Hamming_soa_sse42_16", "Hamming SoA SSE4.2", "Hamming", CPU::ISA::SSE42, 16);
+#if defined(__PCLMUL__) or defined(RUNTIME_DISPATCH)
+    registry.Add<CRC32_sse42_16, UNROLL_LO, UNROLL_HI>("CRC32_sse42_16", "CRC32 SSE4.2", "CRC", CPU::ISA::SSE42, 16);
 #endif
 
-int checkArgs(
-        int argc,
-        char* argv[],
-        size_t & AUser1) {
-    if (argc == 1) {
-        return 0;
+    // 32-bit data vectorized tests
+    registry.Add<XOR_sse42_4x32_4x32, UNROLL_LO, UNROLL_HI>("XOR_sse42_4x32_4x32", "XOR SSE4.2", "XOR", CPU::ISA::SSE42, 32);
+    registry.Add<XOR_sse42_4x32_4x32_nt, UNROLL_LO, UNROLL_HI>("XOR_sse42_4x32_4x32_nt", "XOR SSE4.2 NT", "XOR", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_divmod", "AN SSE4.2 U DivMod", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_s_divmod", "AN SSE4.2 S DivMod", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_inv", "AN SSE4.2 U Inv", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_inv_nt", "AN SSE4.2 U Inv NT", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_inv_deferred", "AN SSE4.2 U Inv Deferred", CPU::ISA::SSE42, 32);
+    registry.AddAN<AN_sse42_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_s_inv", "AN SSE4.2 S Inv", CPU::ISA::SSE42, 32);
+    registry.AddAN<ANB_sse42_32_64_u, UNROLL_LO, UNROLL_HI>("ANB_sse42_32_64_u", "ANB SSE4.2 U", CPU::ISA::SSE42, 32);
+    registry.AddAN<ANBD_sse42_32_64_u, UNROLL_LO, UNROLL_HI>("ANBD_sse42_32_64_u", "ANBD SSE4.2 U", CPU::ISA::SSE42, 32);
+    registry.Add<Hamming_sse42_32, UNROLL_LO, UNROLL_HI>("Hamming_sse42_32", "Hamming SSE4.2", "Hamming", CPU::ISA::SSE42, 32);
+    registry.Add<Hamming_soa_sse42_32, UNROLL_LO, UNROLL_HI>("Hamming_soa_sse42_32", "Hamming SoA SSE4.2", "Hamming", CPU::ISA::SSE42, 32);
+#if defined(__PCLMUL__) or defined(RUNTIME_DISPATCH)
+    registry.Add<CRC32_sse42_32, UNROLL_LO, UNROLL_HI>("CRC32_sse42_32", "CRC32 SSE4.2", "CRC", CPU::ISA::SSE42, 32);
+#endif
+#endif
+
+    // with RUNTIME_DISPATCH, these are compiled for their instruction set and must not even be called without it
+    if (CPU::Instance().Supports(CPU::ISA::AVX2)) {
+        RegisterAVX2Tests(registry);
     }
-    if (argc != 2) {
-        printUsage(argv);
-        return 1;
+    if (CPU::Instance().Supports(CPU::ISA::AVX512)) {
+        RegisterAVX512Tests(registry);
     }
-    char* endPtr = nullptr;
-    AUser1 = strtoull(argv[1], &endPtr, 0);
-    if (endPtr == argv[1] || AUser1 == 0 || (AUser1 & 1) == 0) {
-        std::cerr << "Error: A is not a valid positive, non-zero, odd integer!\n";
-        printUsage(argv);
-        return 2;
+}
+
+/**
+ * The inverse of A in the ring modulo 2^(2 * datawidth), i.e. for the code width.
+ */
+static size_t computeAInv(
+        size_t A,
+        size_t datawidth) {
+    if (datawidth == 16) {
+        return static_cast<uint32_t>(ext_euclidean<uint64_t>(A, 32));
     }
-#if defined(TEST8)
-    if (AUser1 >= (1ull << 8)) {
-        std::cerr << "Error: Given A is too large! Must be at most 2^8-1\n";
-        printUsage(argv);
-        return 3;
+    return static_cast<uint64_t>(ext_euclidean<uint128_t>(static_cast<uint128_t>(A), 64));
+}
+
+/**
+ * With several combinations of element and iteration counts, each gets its own export file, e.g. results_1000x10.json.
+ */
+static std::string getExportFileName(
+        const std::string & fileName,
+        const BenchmarkOptions & options,
+        size_t numElements,
+        size_t numIterations) {
+    if (fileName.empty() || (options.numElements.size() == 1 && options.numIterations.size() == 1)) {
+        return fileName;
     }
-#elif defined(TEST16)
-    if (AUser1 >= (1ull << 16)) {
-        std::cerr << "Error: Given A is too large! Must be at most 2^16-1\n";
-        printUsage(argv);
-        return 3;
+    const std::string suffix = "_" + std::to_string(numElements) + "x" + std::to_string(numIterations);
+    auto posDot = fileName.rfind('.');
+    auto posSlash = fileName.rfind('/');
+    if (posDot == std::string::npos || (posSlash != std::string::npos && posDot < posSlash)) {
+        return fileName + suffix;
     }
-#elif defined(TEST32)
-    if (AUser1 >= (1ull << 32)) {
-        std::cerr << "Error: Given A is too large! Must be at most 2^32-1\n";
-        printUsage(argv);
-        return 3;
+    return fileName.substr(0, posDot) + suffix + fileName.substr(posDot);
+}
+
+/**
+ * Runs the given tests of a single data width, preceded by the Copy test of that width as their reference.
+ */
+static void RunTests(
+        size_t datawidth,
+        const std::vector<const RegisteredTest*> & tests,
+        const BenchmarkOptions & options,
+        TestConfiguration & testConfig,
+        std::vector<std::vector<TestInfos>> & vecTestInfos,
+        bool & isWarmedUp) {
+    auto & registered = TestRegistry::Instance().Tests();
+    auto & reference = *std::find_if(registered.begin(), registered.end(), [datawidth] (const RegisteredTest & test) {
+        return test.family == "Copy" && test.datawidth == datawidth;
+    });
+    const size_t numBytes = datawidth / 8;
+    /* TODO we do not check for overflows or underflows ANYWHERE, yet :-(*/
+    DataGenerationConfiguration dataGenConfig = (datawidth == 16) ? DataGenerationConfiguration(11, 5, 4, 0) : DataGenerationConfiguration(26, 6, 5, 0);
+    AlignedBlock bufRawdata(testConfig.numValues * numBytes, 64, testConfig.allocation);
+    AlignedBlock bufEncoded(3 * testConfig.numValues * numBytes, 64, testConfig.allocation); // Coding may generate thrice (since CRC) as much encoded output data as raw input data
+    AlignedBlock bufResult(3 * testConfig.numValues * numBytes, 64, testConfig.allocation); // Coding may generate thrice (since CRC) as much encoded result data as raw input data (or the same amount as encoded data)
+
+    if (!isWarmedUp) {
+        std::clog << "# WarmUp " << reference.name << std::endl;
+        std::vector<std::vector<TestInfos>> vecWarmUp;
+        TestContext context {bufRawdata, bufEncoded, bufResult, 0, 0, testConfig, dataGenConfig, vecWarmUp};
+        reference.run(context);
+        isWarmedUp = true;
+    }
+
+    std::clog << "# " << datawidth << "-bit tests:" << std::endl;
+    {
+        TestContext context {bufRawdata, bufEncoded, bufResult, 0, 0, testConfig, dataGenConfig, vecTestInfos};
+        reference.run(context);
+    }
+    const size_t refIdx = vecTestInfos.size() - 1;
+
+    const bool usesA = std::any_of(tests.begin(), tests.end(), [] (const RegisteredTest * test) {
+        return test->usesA;
+    });
+    for (size_t i = 0; usesA && i < options.As.size(); ++i) {
+        const size_t A = options.As[i];
+        if (A >= (1ull << datawidth)) {
+            std::cout << "# A=" << A << " is too large for " << datawidth << "-bit data, skipping its AN tests\n";
+        } else {
+            std::cout << "# A=" << A << " A^-1=" << computeAInv(A, datawidth) << " (" << datawidth << "-bit)" << std::endl;
+        }
+    }
+    for (auto test : tests) {
+        if (test->family == "Copy") {
+            continue;
+        } else if (!test->usesA) {
+            TestContext context {bufRawdata, bufEncoded, bufResult, 0, 0, testConfig, dataGenConfig, vecTestInfos};
+            test->run(context);
+            setTestInfosReference(*vecTestInfos.rbegin(), vecTestInfos.at(refIdx));
+            continue;
+        }
+        for (auto A : options.As) {
+            if (A < (1ull << datawidth)) {
+                TestContext context {bufRawdata, bufEncoded, bufResult, A, computeAInv(A, datawidth), testConfig, dataGenConfig, vecTestInfos};
+                test->run(context);
+                setTestInfosReference(*vecTestInfos.rbegin(), vecTestInfos.at(refIdx));
+            }
+        }
     }
-#else
-#error "You must define (-D) exactly one of TEST8, TEST16, or TEST32"
-#endif
-    return 0;
 }
 
 int main(
         int argc,
         char* argv[]) {
-    const constexpr size_t numElements = 1000001ull;
-    const constexpr size_t iterations = 10000ull;
-    const constexpr size_t UNROLL_LO = 1ull;
-    const constexpr size_t UNROLL_HI = 1024ull;
-
-    std::cout << "# numElements = " << numElements << '\n';
-    std::cout << "# iterations = " << iterations << '\n';
-    std::cout << "# UNROLL_LO = " << UNROLL_LO << '\n';
-    std::cout << "# UNROLL_HI = " << UNROLL_HI << '\n';
-
-    size_t AUser = 64311ull;
-    int result = checkArgs(argc, argv, AUser);
-    if (result != 0) {
-        return result;
+    BenchmarkOptions options;
+    try {
+        options = BenchmarkOptions::Parse(argc, argv);
+        for (auto unroll : options.unrollSizes) {
+            if (unroll < UNROLL_LO || unroll > UNROLL_HI) {
+                throw std::invalid_argument("--unroll: " + std::to_string(unroll) + " is not within the compiled-in range [" + std::to_string(UNROLL_LO) + ", " + std::to_string(UNROLL_HI) + "]");
+            }
+        }
+    } catch (std::invalid_argument & ex) {
+        std::cerr << "Error: " << ex.what() << '\n';
+        BenchmarkOptions::PrintUsage(std::cerr, argv[0]);
+        return 1;
     }
-    _ReadWriteBarrier();
-
-    std::vector<std::vector<TestInfos>> vecTestInfos;
-
-    TestConfiguration testConfig(iterations, numElements);
-    // The following is for the reproducibility of the SIGMOD 2018 "AHEAD" paper, to reduce the amount of tests
-    testConfig.disableAll();
-    testConfig.enableCheck = true;
-    testConfig.enableDecode = true;
-
-#ifdef TEST8
-    {
-        uint16_t AUserInv = static_cast<uint16_t>(ext_euclidean<uint32_t>(static_cast<uint32_t>(AUser), 16));
-        std::cout << "# A=" << AUser << " A^-1=" << AUserInv << std::endl;
-
-        DataGenerationConfiguration dataGenConfig8(5, 3, 2, 0); /* TODO we do not check for overflows or underflows ANYWHERE, yet :-(*/
-        AlignedBlock bufRawdata8(numElements * sizeof(uint8_t), 64);
-        AlignedBlock bufEncoded8(3 * numElements * sizeof(uint8_t), 64); // Coding may generate thrice (since CRC) as much encoded output data as raw input data
-        AlignedBlock bufResult8(3 * numElements * sizeof(uint8_t), 64);// Coding may generate thrice (since CRC) as much encoded result data as raw input data (or the same amount as encoded data)
-
-        WarmUp<CopyTest8, UNROLL_LO, UNROLL_HI>("CopyTest8", "Copy", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8);
-
-        std::clog << "# 8-bit Baseline (memcpy / memcmp) test:" << std::endl;
-        TestCase<CopyTest8, UNROLL_LO, UNROLL_HI>("CopyTest8", "Copy", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos);
-        size_t refIdx = vecTestInfos.size() - 1;
-
-        // 8-bit data sequential tests
-        std::clog << "# 8-bit scalar tests:" << std::endl;
-        TestCase<XOR_scalar_8_8, UNROLL_LO, UNROLL_HI>("XOR_scalar_8_8", "XOR Scalar", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_scalar_8_16_u_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_8_16_u_divmod", "AN Scalar U DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_scalar_8_16_s_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_8_16_s_divmod", "AN Scalar S DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_scalar_8_16_u_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_8_16_u_inv", "AN Scalar U Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_scalar_8_16_s_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_8_16_s_inv", "AN Scalar S Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<Hamming_scalar_8, UNROLL_LO, UNROLL_HI>("Hamming_scalar_8", "Hamming Scalar", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-#ifdef TESTCRC
-        TestCase<CRC16_scalar_8, UNROLL_LO, UNROLL_HI>("CRC16_scalar_8", "CRC16 Scalar", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-#endif
-
-#ifdef __SSE4_2__
-        // 8-bit data vectorized tests
-        std::clog << "# 8-bit SSE4.2 tests:" << std::endl;
-        TestCase<XOR_sse42_8x8_8x8, UNROLL_LO, UNROLL_HI>("XOR_sse42_16x8_16x8", "XOR SSE4.2", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_sse42_8_16_u_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_8_16_u_divmod", "AN SSE4.2 U DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_sse42_8_16_s_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_8_16_s_divmod", "AN SSE4.2 S DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_sse42_8_16_u_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_8_16_u_inv", "AN SSE4.2 U Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_sse42_8_16_s_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_8_16_s_inv", "AN SSE4.2 S Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<Hamming_sse42_8, UNROLL_LO, UNROLL_HI>("Hamming_sse42_8", "Hamming SSE4.2", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-#endif
-
-#ifdef __AVX2__
-        std::clog << "# 8-bit AVX2 tests:" << std::endl;
-        TestCase<XOR_avx2_8x8_8x8, UNROLL_LO, UNROLL_HI>("XOR_avx2_32x8_32x8", "XOR AVX2", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_avx2_8_16_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_8_16_u_divmod", "AN AVX2 U DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_avx2_8_16_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_8_16_s_divmod", "AN AVX2 S DivMod", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_avx2_8_16_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_8_16_u_inv", "AN AVX2 U Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<AN_avx2_8_16_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_8_16_s_inv", "AN AVX2 S Inv", bufRawdata8, bufEncoded8, bufResult8, AUser, AUserInv, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-        TestCase<Hamming_avx2_8, UNROLL_LO, UNROLL_HI>("Hamming_avx2_8", "Hamming AVX2", bufRawdata8, bufEncoded8, bufResult8, testConfig, dataGenConfig8, vecTestInfos, refIdx);
-#endif
+    if (options.doHelp) {
+        BenchmarkOptions::PrintUsage(std::cout, argv[0]);
+        return 0;
     }
-#endif /* TEST8 */
-
-#ifdef TEST16
-    {
-        uint32_t AUserInv = static_cast<uint32_t>(ext_euclidean<uint64_t>(AUser, 32));
-        std::cout << "# A=" << AUser << " A^-1=" << AUserInv << std::endl;
-
-        DataGenerationConfiguration dataGenConfig16(11, 5, 4, 0); /* TODO we do not check for overflows or underflows ANYWHERE, yet :-(*/
-        AlignedBlock bufRawdata16(numElements * sizeof(uint16_t), 64);
-        AlignedBlock bufEncoded16(3 * numElements * sizeof(uint16_t), 64); // Coding may generate thrice (since CRC) as much encoded output data as raw input data
-        AlignedBlock bufResult16(3 * numElements * sizeof(uint16_t), 64);// Coding may generate thrice (since CRC) as much encoded result data as raw input data (or the same amount as encoded data)
 
-        WarmUp<CopyTest16, UNROLL_LO, UNROLL_HI>("CopyTest16", "Copy", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16);
-
-        std::clog << "# 16-bit Baseline (memcpy / memcmp) test:" << std::endl;
-        TestCase<CopyTest16, UNROLL_LO, UNROLL_HI>("CopyTest16", "Copy", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos);
-        size_t refIdx = vecTestInfos.size() - 1;
-
-        // 16-bit data sequential tests
-        std::clog << "# 16-bit scalar tests:" << std::endl;
-        TestCase<XOR_scalar_16_16, UNROLL_LO, UNROLL_HI>("XOR_scalar_16_16", "XOR Scalar", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_scalar_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_divmod", "AN Scalar U DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_scalar_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_s_divmod", "AN Scalar S DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_scalar_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_u_inv", "AN Scalar U Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_scalar_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_16_32_s_inv", "AN Scalar S Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<Hamming_scalar_16, UNROLL_LO, UNROLL_HI>("Hamming_scalar_16", "Hamming Scalar", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-#ifdef TESTCRC
-        TestCase<CRC32_scalar_16, UNROLL_LO, UNROLL_HI>("CRC32_scalar_16", "CRC32 Scalar", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-#endif
-
-#ifdef __SSE4_2__
-        // 16-bit data vectorized tests
-        std::clog << "# 16-bit SSE4.2 tests:" << std::endl;
-        TestCase<XOR_sse42_8x16_8x16, UNROLL_LO, UNROLL_HI>("XOR_sse42_8x16_8x16", "XOR SSE4.2", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_sse42_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_divmod", "AN SSE4.2 U DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_sse42_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_s_divmod", "AN SSE4.2 S DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_sse42_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_u_inv", "AN SSE4.2 U Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_sse42_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_16_32_s_inv", "AN SSE4.2 S Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<Hamming_sse42_16, UNROLL_LO, UNROLL_HI>("Hamming_sse42_16", "Hamming SSE4.2", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-#endif
-
-#ifdef __AVX2__
-        std::clog << "# 16-bit AVX2 tests:" << std::endl;
-        TestCase<XOR_avx2_16x16_16x16, UNROLL_LO, UNROLL_HI>("XOR_avx2_16x16_16x16", "XOR AVX2", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_avx2_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_divmod", "AN AVX2 U DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_avx2_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_s_divmod", "AN AVX2 S DivMod", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_avx2_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_inv", "AN AVX2 U Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<AN_avx2_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_s_inv", "AN AVX2 S Inv", bufRawdata16, bufEncoded16, bufResult16, AUser, AUserInv, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-        TestCase<Hamming_avx2_16, UNROLL_LO, UNROLL_HI>("Hamming_avx2_16", "Hamming AVX2", bufRawdata16, bufEncoded16, bufResult16, testConfig, dataGenConfig16, vecTestInfos, refIdx);
-#endif
+    auto & registry = TestRegistry::Instance();
+    RegisterTests(registry);
+    const auto isa = CPU::Instance().WidestISA();
+    const size_t datawidths[] = {16, 32};
+    std::vector<const RegisteredTest*> selectedTests;
+    for (auto & test : registry.Tests()) {
+        if (test.isa <= isa && options.isSelected(test)) {
+            selectedTests.push_back(&test);
+        }
     }
-#endif /* TEST16 */
 
-#ifdef TEST32
-    {
-        uint64_t AUserInv = static_cast<uint64_t>(ext_euclidean<uint128_t>(static_cast<uint128_t>(AUser), 64));
-        std::cout << "# A=" << AUser << " A^-1=" << AUserInv << std::endl;
-
-        DataGenerationConfiguration dataGenConfig32(26, 6, 5, 0); /* TODO we do not check for overflows or underflows ANYWHERE, yet :-(*/
-        AlignedBlock bufRawdata32(numElements * sizeof(uint32_t), 64);
-        AlignedBlock bufEncoded32(3 * numElements * sizeof(uint32_t), 64); // Coding may generate twice as much encoded output data as raw input data
-        AlignedBlock bufResult32(3 * numElements * sizeof(uint32_t), 64);// Coding may generate twice as much encoded result data as raw input data (or the same amount as encoded data)
-
-        WarmUp<CopyTest32, UNROLL_LO, UNROLL_HI>("CopyTest32", "Copy", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32);
-
-        std::clog << "# 32-bit Baseline (memcpy / memcmp) test:" << std::endl;
-        TestCase<CopyTest32, UNROLL_LO, UNROLL_HI>("CopyTest32", "Copy", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos);
-        size_t refIdx = vecTestInfos.size() - 1;
-
-        std::clog << "# 32-bit Scalar tests:" << std::endl;
-        // 32-bit data sequential tests
-        TestCase<XOR_scalar_32_32, UNROLL_LO, UNROLL_HI>("XOR_scalar_32_32", "XOR Scalar", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_scalar_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_divmod", "AN Scalar U DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_scalar_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_s_divmod", "AN Scalar S DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_scalar_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_u_inv", "AN Scalar U Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_scalar_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_scalar_32_64_s_inv", "AN Scalar S Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<Hamming_scalar_32, UNROLL_LO, UNROLL_HI>("Hamming_scalar_32", "Hamming Scalar", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-#ifdef TESTCRC
-        TestCase<CRC32_scalar_32, UNROLL_LO, UNROLL_HI>("CRC32_scalar_32", "CRC32 Scalar", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-#endif
-
-#ifdef __SSE4_2__
-        std::clog << "# 32-bit SSE4.2 tests:" << std::endl;
-        // 32-bit data vectorized tests
-        TestCase<XOR_sse42_4x32_4x32, UNROLL_LO, UNROLL_HI>("XOR_sse42_4x32_4x32", "XOR SSE4.2", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_sse42_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_divmod", "AN SSE4.2 U DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_sse42_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_s_divmod", "AN SSE4.2 S DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_sse42_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_u_inv", "AN SSE4.2 U Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_sse42_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_sse42_32_64_s_inv", "AN SSE4.2 S Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<Hamming_sse42_32, UNROLL_LO, UNROLL_HI>("Hamming_sse42_32", "Hamming SSE4.2", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-#endif
-
-#ifdef __AVX2__
-        std::clog << "# 32-bit AVX2 tests:" << std::endl;
-        TestCase<XOR_avx2_8x32_8x32, UNROLL_LO, UNROLL_HI>("XOR_avx2_8x32_8x32", "XOR AVX2", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_avx2_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_divmod", "AN AVX2 U DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_avx2_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_s_divmod", "AN AVX2 S DivMod", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_avx2_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_inv", "AN AVX2 U Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<AN_avx2_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_s_inv", "AN AVX2 S Inv", bufRawdata32, bufEncoded32, bufResult32, AUser, AUserInv, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-        TestCase<Hamming_avx2_32, UNROLL_LO, UNROLL_HI>("Hamming_avx2_32", "Hamming AVX2", bufRawdata32, bufEncoded32, bufResult32, testConfig, dataGenConfig32, vecTestInfos, refIdx);
-#endif
+    if (options.doList) {
+        for (auto test : selectedTests) {
+            std::cout << std::left << std::setw(28) << test->name << std::setw(8) << test->family << std::setw(7) << getISAName(test->isa) << test->datawidth << '\n';
+        }
+        return 0;
+    }
+    if (selectedTests.empty()) {
+        std::cerr << "Error: no test matches the given options (see --list)" << std::endl;
+        return 1;
     }
-#endif /* TEST32 */
 
-    printResults<false>(testConfig, vecTestInfos);
-    std::cout << "\n\n";
-    printResults<true>(testConfig, vecTestInfos);
+    bool isWarmedUp = false;
+    std::vector<std::pair<TestConfiguration, std::vector<std::vector<TestInfos>>>> sweepRuns;
+    for (auto numElements : options.numElements) {
+        for (auto numIterations : options.numIterations) {
+            const size_t iterations = options.getIterations(numElements, numIterations);
+            std::cout << "# numElements = " << numElements << '\n';
+            std::cout << "# iterations = " << iterations << '\n';
+            std::cout << "# repetitions = " << options.numRepetitions << '\n';
+            std::cout << "# UNROLL_LO = " << UNROLL_LO << '\n';
+            std::cout << "# UNROLL_HI = " << UNROLL_HI << '\n';
+            std::cout << "# widest ISA = " << getISAName(isa) << '\n';
+
+            std::vector<std::vector<TestInfos>> vecTestInfos;
+
+            TestConfiguration testConfig(iterations, numElements);
+            options.configure(testConfig);
+
+            for (auto datawidth : datawidths) {
+                std::vector<const RegisteredTest*> tests;
+                std::copy_if(selectedTests.begin(), selectedTests.end(), std::back_inserter(tests), [datawidth] (const RegisteredTest * test) {
+                    return test->datawidth == datawidth;
+                });
+                if (!tests.empty()) {
+                    RunTests(datawidth, tests, options, testConfig, vecTestInfos, isWarmedUp);
+                }
+            }
+
+            printResults<false>(testConfig, vecTestInfos);
+            std::cout << "\n\n";
+            printResults<true>(testConfig, vecTestInfos);
+            printStatistics(testConfig, vecTestInfos);
+            printCounters(testConfig, vecTestInfos);
+            printPipeline(testConfig, vecTestInfos);
+            printScrub(testConfig, vecTestInfos);
+            printDecodeView(testConfig, vecTestInfos);
+            printBitwise(testConfig, vecTestInfos);
+            printCorrection(testConfig, vecTestInfos);
+            printFaults(testConfig, vecTestInfos);
+            exportResults(getExportFileName(options.exportFileJSON, options, numElements, iterations), getExportFileName(options.exportFileCSV, options, numElements, iterations), testConfig, vecTestInfos);
+            std::cout << "\n\n";
+            if (options.isSweep()) {
+                sweepRuns.emplace_back(testConfig, std::move(vecTestInfos));
+            }
+        }
+    }
+    if (options.isSweep()) {
+        printThroughput(sweepRuns);
+    }
 }
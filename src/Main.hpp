@@ -0,0 +1,39 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Main.hpp
+ *
+ * Shared between Main.cpp and the per-instruction-set test type lists (Main_avx2.cpp, Main_avx512.cpp).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <Util/TestRegistry.hpp>
+
+const constexpr size_t UNROLL_LO = 1ull;
+const constexpr size_t UNROLL_HI = 1024ull;
+
+/**
+ * Register the AVX2 / AVX-512 test types. They are no-ops if the translation unit was not compiled for the instruction
+ * set. With RUNTIME_DISPATCH, they live in the shared libraries benchavx2 / benchavx512 and the driver only calls them if
+ * the CPU supports the instruction set.
+ */
+void RegisterAVX2Tests(
+        TestRegistry & registry);
+
+void RegisterAVX512Tests(
+        TestRegistry & registry);
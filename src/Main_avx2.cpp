@@ -0,0 +1,64 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Main_avx2.cpp
+ *
+ * The AVX2 test types of the benchmark driver. They live in their own translation unit, so that with RUNTIME_DISPATCH
+ * only this file is compiled for AVX2 while Main.cpp sticks to the baseline instruction set. It then goes to the shared
+ * library benchavx2 together with the AVX2 kernels, which keeps their inline functions away from the baseline code.
+ */
+
+#include <Main.hpp>
+
+#include <XOR/XOR_simd.hpp>
+#include <AN/AN_simd.hpp>
+#include <AN/ANB_simd.hpp>
+#include <Hamming/Hamming_simd.hpp>
+#include <Hamming/Hamming_soa.hpp>
+
+using namespace coding_benchmark;
+
+void RegisterAVX2Tests(
+        TestRegistry & registry) {
+#ifdef __AVX2__
+    registry.Add<XOR_avx2_16x16_16x16, UNROLL_LO, UNROLL_HI>("XOR_avx2_16x16_16x16", "XOR AVX2", "XOR", CPU::ISA::AVX2, 16);
+    registry.Add<XOR_avx2_16x16_16x16_nt, UNROLL_LO, UNROLL_HI>("XOR_avx2_16x16_16x16_nt", "XOR AVX2 NT", "XOR", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_divmod", "AN AVX2 U DivMod", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_s_divmod", "AN AVX2 S DivMod", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_inv", "AN AVX2 U Inv", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_inv_nt", "AN AVX2 U Inv NT", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_u_inv_deferred", "AN AVX2 U Inv Deferred", CPU::ISA::AVX2, 16);
+    registry.AddAN<AN_avx2_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_16_32_s_inv", "AN AVX2 S Inv", CPU::ISA::AVX2, 16);
+    registry.AddAN<ANB_avx2_16_32_u, UNROLL_LO, UNROLL_HI>("ANB_avx2_16_32_u", "ANB AVX2 U", CPU::ISA::AVX2, 16);
+    registry.AddAN<ANBD_avx2_16_32_u, UNROLL_LO, UNROLL_HI>("ANBD_avx2_16_32_u", "ANBD AVX2 U", CPU::ISA::AVX2, 16);
+    registry.Add<Hamming_avx2_16, UNROLL_LO, UNROLL_HI>("Hamming_avx2_16", "Hamming AVX2", "Hamming", CPU::ISA::AVX2, 16);
+    registry.Add<Hamming_soa_avx2_16, UNROLL_LO, UNROLL_HI>("Hamming_soa_avx2_16", "Hamming SoA AVX2", "Hamming", CPU::ISA::AVX2, 16);
+
+    registry.Add<XOR_avx2_8x32_8x32, UNROLL_LO, UNROLL_HI>("XOR_avx2_8x32_8x32", "XOR AVX2", "XOR", CPU::ISA::AVX2, 32);
+    registry.Add<XOR_avx2_8x32_8x32_nt, UNROLL_LO, UNROLL_HI>("XOR_avx2_8x32_8x32_nt", "XOR AVX2 NT", "XOR", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_divmod", "AN AVX2 U DivMod", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_s_divmod", "AN AVX2 S DivMod", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_inv", "AN AVX2 U Inv", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_inv_nt", "AN AVX2 U Inv NT", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_u_inv_deferred", "AN AVX2 U Inv Deferred", CPU::ISA::AVX2, 32);
+    registry.AddAN<AN_avx2_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx2_32_64_s_inv", "AN AVX2 S Inv", CPU::ISA::AVX2, 32);
+    registry.AddAN<ANB_avx2_32_64_u, UNROLL_LO, UNROLL_HI>("ANB_avx2_32_64_u", "ANB AVX2 U", CPU::ISA::AVX2, 32);
+    registry.AddAN<ANBD_avx2_32_64_u, UNROLL_LO, UNROLL_HI>("ANBD_avx2_32_64_u", "ANBD AVX2 U", CPU::ISA::AVX2, 32);
+    registry.Add<Hamming_avx2_32, UNROLL_LO, UNROLL_HI>("Hamming_avx2_32", "Hamming AVX2", "Hamming", CPU::ISA::AVX2, 32);
+    registry.Add<Hamming_soa_avx2_32, UNROLL_LO, UNROLL_HI>("Hamming_soa_avx2_32", "Hamming SoA AVX2", "Hamming", CPU::ISA::AVX2, 32);
+#else
+    (void) registry;
+#endif /* __AVX2__ */
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2018 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   Main_avx512.cpp
+ *
+ * The AVX-512 test types of the benchmark driver. They live in their own translation unit, so that with RUNTIME_DISPATCH
+ * only this file is compiled for AVX-512 while Main.cpp sticks to the baseline instruction set. It then goes to the shared
+ * library benchavx512 together with the AVX-512 kernels, which keeps their inline functions away from the baseline code.
+ */
+
+#include <Main.hpp>
+
+#include <AN/AN_simd.hpp>
+#include <AN/ANB_simd.hpp>
+#include <Hamming/Hamming_simd.hpp>
+#include <Hamming/Hamming_soa.hpp>
+#include <CRC/CRC_simd.hpp>
+
+using namespace coding_benchmark;
+
+void RegisterAVX512Tests(
+        TestRegistry & registry) {
+#ifdef __AVX512F__
+    registry.AddAN<AN_avx512_16_32_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_u_divmod", "AN AVX512 U DivMod", CPU::ISA::AVX512, 16);
+    registry.AddAN<AN_avx512_16_32_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_s_divmod", "AN AVX512 S DivMod", CPU::ISA::AVX512, 16);
+    registry.AddAN<AN_avx512_16_32_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_u_inv", "AN AVX512 U Inv", CPU::ISA::AVX512, 16);
+    registry.AddAN<AN_avx512_16_32_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_u_inv_nt", "AN AVX512 U Inv NT", CPU::ISA::AVX512, 16);
+    registry.AddAN<AN_avx512_16_32_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_u_inv_deferred", "AN AVX512 U Inv Deferred", CPU::ISA::AVX512, 16);
+    registry.AddAN<AN_avx512_16_32_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx512_16_32_s_inv", "AN AVX512 S Inv", CPU::ISA::AVX512, 16);
+    registry.AddAN<ANB_avx512_16_32_u, UNROLL_LO, UNROLL_HI>("ANB_avx512_16_32_u", "ANB AVX512 U", CPU::ISA::AVX512, 16);
+    registry.AddAN<ANBD_avx512_16_32_u, UNROLL_LO, UNROLL_HI>("ANBD_avx512_16_32_u", "ANBD AVX512 U", CPU::ISA::AVX512, 16);
+    registry.Add<Hamming_avx512_16, UNROLL_LO, UNROLL_HI>("Hamming_avx512_16", "Hamming AVX512", "Hamming", CPU::ISA::AVX512, 16);
+    registry.Add<Hamming_soa_avx512_16, UNROLL_LO, UNROLL_HI>("Hamming_soa_avx512_16", "Hamming SoA AVX512", "Hamming", CPU::ISA::AVX512, 16);
+#if defined(__VPCLMULQDQ__) or defined(RUNTIME_DISPATCH)
+    registry.Add<CRC32_avx512_16, UNROLL_LO, UNROLL_HI>("CRC32_avx512_16", "CRC32 AVX512", "CRC", CPU::ISA::AVX512, 16);
+#endif
+
+    registry.AddAN<AN_avx512_32_64_u_divmod, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_u_divmod", "AN AVX512 U DivMod", CPU::ISA::AVX512, 32);
+    registry.AddAN<AN_avx512_32_64_s_divmod, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_s_divmod", "AN AVX512 S DivMod", CPU::ISA::AVX512, 32);
+    registry.AddAN<AN_avx512_32_64_u_inv, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_u_inv", "AN AVX512 U Inv", CPU::ISA::AVX512, 32);
+    registry.AddAN<AN_avx512_32_64_u_inv_nt, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_u_inv_nt", "AN AVX512 U Inv NT", CPU::ISA::AVX512, 32);
+    registry.AddAN<AN_avx512_32_64_u_inv_deferred, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_u_inv_deferred", "AN AVX512 U Inv Deferred", CPU::ISA::AVX512, 32);
+    registry.AddAN<AN_avx512_32_64_s_inv, UNROLL_LO, UNROLL_HI>("AN_avx512_32_64_s_inv", "AN AVX512 S Inv", CPU::ISA::AVX512, 32);
+    registry.AddAN<ANB_avx512_32_64_u, UNROLL_LO, UNROLL_HI>("ANB_avx512_32_64_u", "ANB AVX512 U", CPU::ISA::AVX512, 32);
+    registry.AddAN<ANBD_avx512_32_64_u, UNROLL_LO, UNROLL_HI>("ANBD_avx512_32_64_u", "ANBD AVX512 U", CPU::ISA::AVX512, 32);
+    registry.Add<Hamming_avx512_32, UNROLL_LO, UNROLL_HI>("Hamming_avx512_32", "Hamming AVX512", "Hamming", CPU::ISA::AVX512, 32);
+    registry.Add<Hamming_soa_avx512_32, UNROLL_LO, UNROLL_HI>("Hamming_soa_avx512_32", "Hamming SoA AVX512", "Hamming", CPU::ISA::AVX512, 32);
+#if defined(__VPCLMULQDQ__) or defined(RUNTIME_DISPATCH)
+    registry.Add<CRC32_avx512_32, UNROLL_LO, UNROLL_HI>("CRC32_avx512_32", "CRC32 AVX512", "CRC", CPU::ISA::AVX512, 32);
+#endif
+#else
+    (void) registry;
+#endif /* __AVX512F__ */
+}
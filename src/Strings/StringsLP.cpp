@@ -0,0 +1,169 @@
+// Copyright 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * File:   StringsLP.cpp
+ */
+
+#include <Strings/StringsLP.hpp>
+
+#ifdef __SSE4_2__
+template int mm_strcmp_lp<__m128i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+template int mm_strcmp_lp<__m128i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+template __m128i mm_strxor_lp<__m128i, uint8_t>(
+        const void * s);
+
+template __m128i mm_strxor_lp<__m128i, uint16_t>(
+        const void * s);
+
+template int mm_strcmp_lp_xor<__m128i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m128i old_xor1,
+        const __m128i old_xor2);
+
+template int mm_strcmp_lp_xor<__m128i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m128i old_xor1,
+        const __m128i old_xor2);
+
+template int mm_strcmp_lp_AN<__m128i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN<__m128i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m128i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m128i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
+
+#ifdef __AVX2__
+template int mm_strcmp_lp<__m256i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+template int mm_strcmp_lp<__m256i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+template __m256i mm_strxor_lp<__m256i, uint8_t>(
+        const void * s);
+
+template __m256i mm_strxor_lp<__m256i, uint16_t>(
+        const void * s);
+
+template int mm_strcmp_lp_xor<__m256i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m256i old_xor1,
+        const __m256i old_xor2);
+
+template int mm_strcmp_lp_xor<__m256i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m256i old_xor1,
+        const __m256i old_xor2);
+
+template int mm_strcmp_lp_AN<__m256i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN<__m256i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m256i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m256i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
+
+#ifdef __AVX512F__
+template int mm_strcmp_lp<__m512i, uint8_t>(
+        const void * s1,
+        const void * s2);
+
+template int mm_strcmp_lp<__m512i, uint16_t>(
+        const void * s1,
+        const void * s2);
+
+template __m512i mm_strxor_lp<__m512i, uint8_t>(
+        const void * s);
+
+template __m512i mm_strxor_lp<__m512i, uint16_t>(
+        const void * s);
+
+template int mm_strcmp_lp_xor<__m512i, uint8_t>(
+        const void * s1,
+        const void * s2,
+        const __m512i old_xor1,
+        const __m512i old_xor2);
+
+template int mm_strcmp_lp_xor<__m512i, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const __m512i old_xor1,
+        const __m512i old_xor2);
+
+template int mm_strcmp_lp_AN<__m512i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN<__m512i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m512i, uint8_t, uint16_t>(
+        const void * s1,
+        const void * s2,
+        const uint16_t A,
+        const uint16_t AInv);
+
+template int mm_strcmp_lp_AN_accu<__m512i, uint16_t, uint32_t>(
+        const void * s1,
+        const void * s2,
+        const uint32_t A,
+        const uint32_t AInv);
+#endif
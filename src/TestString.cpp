@@ -31,10 +31,16 @@
 #include <Util/Stopwatch.hpp>
 #include <Util/AlignedBlock.hpp>
 #include <Util/Test.hpp>
+#include <Util/TestCase.hpp>
+#include <Util/Output.hpp>
+#include <Util/Euclidean.hpp>
 
 #include <Strings/Strings.hpp>
 #include <Strings/StringsAN.hpp>
 #include <Strings/StringsXOR.hpp>
+#include <Strings/StringTest.hpp>
+
+using namespace coding_benchmark;
 
 template<typename DATARAW>
 void ResetBlock(
@@ -85,6 +91,34 @@ void test_buffer(
     }
 }
 
+/**
+ * Flips the same bit of the same limb of two equal strings, so that the comparison finds no difference and only the
+ * verification of the accumulated code words can detect the error. Returns whether mm_strcmp_lp_AN_accu detects it.
+ */
+template<typename VEC, typename DATARAW, typename DATAENC>
+bool test_lp_AN_accu_detects(
+        const DATAENC A,
+        const DATAENC AInv,
+        const size_t length,
+        const size_t position) {
+    AlignedBlock buf1(LPString<DATAENC>::numBytes(length), 64);
+    AlignedBlock buf2(LPString<DATAENC>::numBytes(length), 64);
+    DATAENC * limbs1 = LPString<DATAENC>::init(buf1.begin(), length);
+    DATAENC * limbs2 = LPString<DATAENC>::init(buf2.begin(), length);
+    for (size_t i = 0; i < length; ++i) {
+        // data close to the maximum, so that the accumulated code words get close to overflowing
+        limbs1[i] = limbs2[i] = static_cast<DATAENC>(static_cast<DATAENC>(std::numeric_limits<DATARAW>::max() - (i & 0x3)) * A);
+    }
+    limbs1[position] ^= 1;
+    limbs2[position] ^= 1;
+    try {
+        mm_strcmp_lp_AN_accu<VEC, DATARAW, DATAENC>(buf1.begin(), buf2.begin(), A, AInv);
+    } catch (std::runtime_error &) {
+        return true;
+    }
+    return false;
+}
+
 int main(
         int argc,
         char** argv) {
@@ -267,5 +301,84 @@ int main(
         std::cout << "K. AN accu," << res << ',' << time << ',' << time_base << '\n';
     }
 
+    {
+        // length-prefixed strings in the test harness, the check sub test compares two equal strings
+        const constexpr size_t numElements = 1024 * 1024;
+        const constexpr size_t iterations = 10;
+        const constexpr size_t UNROLL_LO = 1;
+        const constexpr size_t UNROLL_HI = 1;
+        std::cout << "\n\n#Length-prefixed strings with " << numElements << " limbs, " << iterations << " iterations\n";
+
+        AlignedBlock bufRaw8(numElements * sizeof(uint8_t), 64);
+        AlignedBlock bufRaw16(numElements * sizeof(uint16_t), 64);
+        AlignedBlock bufEncoded(StringTest<uint16_t, uint32_t>::getEncodedNumBytes(numElements), 64);
+        AlignedBlock bufResult(numElements * sizeof(uint16_t), 64);
+        std::vector<std::vector<TestInfos>> vecTestInfos;
+        vecTestInfos.reserve(32); // Reserve space to store sub-vectors!
+        TestConfiguration testConfig(iterations, numElements);
+        testConfig.disableAll();
+        testConfig.enableCheck = true;
+        DataGenerationConfiguration dataGenConfig;
+
+        const uint16_t A8 = (argc > 1) ? static_cast<uint16_t>(strtol(argv[1], &ptr_end, 10)) : 233;
+        const uint16_t A8Inv = static_cast<uint16_t>(ext_euclidean(uint32_t(A8), 16));
+        const uint32_t A16 = A;
+        const uint32_t A16Inv = static_cast<uint32_t>(ext_euclidean(uint64_t(A16), 32));
+
+#ifdef __SSE4_2__
+        TestCase<StringTest_plain_sse42_8, UNROLL_LO, UNROLL_HI>("StringTest_plain_sse42_8", "SSE4.2 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_sse42_8, UNROLL_LO, UNROLL_HI>("StringTest_xor_sse42_8", "SSE4.2 XOR 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_sse42_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_sse42_8_16", "SSE4.2 AN 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_sse42_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_sse42_8_16", "SSE4.2 AN accu 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_plain_sse42_16, UNROLL_LO, UNROLL_HI>("StringTest_plain_sse42_16", "SSE4.2 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_sse42_16, UNROLL_LO, UNROLL_HI>("StringTest_xor_sse42_16", "SSE4.2 XOR 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_sse42_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_sse42_16_32", "SSE4.2 AN 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_sse42_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_sse42_16_32", "SSE4.2 AN accu 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+#endif
+#ifdef __AVX2__
+        TestCase<StringTest_plain_avx2_8, UNROLL_LO, UNROLL_HI>("StringTest_plain_avx2_8", "AVX2 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_avx2_8, UNROLL_LO, UNROLL_HI>("StringTest_xor_avx2_8", "AVX2 XOR 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_avx2_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_avx2_8_16", "AVX2 AN 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_avx2_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_avx2_8_16", "AVX2 AN accu 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_plain_avx2_16, UNROLL_LO, UNROLL_HI>("StringTest_plain_avx2_16", "AVX2 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_avx2_16, UNROLL_LO, UNROLL_HI>("StringTest_xor_avx2_16", "AVX2 XOR 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_avx2_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_avx2_16_32", "AVX2 AN 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_avx2_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_avx2_16_32", "AVX2 AN accu 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+#endif
+#ifdef __AVX512F__
+        TestCase<StringTest_plain_avx512_8, UNROLL_LO, UNROLL_HI>("StringTest_plain_avx512_8", "AVX512 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_avx512_8, UNROLL_LO, UNROLL_HI>("StringTest_xor_avx512_8", "AVX512 XOR 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_avx512_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_avx512_8_16", "AVX512 AN 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_avx512_8_16, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_avx512_8_16", "AVX512 AN accu 8/16", bufRaw8, bufEncoded, bufResult, A8, A8Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_plain_avx512_16, UNROLL_LO, UNROLL_HI>("StringTest_plain_avx512_16", "AVX512 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_xor_avx512_16, UNROLL_LO, UNROLL_HI>("StringTest_xor_avx512_16", "AVX512 XOR 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_avx512_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_avx512_16_32", "AVX512 AN 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+        TestCase<StringTest_AN_accu_avx512_16_32, UNROLL_LO, UNROLL_HI>("StringTest_AN_accu_avx512_16_32", "AVX512 AN accu 16/32", bufRaw16, bufEncoded, bufResult, A16, A16Inv, testConfig, dataGenConfig, vecTestInfos);
+#endif
+
+        printResults<false>(testConfig, vecTestInfos, OutputConfiguration(false, false, true));
+
+        // a bit flip in one limb of two equal long strings must be detected by the deferred verification
+        const size_t numLimbs = 1024 * 1024;
+        const size_t position = numLimbs / 2 + 3;
+        bool isDetected = true;
+#ifdef __SSE4_2__
+        isDetected &= test_lp_AN_accu_detects<__m128i, uint8_t, uint16_t>(A8, A8Inv, numLimbs, position);
+        isDetected &= test_lp_AN_accu_detects<__m128i, uint16_t, uint32_t>(A16, A16Inv, numLimbs, position);
+#endif
+#ifdef __AVX2__
+        isDetected &= test_lp_AN_accu_detects<__m256i, uint8_t, uint16_t>(A8, A8Inv, numLimbs, position);
+        isDetected &= test_lp_AN_accu_detects<__m256i, uint16_t, uint32_t>(A16, A16Inv, numLimbs, position);
+#endif
+#ifdef __AVX512F__
+        isDetected &= test_lp_AN_accu_detects<__m512i, uint8_t, uint16_t>(A8, A8Inv, numLimbs, position);
+        isDetected &= test_lp_AN_accu_detects<__m512i, uint16_t, uint32_t>(A16, A16Inv, numLimbs, position);
+#endif
+        if (!isDetected) {
+            std::cerr << "A corrupted limb of a long string was not detected by mm_strcmp_lp_AN_accu." << std::endl;
+            return 1;
+        }
+    }
+
     return 0;
 }
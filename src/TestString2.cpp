@@ -31,10 +31,14 @@
 #include <Util/Stopwatch.hpp>
 #include <Util/AlignedBlock.hpp>
 #include <Util/Test.hpp>
+#include <Util/Euclidean.hpp>
 
 #include <Strings/Strings.hpp>
 #include <Strings/StringsAN.hpp>
 #include <Strings/StringsXOR.hpp>
+#include <Strings/StringTest.hpp>
+
+using namespace coding_benchmark;
 
 template<typename DATARAW>
 void ResetBlock(
@@ -71,6 +75,25 @@ void ResetBlock(
     }
 }
 
+// runs the check sub test of a single length-prefixed string test and returns its nanoseconds per iteration
+template<template<size_t> class TestType, typename ... ArgTypes>
+int64_t RunStringTest(
+        const char* const name,
+        AlignedBlock & bufRaw,
+        AlignedBlock & bufEncoded,
+        AlignedBlock & bufResult,
+        const TestConfiguration & testConfig,
+        const DataGenerationConfiguration & dataGenConfig,
+        ArgTypes && ... args) {
+    auto infos = TestType<1>(name, bufRaw, bufEncoded, bufResult, std::forward<ArgTypes>(args)...).Execute(testConfig, dataGenConfig);
+    std::clog << std::endl;
+    if (!infos.check.error.empty()) {
+        std::cerr << "#" << name << ": " << infos.check.error << '\n';
+        return -1;
+    }
+    return infos.check.nanos / static_cast<int64_t>(testConfig.numIterations);
+}
+
 template<typename T>
 void test_buffer(
         const T * beg,
@@ -348,5 +371,55 @@ int main(
         }
     }
 
+#if defined(__AVX512F__)
+#define LP_TEST(KIND, WIDTH) StringTest_ ## KIND ## _avx512_ ## WIDTH
+#elif defined(__AVX2__)
+#define LP_TEST(KIND, WIDTH) StringTest_ ## KIND ## _avx2_ ## WIDTH
+#elif defined(__SSE4_2__)
+#define LP_TEST(KIND, WIDTH) StringTest_ ## KIND ## _sse42_ ## WIDTH
+#endif
+
+#ifdef LP_TEST
+    {
+        // the same sweep for the length-prefixed strings in the test harness, with the widest SIMD extension available
+        int64_t timeLP[8][LENGTH_PART_MAX + 1];
+        AlignedBlock bufRaw8(NUM_BYTES_CHAR, 64);
+        AlignedBlock bufRaw16(NUM_BYTES_SHORT, 64);
+        AlignedBlock bufEncoded(StringTest<uint16_t, uint32_t>::getEncodedNumBytes(NUM), 64);
+        AlignedBlock bufResult(NUM_BYTES_SHORT, 64);
+        TestConfiguration testConfig(NUM_ITERATIONS, NUM);
+        testConfig.disableAll();
+        testConfig.enableCheck = true;
+        DataGenerationConfiguration dataGenConfig;
+
+        const uint16_t A8 = (argc > 5) ? static_cast<uint16_t>(strtol(argv[5], &ptr_end, 10)) : 233;
+        const uint16_t A8Inv = static_cast<uint16_t>(ext_euclidean(uint32_t(A8), 16));
+        const uint32_t A16 = A;
+        const uint32_t A16Inv = static_cast<uint32_t>(ext_euclidean(uint64_t(A16), 32));
+
+        for (ssize_t i = LENGTH_PART_START; i > 0; i -= LENGTH_PART_DECREASE) {
+            const double ratio = static_cast<double>(i) / LENGTH_PART_MAX;
+            timeLP[0][i] = RunStringTest<LP_TEST(plain, 8)>("LP 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, ratio);
+            timeLP[1][i] = RunStringTest<LP_TEST(xor, 8)>("LP XOR 8", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, ratio);
+            timeLP[2][i] = RunStringTest<LP_TEST(AN, 8_16)>("LP AN 8/16", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, A8, A8Inv, ratio);
+            timeLP[3][i] = RunStringTest<LP_TEST(AN_accu, 8_16)>("LP AN accu 8/16", bufRaw8, bufEncoded, bufResult, testConfig, dataGenConfig, A8, A8Inv, ratio);
+            timeLP[4][i] = RunStringTest<LP_TEST(plain, 16)>("LP 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, ratio);
+            timeLP[5][i] = RunStringTest<LP_TEST(xor, 16)>("LP XOR 16", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, ratio);
+            timeLP[6][i] = RunStringTest<LP_TEST(AN, 16_32)>("LP AN 16/32", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, A16, A16Inv, ratio);
+            timeLP[7][i] = RunStringTest<LP_TEST(AN_accu, 16_32)>("LP AN accu 16/32", bufRaw16, bufEncoded, bufResult, testConfig, dataGenConfig, A16, A16Inv, ratio);
+        }
+
+        std::cout << "\n\nratio\tLP 8\tLP XOR 8\tLP AN 8/16\tLP AN accu 8/16\tLP 16\tLP XOR 16\tLP AN 16/32\tLP AN accu 16/32\n";
+        for (ssize_t i = LENGTH_PART_START; i > 0; i -= LENGTH_PART_DECREASE) {
+            std::cout << i;
+            for (size_t k = 0; k < 8; ++k) {
+                std::cout << '\t' << timeLP[k][i];
+            }
+            std::cout << '\n';
+        }
+    }
+#undef LP_TEST
+#endif
+
     return 0;
 }
@@ -0,0 +1,301 @@
+// Copyright 2017 Till Kolditz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * TestStringDictionary.cpp
+ *
+ * Lookup throughput of the protected string dictionaries against the unprotected one, for growing numbers of entries
+ * and each of the supported vector widths.
+ * Usage: TestStringDictionary [NUM_MIN [NUM_MAX [NUM_LOOKUPS [A8 [A16]]]]]
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <Util/Stopwatch.hpp>
+#include <Strings/StringDictionary.hpp>
+
+using namespace coding_benchmark;
+
+/*
+ * Strings in the same heap and offsets form the dictionary takes.
+ */
+template<typename T>
+struct StringColumn {
+    std::vector<T> heap;
+    std::vector<size_t> offsets;
+
+    StringColumn()
+            : heap(),
+              offsets(1, 0) {
+    }
+
+    void append(
+            const T * s,
+            const size_t length) {
+        heap.insert(heap.end(), s, s + length);
+        offsets.push_back(heap.size());
+    }
+
+    size_t size() const {
+        return offsets.size() - 1;
+    }
+
+    const T * get(
+            const size_t i) const {
+        return heap.data() + offsets[i];
+    }
+
+    size_t length(
+            const size_t i) const {
+        return offsets[i + 1] - offsets[i];
+    }
+};
+
+const constexpr size_t MAX_SUFFIX = 6;
+
+/*
+ * Entry i consists of the base-26 digits of i as letters, all of the same width so that the entries are sorted by i,
+ * followed by (i % (MAX_SUFFIX + 1)) more letters.
+ */
+template<typename T>
+size_t MakeEntry(
+        const size_t i,
+        const size_t width,
+        T * out) {
+    size_t x = i;
+    for (size_t k = width; k > 0; --k) {
+        out[k - 1] = static_cast<T>('a' + (x % 26));
+        x /= 26;
+    }
+    const size_t lengthSuffix = i % (MAX_SUFFIX + 1);
+    for (size_t k = 0; k < lengthSuffix; ++k) {
+        out[width + k] = static_cast<T>('a' + ((i * 7 + k) % 26));
+    }
+    return width + lengthSuffix;
+}
+
+/*
+ * The lookup keys for a dictionary of num entries: even ones hit entry getEntry(j), odd ones miss it by an over-long
+ * suffix. The prefixes select the entries sharing all but the last digit, the ranges span up to 100 entries.
+ */
+template<typename T>
+struct Lookups {
+    StringColumn<T> keys;
+    StringColumn<T> prefixes;
+    StringColumn<T> rangesLo;
+    StringColumn<T> rangesHi;
+    size_t expectedHits;
+    size_t expectedSum; // over the indices of the hits
+
+    static size_t getEntry(
+            const size_t j,
+            const size_t num) {
+        return (j * 2654435761ull) % num;
+    }
+
+    Lookups(
+            const size_t num,
+            const size_t width,
+            const size_t numLookups)
+            : keys(),
+              prefixes(),
+              rangesLo(),
+              rangesHi(),
+              expectedHits(0),
+              expectedSum(0) {
+        std::vector<T> buf(width + MAX_SUFFIX + 1);
+        for (size_t j = 0; j < numLookups; ++j) {
+            const size_t i = getEntry(j, num);
+            size_t length = MakeEntry(i, width, buf.data());
+            if (j & 1) {
+                length = width;
+                while (length < (width + MAX_SUFFIX + 1)) {
+                    buf[length++] = static_cast<T>('z');
+                }
+            } else {
+                ++expectedHits;
+                expectedSum += i;
+            }
+            keys.append(buf.data(), length);
+            prefixes.append(buf.data(), width - 1);
+            rangesLo.append(buf.data(), MakeEntry(i, width, buf.data()));
+            rangesHi.append(buf.data(), MakeEntry(std::min(i + 100, num - 1), width, buf.data()));
+        }
+    }
+};
+
+template<typename Codec>
+StringColumn<typename Codec::enc_t> EncodeKeys(
+        const StringDictionary<Codec> & dict,
+        const StringColumn<typename Codec::raw_t> & raw) {
+    StringColumn<typename Codec::enc_t> result;
+    std::vector<typename Codec::enc_t> buf;
+    for (size_t i = 0; i < raw.size(); ++i) {
+        buf.resize(raw.length(i));
+        dict.encodeKey(raw.get(i), raw.length(i), buf.data());
+        result.append(buf.data(), buf.size());
+    }
+    // the keys follow each other, so only the last one needs the padding
+    result.heap.resize(result.heap.size() + StringDictionary<Codec>::PADDING);
+    return result;
+}
+
+template<typename Codec>
+void RunDictionary(
+        const Codec & codec,
+        const StringColumn<typename Codec::raw_t> & entries,
+        const Lookups<typename Codec::raw_t> & lookups) {
+    typedef typename Codec::enc_t enc_t;
+    const StringDictionary<Codec> dict(codec, entries.heap.data(), entries.offsets);
+    const auto keys = EncodeKeys(dict, lookups.keys);
+    const auto prefixes = EncodeKeys(dict, lookups.prefixes);
+    const auto rangesLo = EncodeKeys(dict, lookups.rangesLo);
+    const auto rangesHi = EncodeKeys(dict, lookups.rangesHi);
+    const size_t numLookups = keys.size();
+    Stopwatch sw;
+
+    size_t hits = 0;
+    size_t sum = 0;
+    sw.Reset();
+    for (size_t j = 0; j < numLookups; ++j) {
+        const size_t i = dict.find(keys.get(j), keys.length(j));
+        hits += (i != dict.npos);
+        sum += (i != dict.npos) ? i : 0;
+    }
+    const int64_t timeFind = sw.Current();
+    if ((hits != lookups.expectedHits) || (sum != lookups.expectedSum)) {
+        std::cerr << "#" << codec.getName() << ": find returned " << hits << " hits (sum " << sum << ") instead of " << lookups.expectedHits << " (sum " << lookups.expectedSum << ")\n";
+    }
+
+    size_t numMatches = 0;
+    sw.Reset();
+    for (size_t j = 0; j < numLookups; ++j) {
+        const auto range = dict.findPrefix(prefixes.get(j), prefixes.length(j));
+        numMatches += range.second - range.first;
+    }
+    const int64_t timePrefix = sw.Current();
+
+    size_t numInRange = 0;
+    sw.Reset();
+    for (size_t j = 0; j < numLookups; ++j) {
+        const auto range = dict.findRange(rangesLo.get(j), rangesLo.length(j), rangesHi.get(j), rangesHi.length(j));
+        numInRange += range.second - range.first;
+    }
+    const int64_t timeRange = sw.Current();
+
+    std::cout << dict.size() << '\t' << codec.getName() << '\t' << (sizeof(typename Codec::vec_t) * 8) << '\t' << (sizeof(typename Codec::raw_t) * 8) << '/' << (sizeof(enc_t) * 8) << '\t' << dict.getNumBytes() << '\t' << (double(timeFind) / numLookups) << '\t'
+            << (double(timePrefix) / numLookups) << '\t' << (double(timeRange) / numLookups) << '\t' << numMatches << '\t' << numInRange << std::endl;
+}
+
+template<typename T>
+void RunDictionaries(
+        const size_t num,
+        const size_t numLookups,
+        const std::vector<std::function<void(const StringColumn<T> &, const Lookups<T> &)>> & runs) {
+    size_t width = 1;
+    for (size_t x = num; x > 26; x /= 26) {
+        ++width;
+    }
+    StringColumn<T> entries;
+    std::vector<T> buf(width + MAX_SUFFIX);
+    for (size_t i = 0; i < num; ++i) {
+        entries.append(buf.data(), MakeEntry(i, width, buf.data()));
+    }
+    const Lookups<T> lookups(num, width, numLookups);
+    for (auto & run : runs) {
+        run(entries, lookups);
+    }
+}
+
+template<typename VEC>
+void RunAllDictionaries(
+        const size_t num,
+        const size_t numLookups,
+        const uint16_t A8,
+        const uint32_t A16) {
+    RunDictionaries<uint8_t>(num, numLookups, {
+        [] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryPlain<VEC, uint8_t>(), entries, lookups);},
+        [] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryXOR<VEC, uint8_t>(), entries, lookups);},
+        [A8] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryAN<VEC, uint8_t, uint16_t>(A8), entries, lookups);}
+    });
+    RunDictionaries<uint16_t>(num, numLookups, {
+        [] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryPlain<VEC, uint16_t>(), entries, lookups);},
+        [] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryXOR<VEC, uint16_t>(), entries, lookups);},
+        [A16] (const auto & entries, const auto & lookups) {RunDictionary(StringDictionaryAN<VEC, uint16_t, uint32_t>(A16), entries, lookups);}
+    });
+}
+
+int main(
+        int argc,
+        char** argv) {
+    size_t NUM_MIN = 1000;
+    size_t NUM_MAX = 10000000;
+    size_t NUM_LOOKUPS = 1000000;
+    uint16_t A8 = 233;
+    uint32_t A16 = 63877;
+
+    char* ptr_end;
+    if (argc > 1) {
+        NUM_MIN = strtoull(argv[1], &ptr_end, 10);
+    }
+    if (argc > 2) {
+        NUM_MAX = strtoull(argv[2], &ptr_end, 10);
+    }
+    if (argc > 3) {
+        NUM_LOOKUPS = strtoull(argv[3], &ptr_end, 10);
+    }
+    if (argc > 4) {
+        const unsigned long tmp = strtoul(argv[4], &ptr_end, 10);
+        if (tmp > std::numeric_limits<uint16_t>::max()) {
+            std::cerr << "# A8 = " << tmp << " exceeds 16 bits" << std::endl;
+            return 1;
+        }
+        A8 = static_cast<uint16_t>(tmp);
+    }
+    if (argc > 5) {
+        const unsigned long tmp = strtoul(argv[5], &ptr_end, 10);
+        if (tmp > std::numeric_limits<uint32_t>::max()) {
+            std::cerr << "# A16 = " << tmp << " exceeds 32 bits" << std::endl;
+            return 1;
+        }
+        A16 = static_cast<uint32_t>(tmp);
+    }
+
+    std::cout << "# lookups = " << NUM_LOOKUPS << ", times in nanoseconds per lookup\n";
+    std::cout << "entries\tdictionary\tvector bits\twidths\tbytes\tfind\tprefix\trange\tprefix matches\trange matches\n";
+    try {
+        for (size_t num = NUM_MIN; num <= NUM_MAX; num *= 10) {
+#ifdef __SSE4_2__
+            RunAllDictionaries<__m128i>(num, NUM_LOOKUPS, A8, A16);
+#endif
+#ifdef __AVX2__
+            RunAllDictionaries<__m256i>(num, NUM_LOOKUPS, A8, A16);
+#endif
+#ifdef __AVX512F__
+            RunAllDictionaries<__m512i>(num, NUM_LOOKUPS, A8, A16);
+#endif
+        }
+    } catch (std::exception & e) {
+        std::cerr << "#" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,536 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <strings.h>
+
+#include <Util/BenchmarkOptions.hpp>
+
+static const char* const FAMILIES[] = {"Copy", "XOR", "AN", "Hamming", "CRC"};
+
+static std::vector<std::string> splitList(
+        const std::string & value) {
+    std::vector<std::string> items;
+    size_t pos = 0;
+    while (pos <= value.size()) {
+        size_t end = value.find(',', pos);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+        if (end > pos) {
+            items.push_back(value.substr(pos, end - pos));
+        }
+        pos = end + 1;
+    }
+    return items;
+}
+
+static size_t parseNumber(
+        const std::string & option,
+        const std::string & value) {
+    char* endPtr = nullptr;
+    errno = 0;
+    size_t number = strtoull(value.c_str(), &endPtr, 0);
+    if (value.empty() || value[0] == '-' || *endPtr != 0 || errno != 0) {
+        throw std::invalid_argument(option + ": '" + value + "' is not a valid non-negative integer");
+    }
+    return number;
+}
+
+/**
+ * A number with an optional binary suffix K, M or G.
+ */
+static size_t parseSize(
+        const std::string & option,
+        const std::string & value) {
+    size_t shift = 0;
+    if (!value.empty()) {
+        switch (value.back()) {
+            case 'K':
+            case 'k':
+                shift = 10;
+                break;
+            case 'M':
+            case 'm':
+                shift = 20;
+                break;
+            case 'G':
+            case 'g':
+                shift = 30;
+                break;
+        }
+    }
+    return parseNumber(option, shift ? value.substr(0, value.size() - 1) : value) << shift;
+}
+
+static std::vector<size_t> parseNumbers(
+        const std::string & option,
+        const std::string & value) {
+    std::vector<size_t> numbers;
+    for (auto & item : splitList(value)) {
+        numbers.push_back(parseNumber(option, item));
+    }
+    return numbers;
+}
+
+/**
+ * A non-negative decimal number, e.g. 1e-3.
+ */
+static double parseRate(
+        const std::string & option,
+        const std::string & value) {
+    char* endPtr = nullptr;
+    errno = 0;
+    double rate = strtod(value.c_str(), &endPtr);
+    if (value.empty() || *endPtr != 0 || errno != 0 || !(rate >= 0.0)) {
+        throw std::invalid_argument(option + ": '" + value + "' is not a valid non-negative number");
+    }
+    return rate;
+}
+
+/**
+ * single, multi:N, burst:N, stuck0 or stuck1, see FaultModel.
+ */
+static void parseFaultModel(
+        const std::string & option,
+        const std::string & value,
+        FaultSpec & spec) {
+    const auto posColon = value.find(':');
+    const std::string name = value.substr(0, posColon);
+    const bool hasBits = (name == "multi") || (name == "burst");
+    if (hasBits != (posColon != std::string::npos)) {
+        throw std::invalid_argument(option + ": expected single, multi:N, burst:N, stuck0 or stuck1");
+    }
+    for (auto model : {FaultModel::SingleBit, FaultModel::MultiBit, FaultModel::Burst, FaultModel::StuckAt0, FaultModel::StuckAt1}) {
+        if (name == getFaultModelName(model)) {
+            spec.model = model;
+            spec.numBits = hasBits ? parseNumber(option, value.substr(posColon + 1)) : 1;
+            if (spec.numBits == 0 || (model == FaultModel::MultiBit && spec.numBits > 64)) {
+                throw std::invalid_argument(option + ": " + name + " needs 1 to 64 bits");
+            }
+            return;
+        }
+    }
+    throw std::invalid_argument(option + ": unknown fault model '" + name + "'");
+}
+
+/**
+ * NAME:CONFIG, e.g. uops_port0:0x01A1, see PerfEvent::Raw.
+ */
+static PerfEvent parsePerfEvent(
+        const std::string & option,
+        const std::string & value) {
+    const auto posColon = value.find(':');
+    if (posColon == 0 || posColon == std::string::npos) {
+        throw std::invalid_argument(option + ": expected NAME:CONFIG, e.g. uops_port0:0x01A1");
+    }
+    return PerfEvent::Raw(value.substr(0, posColon), parseNumber(option, value.substr(posColon + 1)));
+}
+
+BenchmarkOptions::BenchmarkOptions()
+        : numElements( {1000001}),
+          numIterations( {10000}),
+          sweepMin(0),
+          sweepMax(0),
+          sweepFactor(2),
+          numRepetitions(1),
+          rejectOutliers(),
+          phases( {"check", "filter", "filterChk", "decode"}), // the tests of the SIGMOD 2018 "AHEAD" paper
+          unrollSizes(),
+          families(),
+          isas(),
+          datawidths(),
+          As( {64311}),
+          pipeline(),
+          pipelineChunkBytes(16 * 1024),
+          correctionErrorRates(),
+          faultRates(),
+          faultSpec(),
+          filters(),
+          enablePerfCounters(false),
+          perfEvents(),
+          allocation(),
+          exportFileJSON(),
+          exportFileCSV(),
+          doList(false),
+          doHelp(false) {
+}
+
+BenchmarkOptions BenchmarkOptions::Parse(
+        int argc,
+        char* argv[]) {
+    BenchmarkOptions options;
+    bool isDefaultElements = true, isDefaultIterations = true, isDefaultPhases = true, isDefaultAs = true;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (arg == "-h" || arg == "--help") {
+            options.doHelp = true;
+            continue;
+        } else if (arg == "--list") {
+            options.doList = true;
+            continue;
+        } else if (arg == "--perf-counters") {
+            options.enablePerfCounters = true;
+            continue;
+        } else if (arg == "--prefault") {
+            options.allocation.prefault = true;
+            continue;
+        } else if (arg == "--reject-outliers") {
+            options.rejectOutliers = true;
+            continue;
+        } else if (arg == "--no-reject-outliers") {
+            options.rejectOutliers = false;
+            continue;
+        } else if (arg.compare(0, 2, "--") != 0) {
+            // a bare number is an A, as with the former benchmark16 / benchmark32 executables
+            if (isDefaultAs) {
+                options.As.clear();
+                isDefaultAs = false;
+            }
+            options.As.push_back(parseNumber("A", arg));
+            continue;
+        }
+        std::string option, value;
+        auto posEquals = arg.find('=');
+        if (posEquals != std::string::npos) {
+            option = arg.substr(0, posEquals);
+            value = arg.substr(posEquals + 1);
+        } else if (i + 1 < argc) {
+            option = arg;
+            value = argv[++i];
+        } else {
+            throw std::invalid_argument(arg + ": missing value");
+        }
+
+        if (option == "--elements") {
+            if (isDefaultElements) {
+                options.numElements.clear();
+                isDefaultElements = false;
+            }
+            for (auto n : parseNumbers(option, value)) {
+                options.numElements.push_back(n);
+            }
+        } else if (option == "--iterations") {
+            if (isDefaultIterations) {
+                options.numIterations.clear();
+                isDefaultIterations = false;
+            }
+            for (auto n : parseNumbers(option, value)) {
+                options.numIterations.push_back(n);
+            }
+        } else if (option == "--sweep") {
+            auto posColon1 = value.find(':');
+            auto posColon2 = value.find(':', posColon1 + 1);
+            if (posColon1 == std::string::npos) {
+                throw std::invalid_argument(option + ": expected MIN:MAX[:FACTOR]");
+            }
+            options.sweepMin = parseSize(option, value.substr(0, posColon1));
+            options.sweepMax = parseSize(option, value.substr(posColon1 + 1, posColon2 - posColon1 - 1));
+            options.sweepFactor = (posColon2 == std::string::npos) ? 2 : parseNumber(option, value.substr(posColon2 + 1));
+            if (options.sweepMin == 0 || options.sweepMin > options.sweepMax || options.sweepFactor < 2) {
+                throw std::invalid_argument(option + ": expected 0 < MIN <= MAX and FACTOR >= 2");
+            }
+        } else if (option == "--repetitions") {
+            options.numRepetitions = parseNumber(option, value);
+        } else if (option == "--phases") {
+            if (isDefaultPhases) {
+                options.phases.clear();
+                isDefaultPhases = false;
+            }
+            for (auto & phase : splitList(value)) {
+                if (phase == "all") {
+                    options.phases = PhaseNames();
+                } else if (phase == "encode") {
+                    // always executed
+                } else if (std::find(PhaseNames().begin(), PhaseNames().end(), phase) != PhaseNames().end()) {
+                    options.phases.push_back(phase);
+                } else {
+                    throw std::invalid_argument(option + ": unknown phase '" + phase + "'");
+                }
+            }
+        } else if (option == "--unroll") {
+            for (auto n : parseNumbers(option, value)) {
+                if (n == 0 || (n & (n - 1)) != 0) {
+                    throw std::invalid_argument(option + ": " + std::to_string(n) + " is not a power of two");
+                }
+                options.unrollSizes.push_back(n);
+            }
+        } else if (option == "--family") {
+            for (auto & family : splitList(value)) {
+                auto it = std::find_if(std::begin(FAMILIES), std::end(FAMILIES), [&family] (const char* const f) {
+                    return strcasecmp(f, family.c_str()) == 0;
+                });
+                if (it == std::end(FAMILIES)) {
+                    throw std::invalid_argument(option + ": unknown code family '" + family + "'");
+                }
+                options.families.push_back(*it);
+            }
+        } else if (option == "--simd") {
+            for (auto & name : splitList(value)) {
+                bool isFound = false;
+                for (auto isa : {CPU::ISA::Scalar, CPU::ISA::SSE42, CPU::ISA::AVX2, CPU::ISA::AVX512}) {
+                    if (strcasecmp(getISAName(isa), name.c_str()) == 0) {
+                        options.isas.push_back(isa);
+                        isFound = true;
+                    }
+                }
+                if (!isFound) {
+                    throw std::invalid_argument(option + ": unknown SIMD level '" + name + "'");
+                }
+            }
+        } else if (option == "--datawidth") {
+            for (auto n : parseNumbers(option, value)) {
+                if (n != 16 && n != 32) {
+                    throw std::invalid_argument(option + ": only 16 and 32 bits are supported");
+                }
+                options.datawidths.push_back(n);
+            }
+        } else if (option == "--A") {
+            if (isDefaultAs) {
+                options.As.clear();
+                isDefaultAs = false;
+            }
+            for (auto n : parseNumbers(option, value)) {
+                options.As.push_back(n);
+            }
+        } else if (option == "--pipeline") {
+            options.pipeline.clear();
+            for (auto & name : splitList(value)) {
+                auto it = std::find_if(PipelineStages().begin(), PipelineStages().end(), [&name] (PipelineStage stage) {
+                    return name == getPipelineStageName(stage);
+                });
+                if (it == PipelineStages().end()) {
+                    throw std::invalid_argument(option + ": unknown stage '" + name + "'");
+                }
+                options.pipeline.push_back(*it);
+            }
+            if (!isValidPipeline(options.pipeline)) {
+                throw std::invalid_argument(option + ": encode takes raw data, all other stages encoded data");
+            }
+        } else if (option == "--chunk") {
+            options.pipelineChunkBytes = parseSize(option, value);
+            if (options.pipelineChunkBytes == 0) {
+                throw std::invalid_argument(option + ": must be at least 1 byte");
+            }
+        } else if (option == "--correct") {
+            for (auto & item : splitList(value)) {
+                options.correctionErrorRates.push_back(parseRate(option, item));
+            }
+        } else if (option == "--faults") {
+            for (auto & item : splitList(value)) {
+                options.faultRates.push_back(parseRate(option, item));
+            }
+        } else if (option == "--fault-model") {
+            parseFaultModel(option, value, options.faultSpec);
+        } else if (option == "--fault-dist") {
+            if (value == getFaultDistributionName(FaultDistribution::Uniform)) {
+                options.faultSpec.distribution = FaultDistribution::Uniform;
+            } else if (value == getFaultDistributionName(FaultDistribution::Clustered)) {
+                options.faultSpec.distribution = FaultDistribution::Clustered;
+            } else {
+                throw std::invalid_argument(option + ": expected uniform or clustered");
+            }
+        } else if (option == "--fault-seed") {
+            options.faultSpec.seed = parseNumber(option, value);
+        } else if (option == "--perf-event") {
+            for (auto & item : splitList(value)) {
+                options.perfEvents.push_back(parsePerfEvent(option, item));
+            }
+            options.enablePerfCounters = true;
+        } else if (option == "--pages") {
+            if (value == "default") {
+                options.allocation.pages = AllocationPolicy::Pages::Default;
+            } else if (value == "transparent") {
+                options.allocation.pages = AllocationPolicy::Pages::Transparent;
+            } else if (value == "explicit") {
+                options.allocation.pages = AllocationPolicy::Pages::Explicit;
+            } else {
+                throw std::invalid_argument(option + ": expected default, transparent or explicit");
+            }
+        } else if (option == "--numa") {
+            if (value == "default") {
+                options.allocation.numa = AllocationPolicy::NUMA::Default;
+            } else if (value == "interleave") {
+                options.allocation.numa = AllocationPolicy::NUMA::Interleave;
+            } else {
+                options.allocation.numa = AllocationPolicy::NUMA::Bind;
+                options.allocation.numaNode = static_cast<unsigned>(parseNumber(option, value));
+            }
+        } else if (option == "--filter") {
+            options.filters.push_back(value);
+        } else if (option == "--json") {
+            options.exportFileJSON = value;
+        } else if (option == "--csv") {
+            options.exportFileCSV = value;
+        } else {
+            throw std::invalid_argument("unknown option " + option);
+        }
+    }
+    for (auto A : options.As) {
+        if ((A & 1) == 0) {
+            throw std::invalid_argument("A=" + std::to_string(A) + " is not a positive, non-zero, odd integer");
+        }
+    }
+    if (options.isSweep()) {
+        if (!isDefaultElements) {
+            throw std::invalid_argument("--sweep and --elements are mutually exclusive");
+        }
+        options.numElements.clear();
+        for (size_t n = options.sweepMin; n <= options.sweepMax; n *= options.sweepFactor) {
+            options.numElements.push_back(n);
+            if (n > options.sweepMax / options.sweepFactor) {
+                break;
+            }
+        }
+    }
+    if (options.numRepetitions == 0) {
+        throw std::invalid_argument("--repetitions must be at least 1");
+    }
+    return options;
+}
+
+void BenchmarkOptions::PrintUsage(
+        std::ostream & out,
+        const char* const program) {
+    out << "Usage: " << program << " [options] [A ...]\n"
+            "  --elements N,...     number of values per test (default 1000001)\n"
+            "  --iterations N,...   runs over the data per measurement (default 10000)\n"
+            "                       each combination of elements and iterations is measured separately\n"
+            "  --sweep MIN:MAX[:F]  numbers of values from MIN to MAX growing by factor F (default 2), e.g. 2K:512M;\n"
+            "                       MIN runs --iterations times, larger sizes proportionally fewer\n"
+            "  --repetitions N      measurements per sub test, > 1 adds the timing statistics (default 1)\n"
+            "  --reject-outliers    leave repetitions further than 3 scaled MADs from the median out of the timing\n"
+            "                       statistics (default)\n"
+            "  --no-reject-outliers keep all repetitions in the timing statistics\n"
+            "  --phases P,...       sub tests besides encoding, or 'all' (default check,filter,filterChk,decode):\n"
+            "                      ";
+    for (auto & phase : PhaseNames()) {
+        out << ' ' << phase;
+    }
+    out << "\n"
+            "  --unroll N,...       unroll / block sizes out of the compiled-in powers of two (default all)\n"
+            "  --family F,...       Copy, XOR, AN, Hamming, CRC (default all)\n"
+            "  --simd S,...         scalar, sse42, avx2, avx512 (default all the CPU supports)\n"
+            "  --datawidth W,...    16, 32 (default all)\n"
+            "  --A A,...            AN coding parameters, odd and less than 2^datawidth (default 64311)\n"
+            "  --pipeline S,...     also run this operator chain fused over cache-sized chunks and phase at a time,\n"
+            "                       e.g. add,mulChk,decodeChk; it starts on the encoded data unless it starts with\n"
+            "                       encode, which takes raw data (i.e. only comes first or after a decode):\n"
+            "                      ";
+    for (auto stage : PipelineStages()) {
+        out << ' ' << getPipelineStageName(stage);
+    }
+    out << "\n"
+            "  --chunk BYTES        encoded bytes per chunk of the fused pipeline and of --faults (default 16K)\n"
+            "  --correct RATE,...   also run single-error correction (Hamming) with RATE faults per value injected\n"
+            "                       into the encoded data, e.g. 1e-4,1e-3\n"
+            "  --faults RATE,...    also check the encoded data chunk by chunk with RATE faults per value injected,\n"
+            "                       counting detected and silently corrupted chunks, e.g. 1e-4,1e-3\n"
+            "  --fault-model M      single, multi:N (N bits of a 64-bit word), burst:N (N adjacent bits), stuck0,\n"
+            "                       stuck1 (default single)\n"
+            "  --fault-dist D       uniform, clustered (16 faults per 8K region) (default uniform)\n"
+            "  --fault-seed N       seed of the injected faults (default 0x5EC)\n"
+            "  --filter PATTERN     only tests whose name matches, e.g. 'AN_avx2_*_inv'; may be repeated\n"
+            "  --perf-counters      count hardware performance events per value (Linux only)\n"
+            "  --perf-event N:C,... also count these model-specific raw events, e.g. uops_port0:0x01A1 for\n"
+            "                       UOPS_DISPATCHED.PORT_0 on Skylake; implies --perf-counters\n"
+            "  --pages P            pages of the data buffers: default, transparent (huge pages via madvise),\n"
+            "                       explicit (2 MiB pages reserved via vm.nr_hugepages) (default default)\n"
+            "  --numa N             place the data buffers on NUMA node N, or 'interleave' them over all nodes\n"
+            "  --prefault           touch the data buffers right after allocating them, not in the first measured run\n"
+            "  --json FILE          export the results as JSON\n"
+            "  --csv FILE           export the results as long-format CSV\n"
+            "  --list               list the selected tests instead of running them\n"
+            "  -h, --help           show this help\n"
+            "The memcpy / memcmp baseline (Copy) of each data width is always run as the reference." << std::endl;
+}
+
+const std::vector<PipelineStage> & BenchmarkOptions::PipelineStages() {
+    static const std::vector<PipelineStage> stages = {PipelineStage::Encode, PipelineStage::Check, PipelineStage::Add, PipelineStage::Sub, PipelineStage::Mul, PipelineStage::Div,
+            PipelineStage::AddChk, PipelineStage::SubChk, PipelineStage::MulChk, PipelineStage::DivChk, PipelineStage::Decode, PipelineStage::DecodeChk};
+    return stages;
+}
+
+const std::vector<std::string> & BenchmarkOptions::PhaseNames() {
+    static const std::vector<std::string> names = {"check", "scrub", "filter", "filterChk", "arithmetic", "arithmeticChk", "aggregate", "aggregateChk", "reencodeChk", "decode", "decodeChk", "decodeView"};
+    return names;
+}
+
+void BenchmarkOptions::configure(
+        TestConfiguration & testConfig) const {
+    auto isEnabled = [this] (const char* const phase) {
+        return std::find(phases.begin(), phases.end(), phase) != phases.end();
+    };
+    testConfig.enableCheck = isEnabled("check");
+    testConfig.enableScrub = isEnabled("scrub");
+    testConfig.enableFilter = isEnabled("filter");
+    testConfig.enableFilterChk = isEnabled("filterChk");
+    testConfig.enableArithmetic = isEnabled("arithmetic");
+    testConfig.enableArithmeticChk = isEnabled("arithmeticChk");
+    testConfig.enableAggregate = isEnabled("aggregate");
+    testConfig.enableAggregateChk = isEnabled("aggregateChk");
+    testConfig.enableReencodeChk = isEnabled("reencodeChk");
+    testConfig.enableDecode = isEnabled("decode");
+    testConfig.enableDecodeChk = isEnabled("decodeChk");
+    testConfig.enableDecodeView = isEnabled("decodeView");
+    testConfig.numRepetitions = numRepetitions;
+    if (rejectOutliers) {
+        testConfig.rejectOutliers = *rejectOutliers;
+    }
+    testConfig.enablePerfCounters = enablePerfCounters;
+    testConfig.perfEvents = perfEvents;
+    testConfig.allocation = allocation;
+    testConfig.blockSizes = unrollSizes;
+    testConfig.pipeline = pipeline;
+    testConfig.pipelineChunkBytes = pipelineChunkBytes;
+    testConfig.correctionErrorRates = correctionErrorRates;
+    testConfig.faultRates = faultRates;
+    testConfig.faultSpec = faultSpec;
+}
+
+bool BenchmarkOptions::isSelected(
+        const RegisteredTest & test) const {
+    if (!families.empty() && std::find(families.begin(), families.end(), test.family) == families.end()) {
+        return false;
+    }
+    if (!isas.empty() && std::find(isas.begin(), isas.end(), test.isa) == isas.end()) {
+        return false;
+    }
+    if (!datawidths.empty() && std::find(datawidths.begin(), datawidths.end(), test.datawidth) == datawidths.end()) {
+        return false;
+    }
+    if (!filters.empty() && std::none_of(filters.begin(), filters.end(), [&test] (const std::string & filter) {
+        return matchesPattern(filter, test.name);
+    })) {
+        return false;
+    }
+    return true;
+}
+
+bool BenchmarkOptions::isSweep() const {
+    return sweepMin != 0;
+}
+
+size_t BenchmarkOptions::getIterations(
+        size_t numValues,
+        size_t numIterations) const {
+    if (!isSweep()) {
+        return numIterations;
+    }
+    return std::max<size_t>(1, static_cast<size_t>(static_cast<double>(numIterations) * sweepMin / numValues));
+}
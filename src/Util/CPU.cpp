@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <initializer_list>
 
 #include <Util/CPU.hpp>
 
@@ -128,6 +129,7 @@ CPU::CPU()
           SSE4a(false),
           AES(false),
           SHA(false),
+          PCLMULQDQ(false),
           AVX(false),
           XOP(false),
           FMA3(false),
@@ -141,7 +143,8 @@ CPU::CPU()
           AVX512_BW(false),
           AVX512_DQ(false),
           AVX512_IFMA(false),
-          AVX512_VBMI(false) {
+          AVX512_VBMI(false),
+          VPCLMULQDQ(false) {
     // Reset all the flags;
     std::memset(this, 0, sizeof(*this));
 
@@ -217,6 +220,7 @@ CPU::CPU()
         SSE41 = (info[2] & ((int) 1 << 19)) != 0;
         SSE42 = (info[2] & ((int) 1 << 20)) != 0;
         AES = (info[2] & ((int) 1 << 25)) != 0;
+        PCLMULQDQ = (info[2] & ((int) 1 << 1)) != 0;
 
         AVX = (info[2] & ((int) 1 << 28)) != 0;
         FMA3 = (info[2] & ((int) 1 << 12)) != 0;
@@ -245,6 +249,7 @@ CPU::CPU()
         AVX512_DQ = (info[1] & ((int) 1 << 17)) != 0;
         AVX512_IFMA = (info[1] & ((int) 1 << 21)) != 0;
         AVX512_VBMI = (info[2] & ((int) 1 << 1)) != 0;
+        VPCLMULQDQ = (info[2] & ((int) 1 << 10)) != 0;
     }
 
     if (nExIds >= 0x80000001) {
@@ -257,3 +262,28 @@ CPU::CPU()
         XOP = (info[2] & ((int) 1 << 11)) != 0;
     }
 }
+
+bool CPU::Supports(
+        ISA isa) const {
+    switch (isa) {
+        case ISA::Scalar:
+            return true;
+        case ISA::SSE42:
+            return SSE42 && OS_X64;
+        case ISA::AVX2:
+            return AVX2 && OS_X64 && OS_AVX;
+        case ISA::AVX512:
+            // the 8- and 16-bit kernels need BW, the 64-bit ones DQ, and Hamming compares 128-bit lanes into a mask (VL)
+            return AVX512_F && AVX512_BW && AVX512_DQ && AVX512_VL && OS_X64 && OS_AVX512;
+    }
+    return false;
+}
+
+CPU::ISA CPU::WidestISA() const {
+    for (auto isa : {ISA::AVX512, ISA::AVX2, ISA::SSE42}) {
+        if (Supports(isa)) {
+            return isa;
+        }
+    }
+    return ISA::Scalar;
+}
@@ -0,0 +1,347 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+#include <Util/Export.hpp>
+#include <Util/CPU.hpp>
+
+#ifndef BUILD_TYPE
+#define BUILD_TYPE ""
+#endif
+#ifndef BUILD_FLAGS
+#define BUILD_FLAGS ""
+#endif
+
+RunMetadata RunMetadata::Collect() {
+    RunMetadata meta;
+#ifdef _WIN32
+    meta.hostname = "unknown";
+    meta.kernel = "Windows";
+#else
+    char hostname[256] = {0};
+    if (gethostname(hostname, sizeof(hostname) - 1) == 0) {
+        meta.hostname = hostname;
+    }
+    utsname uts;
+    if (uname(&uts) == 0) {
+        meta.kernel = std::string(uts.sysname) + ' ' + uts.release + ' ' + uts.version;
+    }
+#endif
+#if defined(__clang__)
+    meta.compiler = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    meta.compiler = std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    meta.compiler = "msvc " + std::to_string(_MSC_FULL_VER);
+#endif
+    meta.buildType = BUILD_TYPE;
+    meta.buildFlags = BUILD_FLAGS;
+#ifdef RUNTIME_DISPATCH
+    meta.buildFlags += " -DRUNTIME_DISPATCH";
+#endif
+#ifdef __SSE4_2__
+    meta.targetISA += " SSE4.2";
+#endif
+#ifdef __AVX2__
+    meta.targetISA += " AVX2";
+#endif
+#ifdef __AVX512F__
+    meta.targetISA += " AVX512F";
+#endif
+#ifdef __AVX512BW__
+    meta.targetISA += " AVX512BW";
+#endif
+    if (!meta.targetISA.empty()) {
+        meta.targetISA.erase(0, 1);
+    }
+    auto & cpu = CPU::Instance();
+    switch (cpu.WidestISA()) {
+        case CPU::ISA::AVX512:
+            meta.widestISA = "AVX512";
+            break;
+        case CPU::ISA::AVX2:
+            meta.widestISA = "AVX2";
+            break;
+        case CPU::ISA::SSE42:
+            meta.widestISA = "SSE4.2";
+            break;
+        default:
+            meta.widestISA = "Scalar";
+    }
+    const std::pair<const char *, bool> features[] = { {"MMX", cpu.MMX}, {"x64", cpu.x64}, {"ABM", cpu.ABM}, {"RDRAND", cpu.RDRAND}, {"BMI1", cpu.BMI1}, {"BMI2", cpu.BMI2}, {
+            "ADX", cpu.ADX}, {"PREFETCHWT1", cpu.PREFETCHWT1}, {"MPX", cpu.MPX}, {"SSE", cpu.SSE}, {"SSE2", cpu.SSE2}, {"SSE3", cpu.SSE3}, {"SSSE3", cpu.SSSE3},
+            {"SSE41", cpu.SSE41}, {"SSE42", cpu.SSE42}, {"SSE4a", cpu.SSE4a}, {"AES", cpu.AES}, {"SHA", cpu.SHA}, {"PCLMULQDQ", cpu.PCLMULQDQ}, {"AVX", cpu.AVX},
+            {"XOP", cpu.XOP}, {"FMA3", cpu.FMA3}, {"FMA4", cpu.FMA4}, {"AVX2", cpu.AVX2}, {"AVX512_F", cpu.AVX512_F}, {"AVX512_PF", cpu.AVX512_PF}, {"AVX512_ER",
+                    cpu.AVX512_ER}, {"AVX512_CD", cpu.AVX512_CD}, {"AVX512_VL", cpu.AVX512_VL}, {"AVX512_BW", cpu.AVX512_BW}, {"AVX512_DQ", cpu.AVX512_DQ}, {
+                    "AVX512_IFMA", cpu.AVX512_IFMA}, {"AVX512_VBMI", cpu.AVX512_VBMI}, {"VPCLMULQDQ", cpu.VPCLMULQDQ}};
+    for (auto & feature : features) {
+        if (feature.second) {
+            meta.cpuFeatures.push_back(feature.first);
+        }
+    }
+    return meta;
+}
+
+static std::string escapeJSON(
+        const std::string & str) {
+    std::stringstream ss;
+    ss << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                ss << "\\\"";
+                break;
+            case '\\':
+                ss << "\\\\";
+                break;
+            case '\n':
+                ss << "\\n";
+                break;
+            case '\t':
+                ss << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                } else {
+                    ss << c;
+                }
+        }
+    }
+    ss << '"';
+    return ss.str();
+}
+
+static std::string escapeCSV(
+        const std::string & str) {
+    if (str.find_first_of(",\"\n") == std::string::npos) {
+        return str;
+    }
+    std::string result("\"");
+    for (char c : str) {
+        if (c == '"') {
+            result += '"';
+        }
+        result += c;
+    }
+    return result + '"';
+}
+
+/**
+ * Calls func(testInfos, phaseName, testInfo) for every executed sub test.
+ */
+template<typename Func>
+static void forEachRecord(
+        const std::vector<std::vector<TestInfos>> & results,
+        Func func) {
+    for (auto & v : results) {
+        for (auto & tis : v) {
+            for (auto & phase : TestInfosPhases) {
+                auto & ti = tis.*(phase.second);
+                if (ti.isExecuted) {
+                    func(tis, phase.first, ti);
+                }
+            }
+        }
+    }
+}
+
+void exportJSON(
+        std::ostream & out,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results) {
+    const auto meta = RunMetadata::Collect();
+    out << std::setprecision(10);
+    out << "{\n  \"metadata\": {\n";
+    out << "    \"hostname\": " << escapeJSON(meta.hostname) << ",\n";
+    out << "    \"kernel\": " << escapeJSON(meta.kernel) << ",\n";
+    out << "    \"compiler\": " << escapeJSON(meta.compiler) << ",\n";
+    out << "    \"buildType\": " << escapeJSON(meta.buildType) << ",\n";
+    out << "    \"buildFlags\": " << escapeJSON(meta.buildFlags) << ",\n";
+    out << "    \"targetISA\": " << escapeJSON(meta.targetISA) << ",\n";
+    out << "    \"widestISA\": " << escapeJSON(meta.widestISA) << ",\n";
+    out << "    \"cpuFeatures\": [";
+    for (size_t i = 0; i < meta.cpuFeatures.size(); ++i) {
+        out << (i ? ", " : "") << escapeJSON(meta.cpuFeatures[i]);
+    }
+    out << "],\n";
+    out << "    \"numValues\": " << testConfig.numValues << ",\n";
+    out << "    \"numIterations\": " << testConfig.numIterations << ",\n";
+    out << "    \"numRepetitions\": " << testConfig.numRepetitions << ",\n";
+    out << "    \"rejectOutliers\": " << (testConfig.rejectOutliers ? "true" : "false") << ",\n";
+    out << "    \"pipeline\": [";
+    for (size_t i = 0; i < testConfig.pipeline.size(); ++i) {
+        out << (i ? ", " : "") << escapeJSON(getPipelineStageName(testConfig.pipeline[i]));
+    }
+    out << "],\n";
+    out << "    \"pipelineChunkBytes\": " << testConfig.pipelineChunkBytes << ",\n";
+    out << "    \"correctionErrorRates\": [";
+    for (size_t i = 0; i < testConfig.correctionErrorRates.size(); ++i) {
+        out << (i ? ", " : "") << testConfig.correctionErrorRates[i];
+    }
+    out << "],\n";
+    out << "    \"faultRates\": [";
+    for (size_t i = 0; i < testConfig.faultRates.size(); ++i) {
+        out << (i ? ", " : "") << testConfig.faultRates[i];
+    }
+    out << "],\n";
+    out << "    \"faultModel\": " << escapeJSON(getFaultModelName(testConfig.faultSpec.model)) << ",\n";
+    out << "    \"faultBits\": " << testConfig.faultSpec.numBits << ",\n";
+    out << "    \"faultDistribution\": " << escapeJSON(getFaultDistributionName(testConfig.faultSpec.distribution)) << ",\n";
+    out << "    \"faultSeed\": " << testConfig.faultSpec.seed << "\n";
+    out << "  },\n  \"results\": [";
+    bool isFirst = true;
+    forEachRecord(results, [&out,&isFirst,&testConfig] (const TestInfos & tis, const char * phase, const TestInfo & ti) {
+        out << (isFirst ? "\n" : ",\n") << "    {\"name\": " << escapeJSON(tis.name) << ", \"simd\": " << escapeJSON(tis.simd) << ", \"datawidth\": " << (tis.datawidth * 8) << ", \"blockSize\": " << tis.blockSize
+                << ", \"subtest\": " << escapeJSON(phase);
+        if (tis.A) {
+            out << ", \"A\": " << tis.A.value() << ", \"AInv\": " << tis.AInv.value();
+        }
+        out << ", \"numValues\": " << testConfig.numValues << ", \"numIterations\": " << testConfig.numIterations;
+        if (ti.error.empty()) {
+            out << ", \"repetitions\": " << ti.numRepetitions << ", \"outliers\": " << ti.numOutliers << ", \"nanos\": " << ti.nanos << ", \"min\": " << ti.nanosMin << ", \"median\": " << ti.nanosMedian
+                    << ", \"p90\": " << ti.nanosP90 << ", \"p99\": " << ti.nanosP99 << ", \"mean\": " << ti.nanosMean << ", \"stddev\": " << ti.nanosStddev;
+            if (!ti.countersPerValue.empty()) {
+                out << ", \"countersPerValue\": {";
+                for (size_t i = 0; i < ti.countersPerValue.size(); ++i) {
+                    out << (i ? ", " : "") << escapeJSON(ti.countersPerValue[i].first) << ": " << ti.countersPerValue[i].second;
+                }
+                out << "}, \"ipc\": " << ti.ipc;
+            }
+        } else {
+            out << ", \"error\": " << escapeJSON(ti.error);
+        }
+        out << '}';
+        isFirst = false;
+    });
+    out << "\n  ],\n  \"corrections\": [";
+    isFirst = true;
+    for (auto & v : results) {
+        for (auto & tis : v) {
+            for (auto & info : tis.corrections) {
+                out << (isFirst ? "\n" : ",\n") << "    {\"name\": " << escapeJSON(tis.name) << ", \"simd\": " << escapeJSON(tis.simd) << ", \"datawidth\": " << (tis.datawidth * 8) << ", \"blockSize\": "
+                        << tis.blockSize << ", \"errorRate\": " << info.errorRate << ", \"faults\": " << info.numFaults << ", \"corrected\": " << info.numCorrected << ", \"uncorrectable\": "
+                        << info.numUncorrectable;
+                for (auto & sub : { std::make_pair("correct", &info.correct), std::make_pair("decodeCorrected", &info.decodeCorrected)}) {
+                    if (!sub.second->isExecuted) {
+                        continue;
+                    }
+                    out << ", " << escapeJSON(sub.first) << ": ";
+                    if (sub.second->error.empty()) {
+                        out << sub.second->nanos;
+                    } else {
+                        out << "{\"error\": " << escapeJSON(sub.second->error) << '}';
+                    }
+                }
+                out << '}';
+                isFirst = false;
+            }
+        }
+    }
+    out << "\n  ],\n  \"faults\": [";
+    isFirst = true;
+    for (auto & v : results) {
+        for (auto & tis : v) {
+            for (auto & info : tis.faults) {
+                out << (isFirst ? "\n" : ",\n") << "    {\"name\": " << escapeJSON(tis.name) << ", \"simd\": " << escapeJSON(tis.simd) << ", \"datawidth\": " << (tis.datawidth * 8) << ", \"blockSize\": "
+                        << tis.blockSize << ", \"faultRate\": " << info.faultRate << ", \"faults\": " << info.numFaults << ", \"bitsChanged\": " << info.numBitsChanged << ", \"chunks\": "
+                        << info.numChunks << ", \"detected\": " << info.numDetected;
+                for (auto & count : { std::make_pair("silent", &info.numSilent), std::make_pair("corruptValues", &info.numCorruptValues), std::make_pair("correctedValues",
+                        &info.numCorrectedValues), std::make_pair("flaggedValues", &info.numFlaggedValues), std::make_pair("missedValues", &info.numMissedValues)}) {
+                    if (*count.second) {
+                        out << ", " << escapeJSON(count.first) << ": " << count.second->value();
+                    }
+                }
+                for (auto & sub : { std::make_pair("check", &info.check), std::make_pair("scrub", &info.scrub)}) {
+                    if (!sub.second->isExecuted) {
+                        continue;
+                    }
+                    out << ", " << escapeJSON(sub.first) << ": ";
+                    if (sub.second->error.empty()) {
+                        out << sub.second->nanos;
+                    } else {
+                        out << "{\"error\": " << escapeJSON(sub.second->error) << '}';
+                    }
+                }
+                out << '}';
+                isFirst = false;
+            }
+        }
+    }
+    out << "\n  ]\n}\n";
+}
+
+void exportCSV(
+        std::ostream & out,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results) {
+    const auto meta = RunMetadata::Collect();
+    std::string features;
+    for (auto & feature : meta.cpuFeatures) {
+        features += (features.empty() ? "" : " ") + feature;
+    }
+    const std::string metaColumns = escapeCSV(meta.hostname) + ',' + escapeCSV(meta.kernel) + ',' + escapeCSV(meta.compiler) + ',' + escapeCSV(meta.buildType) + ',' + escapeCSV(meta.buildFlags) + ','
+            + escapeCSV(meta.targetISA) + ',' + escapeCSV(meta.widestISA) + ',' + escapeCSV(features);
+    out << std::setprecision(10);
+    out << "hostname,kernel,compiler,buildType,buildFlags,targetISA,widestISA,cpuFeatures,name,simd,datawidth,blockSize,subtest,A,AInv,numValues,numIterations,repetitions,outliers,nanos,min,median,p90,p99,mean,stddev,ipc,error\n";
+    forEachRecord(results, [&out,&metaColumns,&testConfig] (const TestInfos & tis, const char * phase, const TestInfo & ti) {
+        out << metaColumns << ',' << escapeCSV(tis.name) << ',' << escapeCSV(tis.simd) << ',' << (tis.datawidth * 8) << ',' << tis.blockSize << ',' << phase << ',';
+        if (tis.A) {
+            out << tis.A.value() << ',' << tis.AInv.value();
+        } else {
+            out << ',';
+        }
+        out << ',' << testConfig.numValues << ',' << testConfig.numIterations << ',';
+        if (ti.error.empty()) {
+            out << ti.numRepetitions << ',' << ti.numOutliers << ',' << ti.nanos << ',' << ti.nanosMin << ',' << ti.nanosMedian << ',' << ti.nanosP90 << ',' << ti.nanosP99 << ',' << ti.nanosMean << ','
+                    << ti.nanosStddev << ',';
+            if (!ti.countersPerValue.empty()) {
+                out << ti.ipc;
+            }
+            out << ",\n";
+        } else {
+            out << ",,,,,,,,,," << escapeCSV(ti.error) << '\n';
+        }
+    });
+}
+
+void exportResults(
+        const std::string & fileJSON,
+        const std::string & fileCSV,
+        const TestConfiguration & testConfig,
+        const std::vector<std::vector<TestInfos>> & results) {
+    if (!fileJSON.empty()) {
+        std::ofstream out(fileJSON);
+        if (!out) {
+            throw std::runtime_error("Could not open " + fileJSON + " for writing");
+        }
+        exportJSON(out, testConfig, results);
+    }
+    if (!fileCSV.empty()) {
+        std::ofstream out(fileCSV);
+        if (!out) {
+            throw std::runtime_error("Could not open " + fileCSV + " for writing");
+        }
+        exportCSV(out, testConfig, results);
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <numeric>
+#include <random>
+
+#include <Util/FaultInjector.hpp>
+
+const char * getFaultModelName(
+        FaultModel model) {
+    switch (model) {
+        case FaultModel::MultiBit:
+            return "multi";
+        case FaultModel::Burst:
+            return "burst";
+        case FaultModel::StuckAt0:
+            return "stuck0";
+        case FaultModel::StuckAt1:
+            return "stuck1";
+        case FaultModel::SingleBit:
+        default:
+            return "single";
+    }
+}
+
+const char * getFaultDistributionName(
+        FaultDistribution distribution) {
+    switch (distribution) {
+        case FaultDistribution::Clustered:
+            return "clustered";
+        case FaultDistribution::Uniform:
+        default:
+            return "uniform";
+    }
+}
+
+FaultSpec::FaultSpec()
+        : model(FaultModel::SingleBit),
+          numBits(1),
+          distribution(FaultDistribution::Uniform),
+          seed(0x5EC) {
+}
+
+FaultInjector::FaultInjector(
+        const FaultSpec & spec)
+        : spec(spec) {
+}
+
+size_t FaultInjector::inject(
+        AlignedBlock & block,
+        size_t numBytes,
+        size_t numFaults) const {
+    if (numBytes == 0) {
+        return 0;
+    }
+    const size_t numBits = numBytes * CHAR_BIT;
+    auto bytes = block.template begin<uint8_t>();
+    auto change = [bytes] (size_t bit, uint8_t value) {
+        const uint8_t mask = static_cast<uint8_t>(1u << (bit % CHAR_BIT));
+        const uint8_t before = bytes[bit / CHAR_BIT];
+        bytes[bit / CHAR_BIT] = (value ? (before | mask) : (before & ~mask));
+        return static_cast<size_t>(bytes[bit / CHAR_BIT] != before);
+    };
+    auto flip = [bytes] (size_t bit) {
+        bytes[bit / CHAR_BIT] ^= static_cast<uint8_t>(1u << (bit % CHAR_BIT));
+        return size_t(1);
+    };
+    std::mt19937_64 engine(spec.seed);
+    std::uniform_int_distribution<size_t> distBit(0, numBits - 1);
+    const size_t clusterBits = std::min(numBits, CLUSTER_BYTES * CHAR_BIT);
+    std::uniform_int_distribution<size_t> distClusterBit(0, clusterBits - 1);
+    std::uniform_int_distribution<size_t> distCluster(0, (numBits - clusterBits) / CHAR_BIT);
+    size_t clusterBegin = 0;
+    std::array<size_t, 64> wordBits;
+    size_t numChanged = 0;
+    for (size_t fault = 0; fault < numFaults; ++fault) {
+        size_t bit;
+        if (spec.distribution == FaultDistribution::Clustered) {
+            if ((fault % CLUSTER_NUM_FAULTS) == 0) {
+                clusterBegin = distCluster(engine) * CHAR_BIT;
+            }
+            bit = clusterBegin + distClusterBit(engine);
+        } else {
+            bit = distBit(engine);
+        }
+        switch (spec.model) {
+            case FaultModel::MultiBit: {
+                // distinct bits of the word, i.e. the first ones of a partial shuffle
+                const size_t word = bit - (bit % wordBits.size());
+                const size_t numWordBits = std::min(wordBits.size(), numBits - word);
+                std::iota(wordBits.begin(), wordBits.begin() + numWordBits, word);
+                const size_t numFlips = std::min(std::max(spec.numBits, size_t(1)), numWordBits);
+                for (size_t i = 0; i < numFlips; ++i) {
+                    std::swap(wordBits[i], wordBits[std::uniform_int_distribution<size_t>(i, numWordBits - 1)(engine)]);
+                    numChanged += flip(wordBits[i]);
+                }
+                break;
+            }
+            case FaultModel::Burst:
+                for (size_t b = bit; b < std::min(bit + std::max(spec.numBits, size_t(1)), numBits); ++b) {
+                    numChanged += flip(b);
+                }
+                break;
+            case FaultModel::StuckAt0:
+                numChanged += change(bit, 0);
+                break;
+            case FaultModel::StuckAt1:
+                numChanged += change(bit, 1);
+                break;
+            case FaultModel::SingleBit:
+            default:
+                numChanged += flip(bit);
+        }
+    }
+    return numChanged;
+}
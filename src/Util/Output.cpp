@@ -19,6 +19,10 @@
  * Created on 06-07-2017 18:34
  */
 
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
 #include <Util/Output.hpp>
 
 void printUsage(
@@ -50,6 +54,8 @@ void printResults(
     std::string simd = results[0][0].simd;
     bool isEnc = results[0][0].encode.isExecuted;
     bool isChk = results[0][0].check.isExecuted;
+    bool isFil = results[0][0].filter.isExecuted;
+    bool isFilChk = results[0][0].filterChecked.isExecuted;
     bool isAdd = results[0][0].add.isExecuted;
     bool isSub = results[0][0].sub.isExecuted;
     bool isMul = results[0][0].mul.isExecuted;
@@ -71,6 +77,8 @@ void printResults(
     bool isDecChk = results[0][0].decodeChecked.isExecuted;
     size_t numEnc = isEnc;
     size_t numChk = isChk;
+    size_t numFil = isFil;
+    size_t numFilChk = isFilChk;
     size_t numAdd = isAdd;
     size_t numSub = isSub;
     size_t numMul = isMul;
@@ -96,6 +104,10 @@ void printResults(
         numEnc += ti.encode.isExecuted;
         isChk |= ti.check.isExecuted;
         numChk += ti.check.isExecuted;
+        isFil |= ti.filter.isExecuted;
+        numFil += ti.filter.isExecuted;
+        isFilChk |= ti.filterChecked.isExecuted;
+        numFilChk += ti.filterChecked.isExecuted;
         isAdd |= ti.add.isExecuted;
         isSub |= ti.sub.isExecuted;
         isMul |= ti.mul.isExecuted;
@@ -147,6 +159,8 @@ void printResults(
     };
     headlineWriter(isEnc, "enc");
     headlineWriter(isChk, "chk");
+    headlineWriter(isFil, "fil");
+    headlineWriter(isFilChk, "filC");
     headlineWriter(isAdd, "add");
     headlineWriter(isSub, "sub");
     headlineWriter(isMul, "mul");
@@ -174,7 +188,9 @@ void printResults(
     size_t id = 1;
     size_t datawidth = 0;
     size_t incChk = isEnc ? numResults : 0;
-    size_t incAdd = incChk + (isAdd ? numResults : 0);
+    size_t incFil = incChk + (isFil ? numResults : 0);
+    size_t incFilChk = incFil + (isFilChk ? numResults : 0);
+    size_t incAdd = incFilChk + (isAdd ? numResults : 0);
     size_t incSub = incAdd + (isSub ? numResults : 0);
     size_t incMul = incSub + (isMul ? numResults : 0);
     size_t incDiv = incMul + (isDiv ? numResults : 0);
@@ -214,6 +230,8 @@ void printResults(
         std::cout << "#   ";
         idWriter(isEnc, ti.encode.isExecuted, id);
         idWriter(isChk, ti.check.isExecuted, id, incChk);
+        idWriter(isFil, ti.filter.isExecuted, id, incFil);
+        idWriter(isFilChk, ti.filterChecked.isExecuted, id, incFilChk);
         idWriter(isAdd, ti.add.isExecuted, id, incAdd);
         idWriter(isSub, ti.sub.isExecuted, id, incSub);
         idWriter(isMul, ti.mul.isExecuted, id, incMul);
@@ -259,6 +277,22 @@ void printResults(
         }
         i = 0;
     }
+    if (isFil) {
+        for (auto & v : results) {
+            auto & ti = v[0];
+            std::cout << ',' << (((i == 0) && outputConfig.doRenameFirst) ? "scan" : ti.name) << ((((i == 0) && outputConfig.doRenameFirst) || !outputConfig.doAppendTestMethod) ? "" : " filter");
+            ++i;
+        }
+        i = 0;
+    }
+    if (isFilChk) {
+        for (auto & v : results) {
+            auto & ti = v[0];
+            std::cout << ',' << (((i == 0) && outputConfig.doRenameFirst) ? "scan" : ti.name) << ((((i == 0) && outputConfig.doRenameFirst) || !outputConfig.doAppendTestMethod) ? "" : " filterChk");
+            ++i;
+        }
+        i = 0;
+    }
     if (isAdd) {
         for (auto & v : results) {
             auto & ti = v[0];
@@ -425,8 +459,11 @@ void printResults(
     if (doRelative) {
         std::cout << std::fixed << std::setprecision(4);
     }
-    for (size_t pos = 0, blocksize = 1; pos < maxPos; ++pos, blocksize *= 2) {
-        std::cout << blocksize;
+    auto & longest = *std::max_element(results.begin(), results.end(), [] (const std::vector<TestInfos> & a, const std::vector<TestInfos> & b) {
+        return a.size() < b.size();
+    });
+    for (size_t pos = 0; pos < maxPos; ++pos) {
+        std::cout << longest[pos].blockSize;
         if (outputConfig.doPrintCountNumbersColumn) {
             std::cout << ',' << (testConfig.numIterations * testConfig.numValues);
         }
@@ -464,6 +501,40 @@ void printResults(
                 }
             }
         }
+        if (isFil) {
+            for (auto & v : results) {
+                std::cout << ',';
+                if (pos < v.size() && v[pos].filter.isExecuted && v[pos].filter.error.empty()) {
+                    auto & x = v[pos];
+                    if (doRelative) {
+                        if (x.reference) {
+                            std::cout << (static_cast<double>(v[pos].filter.nanos) / x.reference->filter.nanos);
+                        } else {
+                            std::cout << 1.0L;
+                        }
+                    } else {
+                        std::cout << v[pos].filter.nanos;
+                    }
+                }
+            }
+        }
+        if (isFilChk) {
+            for (auto & v : results) {
+                std::cout << ',';
+                if (pos < v.size() && v[pos].filterChecked.isExecuted && v[pos].filterChecked.error.empty()) {
+                    auto & x = v[pos];
+                    if (doRelative) {
+                        if (x.reference) {
+                            std::cout << (static_cast<double>(v[pos].filterChecked.nanos) / x.reference->filterChecked.nanos);
+                        } else {
+                            std::cout << 1.0L;
+                        }
+                    } else {
+                        std::cout << v[pos].filterChecked.nanos;
+                    }
+                }
+            }
+        }
         if (isAdd) {
             for (auto & v : results) {
                 std::cout << ',';
@@ -800,3 +871,298 @@ template void printResults<false>(
         TestConfiguration testConfig,
         std::vector<std::vector<TestInfos>> & results,
         OutputConfiguration config);
+
+/**
+ * Prints results as a CSV table: the comment line "# <title>" and the header "name,simd,datawidth,unroll/block,<columns>",
+ * followed by the rows printRows(tis, beginRow) prints for each test. Each row starts with beginRow(), which prints the
+ * columns identifying the test and returns the stream for the remaining ones. The title and the header come right before
+ * the first row, so that a table without rows is left out; isAny tells whether they were printed already.
+ */
+template<typename PrintRows>
+static void printTable(
+        const std::string & title,
+        const char * const columns,
+        const int precision,
+        const std::vector<std::vector<TestInfos>> & results,
+        PrintRows && printRows,
+        bool & isAny) {
+    std::cout << std::fixed << std::setprecision(precision);
+    for (auto & v : results) {
+        for (auto & tis : v) {
+            printRows(tis, [&title,columns,&isAny,&tis] () -> std::ostream & {
+                if (!isAny) {
+                    std::cout << "\n\n# " << title << "\nname,simd,datawidth,unroll/block," << columns << '\n';
+                    isAny = true;
+                }
+                return std::cout << tis.name << ',' << tis.simd << ',' << (tis.datawidth * 8) << ',' << tis.blockSize << ',';
+            });
+        }
+    }
+    std::cout << std::defaultfloat << std::flush;
+}
+
+template<typename PrintRows>
+static void printTable(
+        const std::string & title,
+        const char * const columns,
+        const int precision,
+        const std::vector<std::vector<TestInfos>> & results,
+        PrintRows && printRows) {
+    bool isAny = false;
+    printTable(title, columns, precision, results, std::forward<PrintRows>(printRows), isAny);
+}
+
+static bool isTimed(
+        const TestInfo & ti) {
+    return ti.isExecuted && ti.error.empty();
+}
+
+void printStatistics(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    if (testConfig.numRepetitions <= 1) {
+        return;
+    }
+    const std::string title = "timing statistics in nanoseconds over " + std::to_string(testConfig.numRepetitions) + " repetitions"
+            + (testConfig.rejectOutliers ? ", outliers rejected" : "");
+    printTable(title, "subtest,repetitions,outliers,min,median,p90,p99,mean,stddev", 1, results, [] (const TestInfos & tis, auto && beginRow) {
+        for (auto & phase : TestInfosPhases) {
+            auto & ti = tis.*(phase.second);
+            if (isTimed(ti)) {
+                beginRow() << phase.first << ',' << ti.numRepetitions << ',' << ti.numOutliers << ',' << ti.nanosMin << ',' << ti.nanosMedian << ',' << ti.nanosP90 << ','
+                        << ti.nanosP99 << ',' << ti.nanosMean << ',' << ti.nanosStddev << '\n';
+            }
+        }
+    });
+}
+
+void printCounters(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    if (!testConfig.enablePerfCounters) {
+        return;
+    }
+    printTable("hardware performance counters per value", "subtest,counter,value", 4, results, [] (const TestInfos & tis, auto && beginRow) {
+        for (auto & phase : TestInfosPhases) {
+            auto & ti = tis.*(phase.second);
+            if (isTimed(ti) && !ti.countersPerValue.empty()) {
+                for (auto & counter : ti.countersPerValue) {
+                    beginRow() << phase.first << ',' << counter.first << ',' << counter.second << '\n';
+                }
+                if (ti.ipc != 0) {
+                    beginRow() << phase.first << ",IPC," << ti.ipc << '\n';
+                }
+            }
+        }
+    });
+}
+
+void printPipeline(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    if (testConfig.pipeline.empty()) {
+        return;
+    }
+    std::ostringstream title;
+    title << "pipeline";
+    for (auto stage : testConfig.pipeline) {
+        title << ' ' << getPipelineStageName(stage);
+    }
+    title << ", fused over chunks of " << testConfig.pipelineChunkBytes << " encoded bytes vs. phase at a time, nanoseconds per value";
+    const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    printTable(title.str(), "phased,fused,speedup", 4, results, [numValues] (const TestInfos & tis, auto && beginRow) {
+        auto & phased = tis.pipelinePhased;
+        auto & fused = tis.pipelineFused;
+        if (!phased.isExecuted || !fused.isExecuted) {
+            return;
+        }
+        auto & out = beginRow();
+        if (!phased.error.empty() || !fused.error.empty()) {
+            out << ",,\n";
+            return;
+        }
+        out << (phased.nanos / numValues) << ',' << (fused.nanos / numValues) << ',';
+        if (fused.nanos > 0) {
+            out << (static_cast<double>(phased.nanos) / fused.nanos);
+        }
+        out << '\n';
+    });
+}
+
+void printCorrection(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    if (testConfig.correctionErrorRates.empty()) {
+        return;
+    }
+    const double numValuesCorrect = static_cast<double>(testConfig.numValues);
+    const double numValuesDecode = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    printTable("single-error correction at injected faults per value, correct is a single pass, nanoseconds per value", "errorRate,faults,corrected,uncorrectable,correct,decodeCorrected", 4,
+            results, [numValuesCorrect,numValuesDecode] (const TestInfos & tis, auto && beginRow) {
+                for (auto & info : tis.corrections) {
+                    auto & out = beginRow();
+                    out << std::defaultfloat << info.errorRate << ',' << info.numFaults << ',' << info.numCorrected << ',' << info.numUncorrectable << ',' << std::fixed;
+                    if (isTimed(info.correct)) {
+                        out << (info.correct.nanos / numValuesCorrect);
+                    }
+                    out << ',';
+                    if (isTimed(info.decodeCorrected)) {
+                        out << (info.decodeCorrected.nanos / numValuesDecode);
+                    }
+                    out << '\n';
+                }
+            });
+}
+
+void printScrub(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    printTable("check, stopping at the first error, and scrub, collecting all errors, nanoseconds per value", "check,scrub,scrub/check", 4, results,
+            [numValues] (const TestInfos & tis, auto && beginRow) {
+                if (isTimed(tis.check) && isTimed(tis.scrub)) {
+                    beginRow() << (tis.check.nanos / numValues) << ',' << (tis.scrub.nanos / numValues) << ',' << (static_cast<double>(tis.scrub.nanos) / tis.check.nanos) << '\n';
+                }
+            });
+}
+
+void printDecodeView(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    printTable("decode + consume, reading a decoded copy vs. the encoded data in place (view), nanoseconds per value", "decoded,view,speedup,decodedChk,viewChk,speedupChk", 4, results,
+            [numValues] (const TestInfos & tis, auto && beginRow) {
+                if (!tis.consumeView.isExecuted) {
+                    return;
+                }
+                auto & out = beginRow();
+                const char * separator = "";
+                for (auto pair : { std::make_pair(&tis.consumeDecoded, &tis.consumeView), std::make_pair(&tis.consumeDecodedChecked, &tis.consumeViewChecked)}) {
+                    auto & decoded = *pair.first;
+                    auto & view = *pair.second;
+                    out << separator;
+                    if (isTimed(decoded)) {
+                        out << (decoded.nanos / numValues);
+                    }
+                    out << ',';
+                    if (isTimed(view)) {
+                        out << (view.nanos / numValues);
+                    }
+                    out << ',';
+                    if (isTimed(decoded) && isTimed(view) && view.nanos > 0) {
+                        out << (static_cast<double>(decoded.nanos) / view.nanos);
+                    }
+                    separator = ",";
+                }
+                out << '\n';
+            });
+}
+
+void printBitwise(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    printTable("bitwise arithmetic, nanoseconds per value", "and,or,xor,not,shl,shr,andChk,orChk,xorChk,notChk,shlChk,shrChk", 4, results,
+            [numValues] (const TestInfos & tis, auto && beginRow) {
+                const std::array<const TestInfo *, 12> infos = { {&tis.bitAnd, &tis.bitOr, &tis.bitXor, &tis.bitNot, &tis.shiftLeft, &tis.shiftRight, &tis.bitAndChecked,
+                        &tis.bitOrChecked, &tis.bitXorChecked, &tis.bitNotChecked, &tis.shiftLeftChecked, &tis.shiftRightChecked}};
+                if (std::none_of(infos.begin(), infos.end(), [] (const TestInfo * ti) {return ti->isExecuted;})) {
+                    return;
+                }
+                auto & out = beginRow();
+                const char * separator = "";
+                for (auto ti : infos) {
+                    out << separator;
+                    if (isTimed(*ti)) {
+                        out << (ti->nanos / numValues);
+                    }
+                    separator = ",";
+                }
+                out << '\n';
+            });
+}
+
+void printFaults(
+        TestConfiguration testConfig,
+        std::vector<std::vector<TestInfos>> & results) {
+    if (testConfig.faultRates.empty()) {
+        return;
+    }
+    std::ostringstream title;
+    title << "check under " << getFaultModelName(testConfig.faultSpec.model);
+    if (testConfig.faultSpec.model == FaultModel::MultiBit || testConfig.faultSpec.model == FaultModel::Burst) {
+        title << ':' << testConfig.faultSpec.numBits;
+    }
+    title << " faults (" << getFaultDistributionName(testConfig.faultSpec.distribution) << ", seed " << testConfig.faultSpec.seed << ") per value, in chunks of "
+            << testConfig.pipelineChunkBytes << " bytes, nanoseconds per value";
+    const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+    auto printOptional = [] (std::ostream & out, const std::optional<size_t> & value) {
+        if (value) {
+            out << value.value();
+        }
+        out << ',';
+    };
+    auto printTime = [numValues] (std::ostream & out, const TestInfo & ti) {
+        if (isTimed(ti)) {
+            out << (ti.nanos / numValues);
+        }
+    };
+    printTable(title.str(),
+            "faultRate,faults,bitsChanged,chunks,detected,silent,detectionRate,corruptValues,correctedValues,correctionRate,flaggedValues,missedValues,check,scrub,checkClean", 4,
+            results, [&printOptional,&printTime] (const TestInfos & tis, auto && beginRow) {
+                for (auto & info : tis.faults) {
+                    auto & out = beginRow();
+                    out << std::defaultfloat << info.faultRate << ',' << info.numFaults << ',' << info.numBitsChanged << ',' << info.numChunks << ',' << info.numDetected << ',';
+                    printOptional(out, info.numSilent);
+                    out << std::fixed;
+                    if (info.numSilent && (info.numDetected + info.numSilent.value())) {
+                        out << (static_cast<double>(info.numDetected) / (info.numDetected + info.numSilent.value())); // of the chunks with errors
+                    }
+                    out << ',';
+                    printOptional(out, info.numCorruptValues);
+                    printOptional(out, info.numCorrectedValues);
+                    if (info.numCorrectedValues && info.numCorruptValues.value()) {
+                        out << (static_cast<double>(info.numCorrectedValues.value()) / info.numCorruptValues.value());
+                    }
+                    out << ',';
+                    printOptional(out, info.numFlaggedValues);
+                    printOptional(out, info.numMissedValues);
+                    printTime(out, info.check);
+                    out << ',';
+                    printTime(out, info.scrub);
+                    out << ',';
+                    printTime(out, tis.check);
+                    out << '\n';
+                }
+            });
+}
+
+void printThroughput(
+        const std::vector<std::pair<TestConfiguration, std::vector<std::vector<TestInfos>>>> & runs) {
+    const double tscGHz = Stopwatch::TSCGHz();
+    std::ostringstream title;
+    title << "throughput per number of values, bytes of unencoded data, cycles from the cycles counter or else the TSC at " << std::setprecision(3) << tscGHz << " GHz";
+    bool isAny = false;
+    for (auto & run : runs) {
+        auto & testConfig = run.first;
+        const double numValues = static_cast<double>(testConfig.numIterations) * testConfig.numValues;
+        printTable(title.str(), "subtest,numValues,bytes,iterations,values/ns,bytes/cycle", 4, run.second, [&testConfig,numValues,tscGHz] (const TestInfos & tis, auto && beginRow) {
+            for (auto & phase : TestInfosPhases) {
+                auto & ti = tis.*(phase.second);
+                if (!isTimed(ti) || ti.nanos <= 0) {
+                    continue;
+                }
+                auto cycles = std::find_if(ti.countersPerValue.begin(), ti.countersPerValue.end(), [] (const std::pair<std::string, double> & counter) {
+                    return counter.first == "cycles";
+                });
+                const double numCycles = (cycles != ti.countersPerValue.end()) ? (cycles->second * numValues) : (ti.nanos * tscGHz);
+                auto & out = beginRow();
+                out << phase.first << ',' << testConfig.numValues << ',' << (testConfig.numValues * tis.datawidth) << ',' << testConfig.numIterations << ',' << (numValues / ti.nanos) << ',';
+                if (numCycles > 0) {
+                    out << (numValues * tis.datawidth / numCycles);
+                }
+                out << '\n';
+            }
+        }, isAny);
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <set>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <Util/PerfCounters.hpp>
+
+#ifdef __linux__
+
+std::vector<PerfEvent> PerfEvent::Defaults() {
+    return { {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES}, {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS}, {"L1D_misses", PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)}, {"LLC_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}, {
+            "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+}
+
+PerfEvent PerfEvent::Raw(
+        const std::string & name,
+        uint64_t config) {
+    return {name, PERF_TYPE_RAW, config};
+}
+
+PerfCounters::PerfCounters(
+        const std::vector<PerfEvent> & events)
+        : counters() {
+    // cycles leads the group when it is counted at all, so open it first
+    std::vector<PerfEvent> ordered(events);
+    std::stable_partition(ordered.begin(), ordered.end(), [] (const PerfEvent & event) {
+        return event.type == PERF_TYPE_HARDWARE && event.config == PERF_COUNT_HW_CPU_CYCLES;
+    });
+    for (auto & event : ordered) {
+        const int groupFd = counters.empty() ? -1 : counters.front().fd;
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = event.type;
+        attr.config = event.config;
+        attr.disabled = groupFd == -1; // the members follow their leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+        if (fd < 0) {
+            static std::set<std::string> reported; // tell only once per event, not for every test
+            if (reported.insert(event.name).second) {
+                std::cerr << "# perf_event_open(" << event.name << "): " << std::strerror(errno) << ", skipping this counter" << std::endl;
+            }
+            continue;
+        }
+        counters.push_back(Counter {event, fd, 0});
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    // close the members before their leader
+    for (auto counter = counters.rbegin(); counter != counters.rend(); ++counter) {
+        close(counter->fd);
+    }
+}
+
+void PerfCounters::Start() {
+    if (counters.empty()) {
+        return;
+    }
+    ioctl(counters.front().fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(counters.front().fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfCounters::Stop() {
+    if (counters.empty()) {
+        return;
+    }
+    ioctl(counters.front().fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    std::vector<uint64_t> data(3 + counters.size()); // number of events, time enabled, time running, values in group order
+    const ssize_t numBytes = static_cast<ssize_t>(data.size() * sizeof(uint64_t));
+    if (read(counters.front().fd, data.data(), data.size() * sizeof(uint64_t)) == numBytes && data[0] == counters.size() && data[2] != 0) {
+        for (size_t i = 0; i < counters.size(); ++i) {
+            const uint64_t value = data[3 + i];
+            counters[i].value += (data[2] == data[1]) ? value : static_cast<uint64_t>(static_cast<double>(value) * data[1] / data[2]);
+        }
+    }
+}
+
+#else
+
+std::vector<PerfEvent> PerfEvent::Defaults() {
+    return {};
+}
+
+PerfEvent PerfEvent::Raw(
+        const std::string & name,
+        uint64_t config) {
+    return {name, 0, config};
+}
+
+PerfCounters::PerfCounters(
+        const std::vector<PerfEvent> & events)
+        : counters() {
+    std::cerr << "# hardware performance counters are only supported on Linux" << std::endl;
+}
+
+PerfCounters::~PerfCounters() {
+}
+
+void PerfCounters::Start() {
+}
+
+void PerfCounters::Stop() {
+}
+
+#endif
+
+bool PerfCounters::IsAvailable() const {
+    return !counters.empty();
+}
+
+void PerfCounters::Clear() {
+    for (auto & counter : counters) {
+        counter.value = 0;
+    }
+}
+
+std::vector<std::pair<std::string, uint64_t>> PerfCounters::Values() const {
+    std::vector<std::pair<std::string, uint64_t>> values;
+    for (auto & counter : counters) {
+        values.emplace_back(counter.event.name, counter.value);
+    }
+    return values;
+}
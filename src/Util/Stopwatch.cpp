@@ -12,6 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #include <Util/Stopwatch.hpp>
 
 Stopwatch::Stopwatch()
@@ -26,3 +32,19 @@ int64_t Stopwatch::Current() {
     auto end = Clock::now();
     return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 }
+
+double Stopwatch::TSCGHz() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_MSC_VER)
+    static const double ghz = [] {
+        Stopwatch sw;
+        const uint64_t tscStart = __rdtsc();
+        int64_t nanos;
+        while ((nanos = sw.Current()) < 50000000) { // 50 ms
+        }
+        return static_cast<double>(__rdtsc() - tscStart) / nanos;
+    }();
+    return ghz;
+#else
+    return 0;
+#endif
+}
@@ -12,10 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <climits>
 #include <iostream>
 #include <functional>
 #include <cstddef>
+#include <numeric>
+#include <memory>
+#include <optional>
+#include <random>
+#include <cmath>
 
 #ifdef OMP
 #include <omp.h>
@@ -25,6 +33,7 @@
 #include <Util/CPU.hpp>
 #include <Util/ErrorInfo.hpp>
 #include <Util/Stopwatch.hpp>
+#include <Util/PerfCounters.hpp>
 
 Randomizer Randomizer::instance;
 
@@ -146,11 +155,11 @@ TestBase::TestBase(
           datawidth(datawidth),
           name(name),
           bufRaw(bufRaw),
-          bufScratchPad(bufResult.nBytes, bufResult.alignment),
+          bufScratchPad(bufResult.nBytes, bufResult.alignment, bufResult.policy),
           bufEncoded(bufEncoded),
           bufResult(bufResult),
-          bufArith(bufResult.nBytes, bufResult.alignment),
-          bufDecoded(bufResult.nBytes, bufResult.alignment) {
+          bufArith(bufResult.nBytes, bufResult.alignment, bufResult.policy),
+          bufDecoded(bufResult.nBytes, bufResult.alignment, bufResult.policy) {
 }
 
 TestBase::TestBase(
@@ -188,6 +197,15 @@ void TestBase::RunCheck(
         const CheckConfiguration & config) {
 }
 
+// Scrub
+bool TestBase::DoScrub() {
+    return false;
+}
+
+void TestBase::RunScrub(
+        const ScrubConfiguration & config) {
+}
+
 // Filter
 bool TestBase::DoFilter() {
     return false;
@@ -264,6 +282,102 @@ void TestBase::RunDecode(
         const DecodeConfiguration & config) {
 }
 
+// Decode as view
+bool TestBase::DoDecodeView() {
+    return false;
+}
+
+DecodeView TestBase::RunDecodeView(
+        const DecodeConfiguration & config) {
+    return DecodeView();
+}
+
+size_t TestBase::RunConsumeChecked(
+        const DecodeConfiguration & config) {
+    this->RunCheck(CheckConfiguration(config, config.source, config.source)); // RunCheck checks the target
+    return this->RunConsume(this->RunDecodeView(config));
+}
+
+// Single-Error Correction
+bool TestBase::DoCorrect() {
+    return false;
+}
+
+void TestBase::RunCorrect(
+        const CorrectConfiguration & config) {
+}
+
+void TestBase::RunDecodeCorrected(
+        const CorrectConfiguration & config) {
+}
+
+// Partitioning
+static const constexpr size_t CACHELINE_SIZE = 64;
+
+size_t TestBase::getEncodedBlockNumValues() {
+    return 1;
+}
+
+size_t TestBase::getEncodedBlockSize() {
+    return getEncodedDataTypeSize();
+}
+
+SubTestPartition TestBase::GetPartition(
+        const SubTestConfiguration & config,
+        BufferLayout layoutSource,
+        BufferLayout layoutTarget,
+        size_t partitionId,
+        size_t numPartitions) {
+    const size_t rawSize = getRawDataTypeSize();
+    const size_t blockNumValues = getEncodedBlockNumValues();
+    const size_t blockSize = getEncodedBlockSize();
+    // smallest number of values which ends on a cache line boundary in the given layout, and the smallest number which may be split off at all
+    auto granularity = [rawSize,blockNumValues,blockSize] (BufferLayout layout) {
+        switch (layout) {
+            case BufferLayout::Raw:
+                return std::make_pair(CACHELINE_SIZE / std::gcd(CACHELINE_SIZE, rawSize), size_t(1));
+            case BufferLayout::Encoded:
+                return std::make_pair(blockNumValues * (CACHELINE_SIZE / std::gcd(CACHELINE_SIZE, blockSize)), blockNumValues);
+            case BufferLayout::Bitmap:
+            default:
+                return std::make_pair(CACHELINE_SIZE * CHAR_BIT, size_t(CHAR_BIT));
+        }
+    };
+    const auto granularitySource = granularity(layoutSource);
+    const auto granularityTarget = granularity(layoutTarget);
+    size_t unit = std::lcm(granularitySource.first, granularityTarget.first);
+    if ((unit * numPartitions) > config.numValues) {
+        unit = std::lcm(granularitySource.second, granularityTarget.second); // too few values -- at least never split an encoded block or a bitmap byte
+    }
+    const size_t numUnits = config.numValues / unit;
+    const size_t begin = ((numUnits * partitionId) / numPartitions) * unit;
+    const size_t end = ((partitionId + 1) == numPartitions) ? config.numValues : (((numUnits * (partitionId + 1)) / numPartitions) * unit);
+    const size_t offsetSource = GetByteOffset(layoutSource, begin);
+    const size_t offsetTarget = GetByteOffset(layoutTarget, begin);
+    return SubTestPartition(begin, end - begin, AlignedBlock(config.source, offsetSource, config.source.nBytes - offsetSource),
+            AlignedBlock(config.target, offsetTarget, config.target.nBytes - offsetTarget));
+}
+
+size_t TestBase::GetByteOffset(
+        BufferLayout layout,
+        size_t numValues) {
+    switch (layout) {
+        case BufferLayout::Raw:
+            return numValues * getRawDataTypeSize();
+        case BufferLayout::Encoded:
+            return (numValues / getEncodedBlockNumValues()) * getEncodedBlockSize();
+        case BufferLayout::Bitmap:
+        default:
+            return numValues / CHAR_BIT;
+    }
+}
+
+size_t TestBase::GetEncodedNumBytes(
+        size_t numValues) {
+    const size_t blockNumValues = getEncodedBlockNumValues();
+    return ((numValues + blockNumValues - 1) / blockNumValues) * getEncodedBlockSize();
+}
+
 ScalarTest::~ScalarTest() {
 }
 
@@ -292,13 +406,12 @@ SSE42Test::getSIMDtypeName() {
 }
 
 bool SSE42Test::HasCapabilities() {
-    auto& cpu = CPU::Instance();
-    return cpu.SSE42 && cpu.OS_X64;
+    return CPU::Instance().Supports(CPU::ISA::SSE42);
 }
 
 #endif /* __SSE4_2__ */
 
-#ifdef __AVX2__
+#if defined(__AVX2__) or defined(RUNTIME_DISPATCH)
 
 template
 struct SIMDTestBase<__m256i > ;
@@ -313,13 +426,12 @@ AVX2Test::getSIMDtypeName() {
 }
 
 bool AVX2Test::HasCapabilities() {
-    auto& cpu = CPU::Instance();
-    return cpu.AVX2 && cpu.OS_X64 && cpu.OS_AVX;
+    return CPU::Instance().Supports(CPU::ISA::AVX2);
 }
 
-#endif /* __AVX2__ */
+#endif /* defined(__AVX2__) or defined(RUNTIME_DISPATCH) */
 
-#ifdef __AVX512F__
+#if defined(__AVX512F__) or defined(RUNTIME_DISPATCH)
 
 template
 struct SIMDTestBase<__m512i > ;
@@ -334,11 +446,10 @@ AVX512Test::getSIMDtypeName() {
 }
 
 bool AVX512Test::HasCapabilities() {
-    auto& cpu = CPU::Instance();
-    return (cpu.AVX512_BW | cpu.AVX512_CD | cpu.AVX512_DQ | cpu.AVX512_ER | cpu.AVX512_F | cpu.AVX512_IFMA | cpu.AVX512_PF | cpu.AVX512_VBMI | cpu.AVX512_VL) && cpu.OS_X64 && cpu.OS_AVX512;
+    return CPU::Instance().Supports(CPU::ISA::AVX512);
 }
 
-#endif /* __AVX512F__ */
+#endif /* defined(__AVX512F__) or defined(RUNTIME_DISPATCH) */
 
 template<typename Conf, typename Func, size_t max = std::variant_size_v<typename Conf::Mode>, size_t num = 1>
 struct ConfigurationModeExecutor {
@@ -361,33 +472,115 @@ struct ConfigurationModeExecutor<Conf, Func, max, max> {
     }
 };
 
+/**
+ * Calls runFunc(partitionId, numPartitions) once per thread. When compiled with OpenMP, an ErrorInfo thrown by any of
+ * the threads is rethrown after the parallel region, since exceptions must not leave it.
+ */
+template<typename RunFunc>
+void InternalRun(
+        RunFunc runFunc) {
+#ifdef OMP
+    std::optional<ErrorInfo> error;
+#ifdef OMPNUMTHREADS
+#pragma omp parallel num_threads(OMPNUMTHREADS)
+#else
+#pragma omp parallel
+#endif
+    {
+        try {
+            runFunc(static_cast<size_t>(omp_get_thread_num()), static_cast<size_t>(omp_get_num_threads()));
+        } catch (ErrorInfo & ei) {
+#pragma omp critical
+            {
+                if (!error) {
+                    error.emplace(ei);
+                }
+            }
+        }
+    }
+    if (error) {
+        throw error.value();
+    }
+#else
+    runFunc(0, 1);
+#endif
+}
+
+/**
+ * Runs func(partConfig, partSource, partTarget) on this thread's partition of config, from which func builds the
+ * partitioned configuration.
+ * Value indices in thrown ErrorInfos are translated back to indices into the whole configuration.
+ */
+template<typename Conf, typename Func>
+void InternalRunPartition(
+        TestBase & test,
+        const Conf & config,
+        BufferLayout layoutSource,
+        BufferLayout layoutTarget,
+        size_t partitionId,
+        size_t numPartitions,
+        Func func) {
+    auto partition = test.GetPartition(config, layoutSource, layoutTarget, partitionId, numPartitions);
+    if (partition.numValues == 0) {
+        return;
+    }
+    try {
+        func(BasicTestConfiguration(config.numIterations, partition.numValues), partition.source, partition.target);
+    } catch (ErrorInfo & ei) {
+        if (ei.i && ei.i.value() != static_cast<size_t>(-1)) {
+            ei.i = ei.i.value() + partition.offset;
+        }
+        throw;
+    }
+}
+
+/**
+ * Times config.numRepetitions runs of runFunc, each one preceded by preFunc. The result is verified by postFunc only
+ * once, after the last repetition. If counters is given, the hardware performance counters are read around each run.
+ */
+template<typename PreFunc, typename RunFunc>
+TimingSamples InternalRepeat(
+        const TestConfiguration & config,
+        Stopwatch & sw,
+        PerfCounters * counters,
+        PreFunc preFunc,
+        RunFunc runFunc) {
+    const size_t numRepetitions = std::max(config.numRepetitions, size_t(1));
+    TimingSamples samples {std::vector<int64_t>(), config.rejectOutliers, {}, numRepetitions * config.numIterations * config.numValues};
+    samples.nanos.reserve(numRepetitions);
+    if (counters) {
+        counters->Clear();
+    }
+    for (size_t repetition = 0; repetition < numRepetitions; ++repetition) {
+        preFunc();
+        if (counters) {
+            counters->Start();
+        }
+        sw.Reset();
+        InternalRun(runFunc);
+        samples.nanos.push_back(sw.Current());
+        if (counters) {
+            counters->Stop();
+        }
+    }
+    if (counters) {
+        samples.counters = counters->Values();
+    }
+    return samples;
+}
+
 template<typename PreFunc, typename RunFunc, typename PostFunc>
 void InternalExecute(
         TestBase & test,
+        const TestConfiguration & config,
         Stopwatch & sw,
+        PerfCounters * counters,
         TestInfo & ti,
         PreFunc preFunc,
         RunFunc runFunc,
         PostFunc postFunc) {
     try {
-        preFunc();
-        sw.Reset();
-#ifdef OMP
-#ifdef OMPNUMTHREADS
-#pragma omp parallel num_threads(OMPNUMTHREADS)
-        {
-            runFunc();
-        }
-#else
-#pragma omp parallel
-        {
-            runFunc();
-        }
-#endif
-#else
-        runFunc();
-#endif
-        ti.set(sw.Current());
+        ti.set(InternalRepeat(config, sw, counters, preFunc, runFunc));
         postFunc();
     } catch (ErrorInfo & ei) {
         auto msg = ei.what();
@@ -399,32 +592,16 @@ void InternalExecute(
 template<typename PreFunc, typename RunFunc, typename PostFunc, typename SetTimeInfoFunc, typename CatchErrorInfoFunc>
 void InternalExecuteMode(
         TestBase & test,
+        const TestConfiguration & config,
         Stopwatch & sw,
+        PerfCounters * counters,
         PreFunc preFunc,
         RunFunc runFunc,
         PostFunc postFunc,
         SetTimeInfoFunc setTimeInfoFunc,
         CatchErrorInfoFunc catchErrorInfoFunc) {
     try {
-        preFunc();
-        sw.Reset();
-#ifdef OMP
-#ifdef OMPNUMTHREADS
-#pragma omp parallel num_threads(OMPNUMTHREADS)
-        {
-            runFunc();
-        }
-#else
-#pragma omp parallel
-        {
-            runFunc();
-        }
-#endif
-#else
-        runFunc();
-#endif
-        auto nanos = sw.Current();
-        setTimeInfoFunc(nanos);
+        setTimeInfoFunc(InternalRepeat(config, sw, counters, preFunc, runFunc));
         postFunc();
     } catch (ErrorInfo & ei) {
         auto msg = ei.what();
@@ -476,6 +653,61 @@ static void compare(
     }
 }
 
+/**
+ * Whether a scrub flagged value i, see ScrubConfiguration.
+ */
+static inline bool isFlagged(
+        const AlignedBlock & bitmap,
+        size_t i) {
+    return (bitmap.template begin<uint8_t>()[i / CHAR_BIT] >> (i % CHAR_BIT)) & 1;
+}
+
+/**
+ * Index of the first value a scrub flagged, or numValues if there is none.
+ */
+static size_t findFlagged(
+        const AlignedBlock & bitmap,
+        size_t numValues) {
+    auto bytes = bitmap.template begin<uint8_t>();
+    const size_t numBytes = (numValues + CHAR_BIT - 1) / CHAR_BIT;
+    const size_t byte = static_cast<size_t>(std::find_if(bytes, bytes + numBytes, [] (uint8_t b) {
+        return b != 0;
+    }) - bytes);
+    size_t i = byte * CHAR_BIT;
+    while (i < numValues && !isFlagged(bitmap, i)) {
+        ++i;
+    }
+    return std::min(i, numValues);
+}
+
+/**
+ * One operator of the fused pipeline together with the buffers it reads and writes.
+ */
+struct PipelineStep {
+    PipelineStage stage;
+    AlignedBlock * source;
+    BufferLayout layoutSource;
+    AlignedBlock * target;
+    BufferLayout layoutTarget;
+};
+
+static ArithmeticConfiguration::Mode getPipelineArithmeticMode(
+        PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::Sub:
+        case PipelineStage::SubChk:
+            return ArithmeticConfiguration::Sub();
+        case PipelineStage::Mul:
+        case PipelineStage::MulChk:
+            return ArithmeticConfiguration::Mul();
+        case PipelineStage::Div:
+        case PipelineStage::DivChk:
+            return ArithmeticConfiguration::Div();
+        default:
+            return ArithmeticConfiguration::Add();
+    }
+}
+
 // Execute test:
 TestInfos TestBase::Execute(
         const TestConfiguration & configTest,
@@ -493,6 +725,7 @@ TestInfos TestBase::Execute(
 
     EncodeConfiguration encConf(configTest, bufRaw, bufEncoded); // encode from raw buffer to encoded buffer
     CheckConfiguration chkConf(configTest, bufRaw, bufEncoded); // check encoded buffer, with the possibility to also use the raw buffer (RUnCheck must actually check the TARGET buffer!)
+    ScrubConfiguration scrubConf(configTest, bufEncoded, bufResult);
     ArithmeticConfiguration arithConf(configTest, bufEncoded, bufResult, ArithmeticConfiguration::Mode(ArithmeticConfiguration::Add()), arithOperand);
     // Following: use an odd A. As the actual A is not important we can choose an arbitrary one here and simply cast it later to the desired width (i.e. select the appropriate LSBs).
     std::size_t newA = static_cast<size_t>(configDataGen.getUniformData()) | 0x1;
@@ -501,10 +734,35 @@ TestInfos TestBase::Execute(
 #endif
     ReencodeConfiguration reencConf(configTest, bufEncoded, bufResult, newA);
     DecodeConfiguration decConf(configTest, bufEncoded, bufResult);
+    // Filter: select the values within a random range [filterLo, filterHi] of the generated data, producing a bitmap with one bit per value
+    std::size_t filterLo = static_cast<size_t>(configDataGen.getUniformData());
+    std::size_t filterHi = static_cast<size_t>(configDataGen.getUniformData());
+    if (filterLo > filterHi) {
+        std::swap(filterLo, filterHi);
+    }
+    FilterConfiguration filterConf(configTest, bufEncoded, bufResult, FilterConfiguration::GE(), filterLo, FilterConfiguration::LE(), filterHi);
     AggregateConfiguration aggrConf(configTest, bufEncoded, bufResult, AggregateConfiguration::Mode(AggregateConfiguration::Sum()));
     Stopwatch sw;
+    std::unique_ptr<PerfCounters> counters;
+    if (configTest.enablePerfCounters) {
+#ifdef OMP
+        static bool warned = false;
+        if (!warned) {
+            std::cerr << "# hardware performance counters only count the calling thread and are thus disabled with OMP" << std::endl;
+            warned = true;
+        }
+#else
+        auto events = PerfEvent::Defaults();
+        events.insert(events.end(), configTest.perfEvents.begin(), configTest.perfEvents.end());
+        counters = std::make_unique<PerfCounters>(events);
+        if (!counters->IsAvailable()) {
+            counters.reset();
+        }
+#endif
+    }
 
-    TestInfo tiEnc, tiCheck, tiAdd, tiSub, tiMul, tiDiv, tiAddChk, tiSubChk, tiMulChk, tiDivChk, tiSum, tiMin, tiMax, tiAvg, tiSumChk, tiMinChk, tiMaxChk, tiAvgChk, tiReencChk, tiDec, tiDecChk;
+    TestInfo tiEnc, tiCheck, tiScrub, tiFilter, tiFilterChk, tiAdd, tiSub, tiMul, tiDiv, tiAddChk, tiSubChk, tiMulChk, tiDivChk, tiSum, tiMin, tiMax, tiAvg, tiSumChk, tiMinChk, tiMaxChk, tiAvgChk, tiReencChk, tiDec, tiDecChk;
+    TestInfo tiAnd, tiOr, tiXor, tiNot, tiShl, tiShr, tiAndChk, tiOrChk, tiXorChk, tiNotChk, tiShlChk, tiShrChk;
 
     TestConfiguration tcSingleIter(1, configTest.numValues); // we need to check the result buffer only once!
     TestConfiguration tcTwoValue(1, 2); // we need to check the result buffer only once and for the aggregates only a single value! We check 2 values, because sum and avg require larger ones. The test must respect this!
@@ -519,23 +777,194 @@ TestInfos TestBase::Execute(
             this->RunDecodeChecked(ccDec);
             compare(this->bufRaw, this->bufDecoded, this->bufRaw.nBytes);
         };
-        InternalExecute(*this, sw, tiEnc, [this,&encConf] {this->PreEncode(encConf);}, [this,&encConf] {this->RunEncode(encConf);}, postFunc);
+        InternalExecute(*this, configTest, sw, counters.get(), tiEnc, [this,&encConf] {this->PreEncode(encConf);}, [this,&encConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, encConf, BufferLayout::Raw, BufferLayout::Encoded, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunEncode(EncodeConfiguration(part, source, target));
+            });
+        }, postFunc);
+    }
+
+    std::vector<FaultInfo> faults;
+    if (!configTest.faultRates.empty() && this->DoCheck()) {
+        std::clog << ", faults" << std::flush;
+        // The faults go to a copy of the encoded data in bufScratchPad, which is checked in cache-sized chunks. The
+        // checks throw on their first error, so each iteration checks each chunk on its own: a detected fault only ends
+        // the current iteration over its own chunk, and the time still covers all iterations. The scrub checks the whole
+        // copy at once.
+        const size_t encodedBytes = std::min(GetEncodedNumBytes(configTest.numValues), bufScratchPad.nBytes);
+        const size_t chunkBytes = std::max(configTest.pipelineChunkBytes, size_t(1));
+        const size_t numChunks = std::max((encodedBytes + chunkBytes - 1) / chunkBytes, size_t(1));
+        const CheckConfiguration faultConf(configTest, bufRaw, bufScratchPad);
+        const ScrubConfiguration faultScrubConf(configTest, bufScratchPad, bufResult);
+        std::vector<std::pair<size_t, size_t>> chunks; // offset and number of values
+        chunks.reserve(numChunks);
+        for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+            auto partition = GetPartition(faultConf, BufferLayout::Raw, BufferLayout::Encoded, chunk, numChunks);
+            if (partition.numValues) {
+                chunks.emplace_back(partition.offset, partition.numValues);
+            }
+        }
+        const FaultInjector injector(configTest.faultSpec);
+        const size_t rawSize = getRawDataTypeSize();
+        // decodes the faulty copy and marks its wrong values
+        auto findCorrupt = [this,&tcSingleIter,&configTest,rawSize] (std::vector<uint8_t> & isCorrupt) {
+            this->RunDecode(DecodeConfiguration(tcSingleIter, bufScratchPad, bufDecoded));
+            auto raw = this->bufRaw.template begin<uint8_t>();
+            auto decoded = this->bufDecoded.template begin<uint8_t>();
+            isCorrupt.resize(configTest.numValues);
+            for (size_t i = 0; i < configTest.numValues; ++i) {
+                isCorrupt[i] = memcmp(raw + i * rawSize, decoded + i * rawSize, rawSize) != 0;
+            }
+        };
+        for (auto faultRate : configTest.faultRates) {
+            FaultInfo info(faultRate, static_cast<size_t>(std::llround(faultRate * configTest.numValues)), chunks.size());
+            std::vector<uint8_t> isDetected(chunks.size()); // each chunk is written by a single thread
+            std::vector<uint8_t> isCorrupt; // per value, unless the test cannot decode
+            auto preFunc = [this,encodedBytes,&injector,&info] {
+                memcpy(this->bufScratchPad.begin(), this->bufEncoded.begin(), encodedBytes);
+                info.numBitsChanged = injector.inject(this->bufScratchPad, encodedBytes, info.numFaults);
+            };
+            auto preCheck = [this,&preFunc,&faultConf,&isDetected] {
+                preFunc();
+                std::fill(isDetected.begin(), isDetected.end(), 0);
+                this->PreCheck(faultConf);
+            };
+            auto runCheck = [this,&configTest,&chunks,&isDetected] (size_t partitionId, size_t numPartitions) {
+                for (size_t c = partitionId; c < chunks.size(); c += numPartitions) {
+                    const size_t offsetRaw = GetByteOffset(BufferLayout::Raw, chunks[c].first);
+                    const size_t offsetEncoded = GetByteOffset(BufferLayout::Encoded, chunks[c].first);
+                    const AlignedBlock source(this->bufRaw, offsetRaw, this->bufRaw.nBytes - offsetRaw);
+                    const AlignedBlock target(this->bufScratchPad, offsetEncoded, this->bufScratchPad.nBytes - offsetEncoded);
+                    const CheckConfiguration chunkConf(BasicTestConfiguration(1, chunks[c].second), source, target);
+                    for (size_t iteration = 0; iteration < configTest.numIterations; ++iteration) {
+                        try {
+                            this->RunCheck(chunkConf);
+                        } catch (ErrorInfo &) {
+                            isDetected[c] = 1;
+                        }
+                    }
+                }
+            };
+            auto postCheck = [this,&tcSingleIter,&chunks,&info,&isDetected,&isCorrupt,&findCorrupt] {
+                info.numDetected = static_cast<size_t>(std::count(isDetected.begin(), isDetected.end(), 1));
+                if (this->DoDecode()) {
+                    findCorrupt(isCorrupt);
+                    size_t numSilent = 0;
+                    for (size_t c = 0; c < chunks.size(); ++c) {
+                        auto chunkBegin = isCorrupt.begin() + static_cast<ssize_t>(chunks[c].first);
+                        numSilent += !isDetected[c] && std::count(chunkBegin, chunkBegin + static_cast<ssize_t>(chunks[c].second), 1);
+                    }
+                    info.numSilent = numSilent;
+                    info.numCorruptValues = static_cast<size_t>(std::count(isCorrupt.begin(), isCorrupt.end(), 1));
+                    if (this->DoCorrect()) {
+                        CorrectionCounts correctionCounts;
+                        this->RunCorrect(CorrectConfiguration(tcSingleIter, bufRaw, bufScratchPad, correctionCounts));
+                        std::vector<uint8_t> isStillCorrupt;
+                        findCorrupt(isStillCorrupt);
+                        const size_t numStillCorrupt = static_cast<size_t>(std::count(isStillCorrupt.begin(), isStillCorrupt.end(), 1)); // miscorrections may even add some
+                        info.numCorrectedValues = info.numCorruptValues.value() - std::min(numStillCorrupt, info.numCorruptValues.value());
+                    }
+                }
+            };
+            InternalExecute(*this, configTest, sw, counters.get(), info.check, preCheck, runCheck, postCheck);
+            if (this->DoScrub()) {
+                auto runScrub = [this,&faultScrubConf] (size_t partitionId, size_t numPartitions) {
+                    InternalRunPartition(*this, faultScrubConf, BufferLayout::Encoded, BufferLayout::Bitmap, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                        this->RunScrub(ScrubConfiguration(part, source, target));
+                    });
+                };
+                auto postScrub = [this,&configTest,&info,&isCorrupt] {
+                    size_t numFlagged = 0, numMissed = 0;
+                    for (size_t i = 0; i < configTest.numValues; ++i) {
+                        const bool flagged = isFlagged(this->bufResult, i);
+                        numFlagged += flagged;
+                        numMissed += !isCorrupt.empty() && isCorrupt[i] && !flagged;
+                    }
+                    info.numFlaggedValues = numFlagged;
+                    if (!isCorrupt.empty()) {
+                        info.numMissedValues = numMissed;
+                    }
+                };
+                InternalExecute(*this, configTest, sw, counters.get(), info.scrub, preFunc, runScrub, postScrub);
+            }
+            faults.push_back(info);
+        }
     }
 
     if (configTest.enableCheck && this->DoCheck()) {
         std::clog << ", check" << std::flush;
-        InternalExecute(*this, sw, tiCheck, [this,&chkConf] {this->PreCheck(chkConf);}, [this,&chkConf] {this->RunCheck(chkConf);}, [this] {}); // no need to check again
+        InternalExecute(*this, configTest, sw, counters.get(), tiCheck, [this,&chkConf] {this->PreCheck(chkConf);}, [this,&chkConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, chkConf, BufferLayout::Raw, BufferLayout::Encoded, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunCheck(CheckConfiguration(part, source, target));
+            });
+        }, [this] {}); // no need to check again
+    }
+
+    if (configTest.enableScrub && this->DoScrub()) {
+        std::clog << ", scrub" << std::flush;
+        auto runFunc = [this,&scrubConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, scrubConf, BufferLayout::Encoded, BufferLayout::Bitmap, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunScrub(ScrubConfiguration(part, source, target));
+            });
+        };
+        auto postFunc = [this,&configTest] {
+            const size_t i = findFlagged(this->bufResult, configTest.numValues);
+            if (i < configTest.numValues) {
+                throw ErrorInfo(__FILE__, __LINE__, i, static_cast<size_t>(-1), "Test::RunScrub() flagged a value of the intact data");
+            }
+        };
+        InternalExecute(*this, configTest, sw, counters.get(), tiScrub, [] {}, runFunc, postFunc);
+    }
+
+    if (configTest.enableFilter && this->DoFilter()) {
+        std::clog << ", filter" << std::flush;
+        auto preFunc = [this,&filterConf] {
+            this->PreFilter(filterConf);
+        };
+        auto runFunc = [this,&filterConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, filterConf, BufferLayout::Encoded, BufferLayout::Bitmap, partitionId, numPartitions, [this,&filterConf] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunFilter(FilterConfiguration(part, source, target, filterConf.mode1, filterConf.predicate1, filterConf.mode2, filterConf.predicate2));
+            });
+        };
+        auto postFunc = [this,&configTest] {
+            if (!this->internalPreFilterCalled) {
+                throw ErrorInfo(__FILE__, __LINE__, static_cast<size_t>(-1), static_cast<size_t>(-1), "Test::PreFilter() was not called!");
+            }
+            compare(this->bufArith, this->bufResult, (configTest.numValues + CHAR_BIT - 1) / CHAR_BIT);
+        };
+        InternalExecute(*this, configTest, sw, counters.get(), tiFilter, preFunc, runFunc, postFunc);
+    }
+
+    if (configTest.enableFilterChk && this->DoFilterChecked()) {
+        std::clog << ", filter checked" << std::flush;
+        auto preFunc = [this,&filterConf] {
+            this->PreFilterChecked(filterConf);
+        };
+        auto runFunc = [this,&filterConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, filterConf, BufferLayout::Encoded, BufferLayout::Bitmap, partitionId, numPartitions, [this,&filterConf] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunFilterChecked(FilterConfiguration(part, source, target, filterConf.mode1, filterConf.predicate1, filterConf.mode2, filterConf.predicate2));
+            });
+        };
+        auto postFunc = [this,&configTest] {
+            if (!this->internalPreFilterCheckedCalled) {
+                throw ErrorInfo(__FILE__, __LINE__, static_cast<size_t>(-1), static_cast<size_t>(-1), "Test::PreFilterChecked() was not called!");
+            }
+            compare(this->bufArith, this->bufResult, (configTest.numValues + CHAR_BIT - 1) / CHAR_BIT);
+        };
+        InternalExecute(*this, configTest, sw, counters.get(), tiFilterChk, preFunc, runFunc, postFunc);
     }
 
     if (configTest.enableArithmetic) {
-        auto func = [this,&sw,&tiAdd,&tiSub,&tiMul,&tiDiv,&tcSingleIter] (ArithmeticConfiguration & conf) {
+        auto func = [this,&configTest,&sw,&counters,&tiAdd,&tiSub,&tiMul,&tiDiv,&tiAnd,&tiOr,&tiXor,&tiNot,&tiShl,&tiShr,&tcSingleIter] (ArithmeticConfiguration & conf) {
             if (DoArithmetic(conf)) {
                 std::clog << ", " << std::visit(ArithmeticConfigurationModeName(), conf.mode);
                 auto preFunc = [this,&conf] {
                     this->PreArithmetic(conf);
                 };
-                auto runFunc = [this,&conf] {
-                    this->RunArithmetic(conf);
+                auto runFunc = [this,&conf] (size_t partitionId, size_t numPartitions) {
+                    InternalRunPartition(*this, conf, BufferLayout::Encoded, BufferLayout::Encoded, partitionId, numPartitions, [this,&conf] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                        this->RunArithmetic(ArithmeticConfiguration(part, source, target, conf.mode, conf.operand));
+                    });
                 };
                 auto postFunc = [this,&tcSingleIter] {
                     if (!this->internalPreArithmeticCalled) {
@@ -545,27 +974,29 @@ TestInfos TestBase::Execute(
                     this->RunDecodeChecked(ccDec);
                     compare(this->bufArith, this->bufDecoded, this->bufArith.nBytes);
                 };
-                auto setFunc = [&conf,&tiAdd,&tiSub,&tiMul,&tiDiv] (int64_t nanos) {
-                    SetForMode<ArithmeticConfiguration, int64_t>::run(conf, nanos, { {&tiAdd,&tiSub,&tiMul,&tiDiv}});
+                auto setFunc = [&conf,&tiAdd,&tiSub,&tiMul,&tiDiv,&tiAnd,&tiOr,&tiXor,&tiNot,&tiShl,&tiShr] (const TimingSamples & samples) {
+                    SetForMode<ArithmeticConfiguration, const TimingSamples &>::run(conf, samples, { {&tiAdd,&tiSub,&tiMul,&tiDiv,&tiAnd,&tiOr,&tiXor,&tiNot,&tiShl,&tiShr}});
                 };
-                auto catchFunc = [&conf,&tiAdd,&tiSub,&tiMul,&tiDiv] (const char * msg) {
-                    SetForMode<ArithmeticConfiguration, const char *>::run(conf, msg, { {&tiAdd,&tiSub,&tiMul,&tiDiv}});
+                auto catchFunc = [&conf,&tiAdd,&tiSub,&tiMul,&tiDiv,&tiAnd,&tiOr,&tiXor,&tiNot,&tiShl,&tiShr] (const char * msg) {
+                    SetForMode<ArithmeticConfiguration, const char *>::run(conf, msg, { {&tiAdd,&tiSub,&tiMul,&tiDiv,&tiAnd,&tiOr,&tiXor,&tiNot,&tiShl,&tiShr}});
                 };
-                InternalExecuteMode(*this, sw, preFunc, runFunc, postFunc, setFunc, catchFunc);
+                InternalExecuteMode(*this, configTest, sw, counters.get(), preFunc, runFunc, postFunc, setFunc, catchFunc);
             };
         };
         ConfigurationModeExecutor<ArithmeticConfiguration, decltype(func)>::run(arithConf, func);
     }
 
     if (configTest.enableArithmeticChk) {
-        auto func = [this,&sw,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tcSingleIter] (ArithmeticConfiguration & conf) {
+        auto func = [this,&configTest,&sw,&counters,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tiAndChk,&tiOrChk,&tiXorChk,&tiNotChk,&tiShlChk,&tiShrChk,&tcSingleIter] (ArithmeticConfiguration & conf) {
             if (DoArithmeticChecked(conf)) {
                 std::clog << ", " << std::visit(ArithmeticConfigurationModeName(), conf.mode) << " checked";
                 auto preFunc = [this,&conf] {
                     this->PreArithmeticChecked(conf);
                 };
-                auto runFunc = [this,&conf] {
-                    this->RunArithmeticChecked(conf);
+                auto runFunc = [this,&conf] (size_t partitionId, size_t numPartitions) {
+                    InternalRunPartition(*this, conf, BufferLayout::Encoded, BufferLayout::Encoded, partitionId, numPartitions, [this,&conf] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                        this->RunArithmeticChecked(ArithmeticConfiguration(part, source, target, conf.mode, conf.operand));
+                    });
                 };
                 auto postFunc = [this,&tcSingleIter] {
                     if (!this->internalPreArithmeticCheckedCalled) {
@@ -575,27 +1006,29 @@ TestInfos TestBase::Execute(
                     this->RunDecodeChecked(ccDec);
                     compare(this->bufArith, this->bufDecoded, this->bufArith.nBytes);
                 };
-                auto setFunc = [&conf,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk] (int64_t nanos) {
-                    SetForMode<ArithmeticConfiguration, int64_t>::run(conf, nanos, { {&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk}});
+                auto setFunc = [&conf,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tiAndChk,&tiOrChk,&tiXorChk,&tiNotChk,&tiShlChk,&tiShrChk] (const TimingSamples & samples) {
+                    SetForMode<ArithmeticConfiguration, const TimingSamples &>::run(conf, samples, { {&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tiAndChk,&tiOrChk,&tiXorChk,&tiNotChk,&tiShlChk,&tiShrChk}});
                 };
-                auto catchFunc = [&conf,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk] (const char * msg) {
-                    SetForMode<ArithmeticConfiguration, const char *>::run(conf, msg, { {&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk}});
+                auto catchFunc = [&conf,&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tiAndChk,&tiOrChk,&tiXorChk,&tiNotChk,&tiShlChk,&tiShrChk] (const char * msg) {
+                    SetForMode<ArithmeticConfiguration, const char *>::run(conf, msg, { {&tiAddChk,&tiSubChk,&tiMulChk,&tiDivChk,&tiAndChk,&tiOrChk,&tiXorChk,&tiNotChk,&tiShlChk,&tiShrChk}});
                 };
-                InternalExecuteMode(*this, sw, preFunc, runFunc, postFunc, setFunc, catchFunc);
+                InternalExecuteMode(*this, configTest, sw, counters.get(), preFunc, runFunc, postFunc, setFunc, catchFunc);
             }
         };
         ConfigurationModeExecutor<ArithmeticConfiguration, decltype(func)>::run(arithConf, func);
     }
 
     if (configTest.enableAggregate) {
-        auto func = [this,&sw,&tiSum,&tiMin,&tiMax,&tiAvg,&tcTwoValue] (AggregateConfiguration & conf) {
+        auto func = [this,&configTest,&sw,&counters,&tiSum,&tiMin,&tiMax,&tiAvg,&tcTwoValue] (AggregateConfiguration & conf) {
             if (DoAggregate(conf)) {
                 std::clog << ", " << std::visit(AggregateConfigurationModeName(), conf.mode);
                 auto preFunc = [this,&conf] {
                     PreAggregate(conf);
                 };
-                auto runFunc = [this,&conf] {
-                    RunAggregate(conf);
+                auto runFunc = [this,&conf] (size_t partitionId, size_t numPartitions) {
+                    if (partitionId == 0) { // aggregates reduce into a single encoded value in bufScratchPad and bufResult and are thus not partitioned
+                        RunAggregate(conf);
+                    }
                 };
                 auto postFunc = [this,&tcTwoValue] {
                     if (!this->internalPreAggregateCalled) {
@@ -605,27 +1038,29 @@ TestInfos TestBase::Execute(
                     this->RunDecodeChecked(ccDec);
                     compare(this->bufArith, this->bufDecoded, 2 * this->getEncodedDataTypeSize());
                 };
-                auto setFunc = [&conf,&tiSum,&tiMin,&tiMax,&tiAvg] (int64_t nanos) {
-                    SetForMode<AggregateConfiguration, int64_t>::run(conf, nanos, { {&tiSum,&tiMin,&tiMax,&tiAvg}});
+                auto setFunc = [&conf,&tiSum,&tiMin,&tiMax,&tiAvg] (const TimingSamples & samples) {
+                    SetForMode<AggregateConfiguration, const TimingSamples &>::run(conf, samples, { {&tiSum,&tiMin,&tiMax,&tiAvg}});
                 };
                 auto catchFunc = [&conf,&tiSum,&tiMin,&tiMax,&tiAvg] (const char * msg) {
                     SetForMode<AggregateConfiguration, const char *>::run(conf, msg, { {&tiSum,&tiMin,&tiMax,&tiAvg}});
                 };
-                InternalExecuteMode(*this, sw, preFunc, runFunc, postFunc, setFunc, catchFunc);
+                InternalExecuteMode(*this, configTest, sw, counters.get(), preFunc, runFunc, postFunc, setFunc, catchFunc);
             }
         };
         ConfigurationModeExecutor<AggregateConfiguration, decltype(func)>::run(aggrConf, func);
     }
 
     if (configTest.enableAggregateChk) {
-        auto func = [this,&sw,&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk,&tcTwoValue] (AggregateConfiguration & conf) {
+        auto func = [this,&configTest,&sw,&counters,&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk,&tcTwoValue] (AggregateConfiguration & conf) {
             if (DoAggregateChecked(conf)) {
                 std::clog << ", " << std::visit(AggregateConfigurationModeName(), conf.mode) << " checked";
                 auto preFunc = [this,&conf] {
                     PreAggregateChecked(conf);
                 };
-                auto runFunc = [this,&conf] {
-                    RunAggregateChecked(conf);
+                auto runFunc = [this,&conf] (size_t partitionId, size_t numPartitions) {
+                    if (partitionId == 0) { // see RunAggregate above
+                        RunAggregateChecked(conf);
+                    }
                 };
                 auto postFunc = [this,&tcTwoValue] {
                     if (!this->internalPreAggregateCheckedCalled) {
@@ -635,13 +1070,13 @@ TestInfos TestBase::Execute(
                     this->RunDecodeChecked(ccDec);
                     compare(this->bufArith, this->bufDecoded, 2 * this->getEncodedDataTypeSize());
                 };
-                auto setFunc = [&conf,&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk] (int64_t nanos) {
-                    SetForMode<AggregateConfiguration, int64_t>::run(conf, nanos, { {&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk}});
+                auto setFunc = [&conf,&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk] (const TimingSamples & samples) {
+                    SetForMode<AggregateConfiguration, const TimingSamples &>::run(conf, samples, { {&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk}});
                 };
                 auto catchFunc = [&conf,&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk] (const char * msg) {
                     SetForMode<AggregateConfiguration, const char *>::run(conf, msg, { {&tiSumChk,&tiMinChk,&tiMaxChk,&tiAvgChk}});
                 };
-                InternalExecuteMode(*this, sw, preFunc, runFunc, postFunc, setFunc, catchFunc);
+                InternalExecuteMode(*this, configTest, sw, counters.get(), preFunc, runFunc, postFunc, setFunc, catchFunc);
             }
         };
         ConfigurationModeExecutor<AggregateConfiguration, decltype(func)>::run(aggrConf, func);
@@ -652,8 +1087,10 @@ TestInfos TestBase::Execute(
         auto preFunc = [this,&reencConf] {
             this->PreReencodeChecked(reencConf);
         };
-        auto runFunc = [this,&reencConf] {
-            this->RunReencodeChecked(reencConf);
+        auto runFunc = [this,&reencConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, reencConf, BufferLayout::Encoded, BufferLayout::Encoded, partitionId, numPartitions, [this,&reencConf] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunReencodeChecked(ReencodeConfiguration(part, source, target, reencConf.newA));
+            });
         };
         auto postFunc = [this,&configTest] {
             if (!this->internalPreReencodeCheckedCalled) {
@@ -663,7 +1100,7 @@ TestInfos TestBase::Execute(
             this->RunDecodeChecked(ccDec);
             compare(this->bufRaw, this->bufDecoded, configTest.numValues);
         };
-        InternalExecute(*this, sw, tiReencChk, preFunc, runFunc, postFunc);
+        InternalExecute(*this, configTest, sw, counters.get(), tiReencChk, preFunc, runFunc, postFunc);
     }
 
     if (configTest.enableDecode && this->DoDecode()) {
@@ -671,8 +1108,10 @@ TestInfos TestBase::Execute(
         auto preFunc = [this,&decConf] {
             this->PreDecode(decConf);
         };
-        auto runFunc = [this,&decConf] {
-            this->RunDecode(decConf);
+        auto runFunc = [this,&decConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, decConf, BufferLayout::Encoded, BufferLayout::Raw, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunDecode(DecodeConfiguration(part, source, target));
+            });
         };
         auto postFunc = [this,&configTest] {
             if (!this->internalPreDecodeCalled) {
@@ -680,7 +1119,7 @@ TestInfos TestBase::Execute(
             }
             compare(this->bufRaw, this->bufResult, configTest.numValues);
         };
-        InternalExecute(*this, sw, tiDec, preFunc, runFunc, postFunc);
+        InternalExecute(*this, configTest, sw, counters.get(), tiDec, preFunc, runFunc, postFunc);
     }
 
     if (configTest.enableDecodeChk) {
@@ -688,8 +1127,10 @@ TestInfos TestBase::Execute(
         auto preFunc = [this,&decConf] {
             this->PreDecodeChecked(decConf);
         };
-        auto runFunc = [this,&decConf] {
-            this->RunDecodeChecked(decConf);
+        auto runFunc = [this,&decConf] (size_t partitionId, size_t numPartitions) {
+            InternalRunPartition(*this, decConf, BufferLayout::Encoded, BufferLayout::Raw, partitionId, numPartitions, [this] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                this->RunDecodeChecked(DecodeConfiguration(part, source, target));
+            });
         };
         auto postFunc = [this,&configTest] {
             if (!this->internalPreDecodeCheckedCalled) {
@@ -697,9 +1138,283 @@ TestInfos TestBase::Execute(
             }
             compare(this->bufRaw, this->bufResult, configTest.numValues);
         };
-        InternalExecute(*this, sw, tiDecChk, preFunc, runFunc, postFunc);
+        InternalExecute(*this, configTest, sw, counters.get(), tiDecChk, preFunc, runFunc, postFunc);
+    }
+
+    TestInfo tiConsDec, tiConsView, tiConsDecChk, tiConsViewChk;
+    if (configTest.enableDecodeView && this->DoDecodeView()) {
+        // decode + consume, where the consumer reads the decoded values either from a copy in bufResult or in place
+        std::clog << ", decode view" << std::flush;
+        const size_t consumedRaw = this->RunConsume(DecodeView(bufRaw.begin(), configTest.numValues, getRawDataTypeSize()));
+        std::atomic<size_t> consumed(0);
+        auto preFunc = [&consumed] {
+            consumed = 0;
+        };
+        auto runConsume = [this,&configTest,&decConf,&consumed] (bool isView, bool isChecked) {
+            return [this,&configTest,&decConf,&consumed,isView,isChecked] (size_t partitionId, size_t numPartitions) {
+                InternalRunPartition(*this, decConf, BufferLayout::Encoded, BufferLayout::Raw, partitionId, numPartitions, [this,&configTest,&consumed,isView,isChecked] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                    const DecodeConfiguration partDec(BasicTestConfiguration(1, part.numValues), source, target);
+                    size_t sum = 0;
+                    for (size_t iteration = 0; iteration < configTest.numIterations; ++iteration) {
+                        if (isView) {
+                            sum += isChecked ? this->RunConsumeChecked(partDec) : this->RunConsume(this->RunDecodeView(partDec));
+                        } else {
+                            if (isChecked) {
+                                this->RunDecodeChecked(partDec);
+                            } else {
+                                this->RunDecode(partDec);
+                            }
+                            sum += this->RunConsume(DecodeView(target.begin(), part.numValues, getRawDataTypeSize()));
+                        }
+                    }
+                    consumed += sum;
+                });
+            };
+        };
+        auto postFunc = [&configTest,&consumed,consumedRaw] {
+            if (consumed != (consumedRaw * configTest.numIterations)) {
+                throw ErrorInfo(__FILE__, __LINE__, static_cast<size_t>(-1), static_cast<size_t>(-1), "the consumed values differ from the raw data");
+            }
+        };
+        if (configTest.enableDecode && this->DoDecode()) {
+            InternalExecute(*this, configTest, sw, counters.get(), tiConsDec, preFunc, runConsume(false, false), postFunc);
+        }
+        InternalExecute(*this, configTest, sw, counters.get(), tiConsView, preFunc, runConsume(true, false), postFunc);
+        if (configTest.enableDecodeChk) {
+            InternalExecute(*this, configTest, sw, counters.get(), tiConsDecChk, preFunc, runConsume(false, true), postFunc);
+            InternalExecute(*this, configTest, sw, counters.get(), tiConsViewChk, preFunc, runConsume(true, true), postFunc);
+        }
+    }
+
+    std::vector<CorrectionInfo> corrections;
+    if (!configTest.correctionErrorRates.empty() && this->DoCorrect()) {
+        std::clog << ", correct" << std::flush;
+        // The faults go to a copy of the encoded data in bufScratchPad. Correcting in place repairs the copy, so that
+        // correct runs a single pass per repetition and every repetition starts from the same faults.
+        const size_t encodedBytes = std::min(GetEncodedNumBytes(configTest.numValues), bufScratchPad.nBytes);
+        const FaultInjector injector(configTest.faultSpec);
+        TestConfiguration tcCorrect(1, configTest.numValues);
+        tcCorrect.numRepetitions = configTest.numRepetitions;
+        tcCorrect.rejectOutliers = configTest.rejectOutliers;
+        for (auto errorRate : configTest.correctionErrorRates) {
+            CorrectionInfo info(errorRate, static_cast<size_t>(std::llround(errorRate * configTest.numValues)));
+            CorrectionCounts correctionCounts;
+            auto preFunc = [this,encodedBytes,&injector,&info,&correctionCounts] {
+                memcpy(this->bufScratchPad.begin(), this->bufEncoded.begin(), encodedBytes);
+                injector.inject(this->bufScratchPad, encodedBytes, info.numFaults);
+                correctionCounts.clear();
+            };
+            auto verify = [this,&configTest,&info] (const AlignedBlock & decoded) {
+                if (info.numUncorrectable == 0) {
+                    compare(this->bufRaw, decoded, configTest.numValues * getRawDataTypeSize());
+                }
+            };
+            CorrectConfiguration corrConf(tcCorrect, bufRaw, bufScratchPad, correctionCounts);
+            auto runCorrect = [this,&corrConf,&correctionCounts] (size_t partitionId, size_t numPartitions) {
+                InternalRunPartition(*this, corrConf, BufferLayout::Raw, BufferLayout::Encoded, partitionId, numPartitions, [this,&correctionCounts] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                    this->RunCorrect(CorrectConfiguration(part, source, target, correctionCounts));
+                });
+            };
+            auto postCorrect = [this,&tcSingleIter,&info,&correctionCounts,&verify] {
+                info.numCorrected = correctionCounts.numCorrected;
+                info.numUncorrectable = correctionCounts.numUncorrectable;
+                if (info.numUncorrectable == 0) {
+                    this->RunDecodeChecked(DecodeConfiguration(tcSingleIter, bufScratchPad, bufDecoded));
+                    verify(this->bufDecoded);
+                }
+            };
+            InternalExecute(*this, tcCorrect, sw, counters.get(), info.correct, preFunc, runCorrect, postCorrect);
+            CorrectConfiguration decCorrConf(configTest, bufScratchPad, bufDecoded, correctionCounts);
+            auto runDecodeCorrected = [this,&decCorrConf,&correctionCounts] (size_t partitionId, size_t numPartitions) {
+                InternalRunPartition(*this, decCorrConf, BufferLayout::Encoded, BufferLayout::Raw, partitionId, numPartitions, [this,&correctionCounts] (const BasicTestConfiguration & part, const AlignedBlock & source, const AlignedBlock & target) {
+                    this->RunDecodeCorrected(CorrectConfiguration(part, source, target, correctionCounts));
+                });
+            };
+            auto postDecodeCorrected = [this,&verify] {
+                verify(this->bufDecoded);
+            };
+            InternalExecute(*this, configTest, sw, counters.get(), info.decodeCorrected, preFunc, runDecodeCorrected, postDecodeCorrected);
+            corrections.push_back(info);
+        }
+    }
+
+    TestInfo tiPipeFused, tiPipePhased;
+    if (!configTest.pipeline.empty()) {
+        // Resolve the buffers of each stage. The pipeline starts on bufEncoded (or bufRaw) and its intermediate results
+        // alternate between bufResult and bufScratchPad, so that no stage works in place.
+        std::vector<PipelineStep> steps;
+        bool isSupported = true;
+        AlignedBlock * current = &bufEncoded;
+        BufferLayout layoutCurrent = BufferLayout::Encoded;
+        if (configTest.pipeline.front() == PipelineStage::Encode) {
+            current = &bufRaw;
+            layoutCurrent = BufferLayout::Raw;
+        }
+        for (auto stage : configTest.pipeline) {
+            AlignedBlock * next = (current == &bufResult) ? &bufScratchPad : &bufResult;
+            BufferLayout layoutNext = BufferLayout::Encoded;
+            switch (stage) {
+                case PipelineStage::Encode:
+                    break;
+                case PipelineStage::Check:
+                    isSupported &= this->DoCheck();
+                    steps.push_back(PipelineStep {stage, &bufRaw, BufferLayout::Raw, current, layoutCurrent}); // see chkConf
+                    continue; // passes its input on
+                case PipelineStage::Add:
+                case PipelineStage::Sub:
+                case PipelineStage::Mul:
+                case PipelineStage::Div:
+                    isSupported &= this->DoArithmetic(ArithmeticConfiguration(configTest, bufEncoded, bufResult, getPipelineArithmeticMode(stage), arithOperand));
+                    break;
+                case PipelineStage::AddChk:
+                case PipelineStage::SubChk:
+                case PipelineStage::MulChk:
+                case PipelineStage::DivChk:
+                    isSupported &= this->DoArithmeticChecked(ArithmeticConfiguration(configTest, bufEncoded, bufResult, getPipelineArithmeticMode(stage), arithOperand));
+                    break;
+                case PipelineStage::Decode:
+                    isSupported &= this->DoDecode();
+                    layoutNext = BufferLayout::Raw;
+                    break;
+                case PipelineStage::DecodeChk:
+                    isSupported &= this->DoDecode();
+                    layoutNext = BufferLayout::Raw;
+                    break;
+            }
+            steps.push_back(PipelineStep {stage, current, layoutCurrent, next, layoutNext});
+            current = next;
+            layoutCurrent = layoutNext;
+        }
+
+        if (!isValidPipeline(configTest.pipeline)) {
+            const char * msg = "the pipeline stages do not fit together: encode takes raw data, all other stages encoded data";
+            tiPipeFused.set(msg);
+            tiPipePhased.set(msg);
+        } else if (isSupported) {
+            std::clog << ", pipeline" << std::flush;
+            // The chunks are the cache-sized partitions of the data. All stages use the same value ranges, even when
+            // their buffer layouts would allow other partition boundaries.
+            const size_t encodedBytes = GetEncodedNumBytes(configTest.numValues);
+            const size_t chunkBytes = std::max(configTest.pipelineChunkBytes, size_t(1));
+            const size_t numChunks = std::max((encodedBytes + chunkBytes - 1) / chunkBytes, size_t(1));
+            const SubTestConfiguration chunkConf(configTest, bufRaw, bufEncoded);
+            std::vector<std::pair<size_t, size_t>> chunks; // offset and number of values
+            chunks.reserve(numChunks);
+            for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+                auto partition = GetPartition(chunkConf, BufferLayout::Raw, BufferLayout::Encoded, chunk, numChunks);
+                if (partition.numValues) {
+                    chunks.emplace_back(partition.offset, partition.numValues);
+                }
+            }
+
+            auto runStep = [this,arithOperand] (const PipelineStep & step, size_t offset, size_t numValues) {
+                const BasicTestConfiguration part(1, numValues);
+                const size_t offsetSource = GetByteOffset(step.layoutSource, offset);
+                const size_t offsetTarget = GetByteOffset(step.layoutTarget, offset);
+                const AlignedBlock source(*step.source, offsetSource, step.source->nBytes - offsetSource);
+                const AlignedBlock target(*step.target, offsetTarget, step.target->nBytes - offsetTarget);
+                try {
+                    switch (step.stage) {
+                        case PipelineStage::Encode:
+                            this->RunEncode(EncodeConfiguration(part, source, target));
+                            break;
+                        case PipelineStage::Check:
+                            this->RunCheck(CheckConfiguration(part, source, target));
+                            break;
+                        case PipelineStage::Add:
+                        case PipelineStage::Sub:
+                        case PipelineStage::Mul:
+                        case PipelineStage::Div:
+                            this->RunArithmetic(ArithmeticConfiguration(part, source, target, getPipelineArithmeticMode(step.stage), arithOperand));
+                            break;
+                        case PipelineStage::AddChk:
+                        case PipelineStage::SubChk:
+                        case PipelineStage::MulChk:
+                        case PipelineStage::DivChk:
+                            this->RunArithmeticChecked(ArithmeticConfiguration(part, source, target, getPipelineArithmeticMode(step.stage), arithOperand));
+                            break;
+                        case PipelineStage::Decode:
+                            this->RunDecode(DecodeConfiguration(part, source, target));
+                            break;
+                        case PipelineStage::DecodeChk:
+                            this->RunDecodeChecked(DecodeConfiguration(part, source, target));
+                            break;
+                    }
+                } catch (ErrorInfo & ei) {
+                    if (ei.i && ei.i.value() != static_cast<size_t>(-1)) {
+                        ei.i = ei.i.value() + offset;
+                    }
+                    throw;
+                }
+            };
+            // each thread works on a contiguous range of chunks, in both variants
+            auto getChunkRange = [&chunks] (size_t partitionId, size_t numPartitions) {
+                return std::make_pair((chunks.size() * partitionId) / numPartitions, (chunks.size() * (partitionId + 1)) / numPartitions);
+            };
+            auto preFunc = [this] {
+                this->bufResult.clear();
+                this->bufScratchPad.clear();
+            };
+
+            std::clog << " phased" << std::flush;
+            auto runPhased = [&configTest,&chunks,&steps,&runStep,&getChunkRange] (size_t partitionId, size_t numPartitions) {
+                const auto range = getChunkRange(partitionId, numPartitions);
+                if (range.first == range.second) {
+                    return;
+                }
+                const size_t offset = chunks[range.first].first;
+                const size_t numValues = chunks[range.second - 1].first + chunks[range.second - 1].second - offset;
+                for (size_t iteration = 0; iteration < configTest.numIterations; ++iteration) {
+                    for (auto & step : steps) {
+                        runStep(step, offset, numValues);
+                    }
+                }
+            };
+            auto postPhased = [this,current] {
+                memcpy(this->bufArith.begin(), current->begin(), std::min(current->nBytes, this->bufArith.nBytes)); // the reference for the fused pipeline
+            };
+            InternalExecute(*this, configTest, sw, counters.get(), tiPipePhased, preFunc, runPhased, postPhased);
+
+            std::clog << ", fused" << std::flush;
+            auto runFused = [&configTest,&chunks,&steps,&runStep,&getChunkRange] (size_t partitionId, size_t numPartitions) {
+                const auto range = getChunkRange(partitionId, numPartitions);
+                for (size_t iteration = 0; iteration < configTest.numIterations; ++iteration) {
+                    for (size_t chunk = range.first; chunk < range.second; ++chunk) {
+                        for (auto & step : steps) {
+                            runStep(step, chunks[chunk].first, chunks[chunk].second);
+                        }
+                    }
+                }
+            };
+            auto postFused = [this,current] {
+                compare(this->bufArith, *current, std::min(current->nBytes, this->bufArith.nBytes));
+            };
+            InternalExecute(*this, configTest, sw, counters.get(), tiPipeFused, preFunc, runFused, postFused);
+        }
     }
 
-    return TestInfos(datawidth, this->name, getSIMDtypeName(), tiEnc, tiCheck, tiAdd, tiSub, tiMul, tiDiv, tiAddChk, tiSubChk, tiMulChk, tiDivChk, tiSum, tiMin, tiMax, tiAvg, tiSumChk, tiMinChk,
-            tiMaxChk, tiAvgChk, tiReencChk, tiDec, tiDecChk);
+    TestInfos infos(datawidth, this->name, getSIMDtypeName(), tiEnc, tiCheck, tiFilter, tiFilterChk, tiAdd, tiSub, tiMul, tiDiv, tiAddChk, tiSubChk, tiMulChk, tiDivChk, tiSum, tiMin, tiMax, tiAvg, tiSumChk,
+            tiMinChk, tiMaxChk, tiAvgChk, tiReencChk, tiDec, tiDecChk);
+    infos.pipelineFused = tiPipeFused;
+    infos.pipelinePhased = tiPipePhased;
+    infos.scrub = tiScrub;
+    infos.consumeDecoded = tiConsDec;
+    infos.consumeView = tiConsView;
+    infos.consumeDecodedChecked = tiConsDecChk;
+    infos.consumeViewChecked = tiConsViewChk;
+    infos.bitAnd = tiAnd;
+    infos.bitOr = tiOr;
+    infos.bitXor = tiXor;
+    infos.bitNot = tiNot;
+    infos.shiftLeft = tiShl;
+    infos.shiftRight = tiShr;
+    infos.bitAndChecked = tiAndChk;
+    infos.bitOrChecked = tiOrChk;
+    infos.bitXorChecked = tiXorChk;
+    infos.bitNotChecked = tiNotChk;
+    infos.shiftLeftChecked = tiShlChk;
+    infos.shiftRightChecked = tiShrChk;
+    infos.corrections = std::move(corrections);
+    infos.faults = std::move(faults);
+    return infos;
 }
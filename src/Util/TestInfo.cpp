@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
 #include <sstream>
 
@@ -20,12 +22,22 @@
 TestInfo::TestInfo()
         : isExecuted(false),
           nanos(0),
+          numRepetitions(0),
+          numOutliers(0),
+          nanosMin(0),
+          nanosMedian(0),
+          nanosP90(0),
+          nanosP99(0),
+          nanosMean(0),
+          nanosStddev(0),
+          countersPerValue(),
+          ipc(0),
           error() {
 }
 
 TestInfo::TestInfo(
         int64_t nanos)
-        : TestInfo(true, nanos, nullptr) {
+        : TestInfo(true, nanos, std::string()) {
 }
 
 TestInfo::TestInfo(
@@ -39,6 +51,16 @@ TestInfo::TestInfo(
         const std::string & error)
         : isExecuted(isExecuted),
           nanos(nanos),
+          numRepetitions(isExecuted && error.empty()),
+          numOutliers(0),
+          nanosMin(nanos),
+          nanosMedian(nanos),
+          nanosP90(nanos),
+          nanosP99(nanos),
+          nanosMean(static_cast<double>(nanos)),
+          nanosStddev(0),
+          countersPerValue(),
+          ipc(0),
           error(error) {
 }
 
@@ -46,6 +68,16 @@ TestInfo::TestInfo(
         const TestInfo & other)
         : isExecuted(other.isExecuted),
           nanos(other.nanos),
+          numRepetitions(other.numRepetitions),
+          numOutliers(other.numOutliers),
+          nanosMin(other.nanosMin),
+          nanosMedian(other.nanosMedian),
+          nanosP90(other.nanosP90),
+          nanosP99(other.nanosP99),
+          nanosMean(other.nanosMean),
+          nanosStddev(other.nanosStddev),
+          countersPerValue(other.countersPerValue),
+          ipc(other.ipc),
           error(other.error) {
 }
 
@@ -54,8 +86,77 @@ TestInfo::~TestInfo() {
 
 void TestInfo::set(
         int64_t nanos) {
+    this->set(TimingSamples {std::vector<int64_t>(1, nanos), false, {}, 0});
+}
+
+/**
+ * Nearest-rank percentile of an ascendingly sorted, non-empty vector.
+ */
+static int64_t percentile(
+        const std::vector<int64_t> & sorted,
+        const size_t percent) {
+    const size_t rank = (sorted.size() * percent + 99) / 100;
+    return sorted[rank == 0 ? 0 : (rank - 1)];
+}
+
+void TestInfo::set(
+        const TimingSamples & samples) {
+    std::vector<int64_t> sorted(samples.nanos);
+    std::sort(sorted.begin(), sorted.end());
+    this->numOutliers = 0;
+    if (samples.rejectOutliers && sorted.size() > 2) {
+        const int64_t median = percentile(sorted, 50);
+        std::vector<int64_t> deviations;
+        deviations.reserve(sorted.size());
+        for (auto x : sorted) {
+            deviations.push_back(std::abs(x - median));
+        }
+        std::sort(deviations.begin(), deviations.end());
+        const double threshold = 3.0 * 1.4826 * percentile(deviations, 50); // 1.4826 * MAD estimates the standard deviation of normally distributed samples
+        if (threshold > 0) {
+            auto end = std::remove_if(sorted.begin(), sorted.end(), [median,threshold] (int64_t x) {
+                return std::abs(x - median) > threshold;
+            });
+            this->numOutliers = static_cast<size_t>(std::distance(end, sorted.end()));
+            sorted.erase(end, sorted.end());
+        }
+    }
     this->isExecuted = true;
-    this->nanos = nanos;
+    this->numRepetitions = sorted.size() + this->numOutliers;
+    if (sorted.empty()) {
+        this->nanos = this->nanosMin = this->nanosMedian = this->nanosP90 = this->nanosP99 = 0;
+        this->nanosMean = this->nanosStddev = 0;
+    } else {
+        this->nanosMin = sorted.front();
+        this->nanosMedian = percentile(sorted, 50);
+        this->nanosP90 = percentile(sorted, 90);
+        this->nanosP99 = percentile(sorted, 99);
+        this->nanos = this->nanosMedian;
+        double sum = 0;
+        for (auto x : sorted) {
+            sum += x;
+        }
+        this->nanosMean = sum / sorted.size();
+        double sumSquares = 0;
+        for (auto x : sorted) {
+            sumSquares += (x - this->nanosMean) * (x - this->nanosMean);
+        }
+        this->nanosStddev = sorted.size() > 1 ? std::sqrt(sumSquares / (sorted.size() - 1)) : 0;
+    }
+    this->countersPerValue.clear();
+    this->ipc = 0;
+    uint64_t cycles = 0, instructions = 0;
+    for (auto & counter : samples.counters) {
+        this->countersPerValue.emplace_back(counter.first, samples.numValues ? (static_cast<double>(counter.second) / samples.numValues) : 0.0);
+        if (counter.first == "cycles") {
+            cycles = counter.second;
+        } else if (counter.first == "instructions") {
+            instructions = counter.second;
+        }
+    }
+    if (cycles) {
+        this->ipc = static_cast<double>(instructions) / cycles;
+    }
     this->error.clear();
 }
 
@@ -63,6 +164,11 @@ void TestInfo::set(
         const std::string & error) {
     this->isExecuted = true;
     this->nanos = 0;
+    this->numRepetitions = this->numOutliers = 0;
+    this->nanosMin = this->nanosMedian = this->nanosP90 = this->nanosP99 = 0;
+    this->nanosMean = this->nanosStddev = 0;
+    this->countersPerValue.clear();
+    this->ipc = 0;
     this->error = error;
 }
 
@@ -73,6 +179,35 @@ TestInfo & TestInfo::operator=(
     return *this;
 }
 
+CorrectionInfo::CorrectionInfo(
+        double errorRate,
+        size_t numFaults)
+        : errorRate(errorRate),
+          numFaults(numFaults),
+          numCorrected(0),
+          numUncorrectable(0),
+          correct(),
+          decodeCorrected() {
+}
+
+FaultInfo::FaultInfo(
+        double faultRate,
+        size_t numFaults,
+        size_t numChunks)
+        : faultRate(faultRate),
+          numFaults(numFaults),
+          numBitsChanged(0),
+          numChunks(numChunks),
+          numDetected(0),
+          numSilent(),
+          numCorruptValues(),
+          numCorrectedValues(),
+          numFlaggedValues(),
+          numMissedValues(),
+          check(),
+          scrub() {
+}
+
 TestInfos::TestInfos(
         const size_t datawidth,
         const std::string & name,
@@ -82,6 +217,8 @@ TestInfos::TestInfos(
           simd(simd),
           encode(),
           check(),
+          filter(),
+          filterChecked(),
           add(),
           sub(),
           mul(),
@@ -101,7 +238,31 @@ TestInfos::TestInfos(
           reencodeChecked(),
           decode(),
           decodeChecked(),
-          reference(nullptr) {
+          pipelineFused(),
+          pipelinePhased(),
+          scrub(),
+          consumeDecoded(),
+          consumeView(),
+          consumeDecodedChecked(),
+          consumeViewChecked(),
+          bitAnd(),
+          bitOr(),
+          bitXor(),
+          bitNot(),
+          shiftLeft(),
+          shiftRight(),
+          bitAndChecked(),
+          bitOrChecked(),
+          bitXorChecked(),
+          bitNotChecked(),
+          shiftLeftChecked(),
+          shiftRightChecked(),
+          corrections(),
+          faults(),
+          reference(nullptr),
+          blockSize(0),
+          A(),
+          AInv() {
 }
 
 TestInfos::TestInfos(
@@ -110,6 +271,8 @@ TestInfos::TestInfos(
         const std::string & simd,
         TestInfo & encode,
         TestInfo & check,
+        TestInfo & filter,
+        TestInfo & filterChecked,
         TestInfo & add,
         TestInfo & sub,
         TestInfo & mul,
@@ -134,6 +297,8 @@ TestInfos::TestInfos(
           simd(simd),
           encode(encode),
           check(check),
+          filter(filter),
+          filterChecked(filterChecked),
           add(add),
           sub(sub),
           mul(mul),
@@ -153,7 +318,31 @@ TestInfos::TestInfos(
           reencodeChecked(reencodeChecked),
           decode(decode),
           decodeChecked(checkAndDecode),
-          reference(nullptr) {
+          pipelineFused(),
+          pipelinePhased(),
+          scrub(),
+          consumeDecoded(),
+          consumeView(),
+          consumeDecodedChecked(),
+          consumeViewChecked(),
+          bitAnd(),
+          bitOr(),
+          bitXor(),
+          bitNot(),
+          shiftLeft(),
+          shiftRight(),
+          bitAndChecked(),
+          bitOrChecked(),
+          bitXorChecked(),
+          bitNotChecked(),
+          shiftLeftChecked(),
+          shiftRightChecked(),
+          corrections(),
+          faults(),
+          reference(nullptr),
+          blockSize(0),
+          A(),
+          AInv() {
 }
 
 TestInfos::TestInfos(
@@ -162,6 +351,8 @@ TestInfos::TestInfos(
         const std::string & simd,
         TestInfo & encode,
         TestInfo & check,
+        TestInfo & filter,
+        TestInfo & filterChecked,
         TestInfo & add,
         TestInfo & sub,
         TestInfo & mul,
@@ -187,6 +378,8 @@ TestInfos::TestInfos(
           simd(simd),
           encode(encode),
           check(check),
+          filter(filter),
+          filterChecked(filterChecked),
           add(add),
           sub(sub),
           mul(mul),
@@ -206,12 +399,48 @@ TestInfos::TestInfos(
           reencodeChecked(reencodeChecked),
           decode(decode),
           decodeChecked(checkAndDecode),
-          reference(reference) {
+          pipelineFused(),
+          pipelinePhased(),
+          scrub(),
+          consumeDecoded(),
+          consumeView(),
+          consumeDecodedChecked(),
+          consumeViewChecked(),
+          bitAnd(),
+          bitOr(),
+          bitXor(),
+          bitNot(),
+          shiftLeft(),
+          shiftRight(),
+          bitAndChecked(),
+          bitOrChecked(),
+          bitXorChecked(),
+          bitNotChecked(),
+          shiftLeftChecked(),
+          shiftRightChecked(),
+          corrections(),
+          faults(),
+          reference(reference),
+          blockSize(0),
+          A(),
+          AInv() {
 }
 
 TestInfos::~TestInfos() {
 }
 
+const std::array<std::pair<const char *, TestInfo TestInfos::*>, 42> TestInfosPhases = { {
+        {"enc", &TestInfos::encode}, {"chk", &TestInfos::check}, {"scrb", &TestInfos::scrub}, {"fil", &TestInfos::filter}, {"filC", &TestInfos::filterChecked},
+        {"add", &TestInfos::add}, {"sub", &TestInfos::sub}, {"mul", &TestInfos::mul}, {"div", &TestInfos::div},
+        {"addC", &TestInfos::addChecked}, {"subC", &TestInfos::subChecked}, {"mulC", &TestInfos::mulChecked}, {"divC", &TestInfos::divChecked},
+        {"sum", &TestInfos::sum}, {"min", &TestInfos::min}, {"max", &TestInfos::max}, {"avg", &TestInfos::avg},
+        {"sumC", &TestInfos::sumChecked}, {"minC", &TestInfos::minChecked}, {"maxC", &TestInfos::maxChecked}, {"avgC", &TestInfos::avgChecked},
+        {"renC", &TestInfos::reencodeChecked}, {"dec", &TestInfos::decode}, {"decC", &TestInfos::decodeChecked},
+        {"pipF", &TestInfos::pipelineFused}, {"pipP", &TestInfos::pipelinePhased},
+        {"conD", &TestInfos::consumeDecoded}, {"conV", &TestInfos::consumeView}, {"conDC", &TestInfos::consumeDecodedChecked}, {"conVC", &TestInfos::consumeViewChecked},
+        {"and", &TestInfos::bitAnd}, {"or", &TestInfos::bitOr}, {"xor", &TestInfos::bitXor}, {"not", &TestInfos::bitNot}, {"shl", &TestInfos::shiftLeft}, {"shr", &TestInfos::shiftRight},
+        {"andC", &TestInfos::bitAndChecked}, {"orC", &TestInfos::bitOrChecked}, {"xorC", &TestInfos::bitXorChecked}, {"notC", &TestInfos::bitNotChecked}, {"shlC", &TestInfos::shiftLeftChecked}, {"shrC", &TestInfos::shiftRightChecked}}};
+
 void setTestInfosReference(
         std::vector<TestInfos> & vecTarget,
         const std::vector<TestInfos> & vecReferences) {
@@ -0,0 +1,63 @@
+// Copyright 2016 Till Kolditz, Stefan de Bruijn
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Util/TestRegistry.hpp>
+
+TestRegistry & TestRegistry::Instance() {
+    static TestRegistry instance;
+    return instance;
+}
+
+const std::vector<RegisteredTest> & TestRegistry::Tests() const {
+    return tests;
+}
+
+bool matchesPattern(
+        const std::string & pattern,
+        const std::string & name) {
+    size_t p = 0, n = 0;
+    size_t starP = std::string::npos, starN = 0; // position of the last '*' and where its match currently ends
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+            ++p;
+            ++n;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            starP = p++;
+            starN = n;
+        } else if (starP != std::string::npos) {
+            p = starP + 1;
+            n = ++starN;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+const char* getISAName(
+        CPU::ISA isa) {
+    switch (isa) {
+        case CPU::ISA::AVX512:
+            return "avx512";
+        case CPU::ISA::AVX2:
+            return "avx2";
+        case CPU::ISA::SSE42:
+            return "sse42";
+        default:
+            return "scalar";
+    }
+}